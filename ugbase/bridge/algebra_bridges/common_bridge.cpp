@@ -64,6 +64,12 @@
 
 #include "lib_algebra/operator/energy_convergence_check.h"
 
+#include "lib_algebra/algebra_common/sparsematrix_triple_product_test.h"
+
+#ifdef UG_PARALLEL
+#include "lib_algebra/parallelization/parallel_matrix_test.h"
+#endif
+
 using namespace std;
 
 namespace ug{
@@ -203,6 +209,24 @@ static void Algebra(Registry& reg, string grp)
 						  &ApplyLinearSolver<vector_type>, grp);
 	}
 
+//	TestSparseTripleProduct
+	{
+		reg.add_function("TestSparseTripleProduct",
+		                 &TestSparseTripleProduct<TAlgebra>, grp, "",
+		                 "matrix operator#tolerance",
+		                 "compares the sparse triple product with AddMultiplyOf and checks the reuse of its symbolic phase");
+	}
+
+#ifdef UG_PARALLEL
+//	TestParallelMatrixOverlap
+	{
+		reg.add_function("TestParallelMatrixOverlap",
+		                 &TestParallelMatrixOverlap<TAlgebra>, grp, "",
+		                 "matrix operator#vector#tolerance",
+		                 "compares the overlapped parallel matrix products with the products for consistent vectors");
+	}
+#endif
+
 //  Vector Debug Writer (abstract base class)
 	{
 		typedef IVectorDebugWriter<vector_type> T;
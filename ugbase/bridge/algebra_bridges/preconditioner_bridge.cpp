@@ -45,6 +45,8 @@
 #include "lib_algebra/lib_algebra.h"
 #include "lib_algebra/operator/preconditioner/preconditioners.h"
 #include "lib_algebra/operator/preconditioner/ilut_scalar.h"
+#include "lib_algebra/operator/preconditioner/bsr_smoothers.h"
+#include "lib_algebra/operator/preconditioner/bsr_smoothers_test.h"
 #include "lib_algebra/operator/linear_solver/agglomerating_solver.h"
 #include "lib_algebra/operator/preconditioner/block_gauss_seidel.h"
 
@@ -169,6 +171,23 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "Jacobi", tag);
 	}
 
+//	Chebyshev
+	{
+		typedef Chebyshev<TAlgebra> T;
+		typedef IPreconditioner<TAlgebra> TBase;
+		string name = string("Chebyshev").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Chebyshev-accelerated Jacobi Preconditioner")
+			.add_constructor()
+			.template add_constructor<void (*)(int)>("Degree")
+			.add_method("set_degree", &T::set_degree, "", "degree", "sets the degree of the polynomial (default 3)")
+			.add_method("set_smoothing_range", &T::set_smoothing_range, "", "range", "sets the ratio of largest to smallest damped eigenvalue (default 30)")
+			.add_method("set_eigenvalue_safety", &T::set_eigenvalue_safety, "", "safety", "sets the factor the estimated largest eigenvalue is enlarged by (default 1.1)")
+			.add_method("set_num_power_iterations", &T::set_num_power_iterations, "", "numIter", "sets the number of power iterations for the eigenvalue estimate (default 10)")
+			.add_method("max_eigenvalue", &T::max_eigenvalue, "eigenvalue")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "Chebyshev", tag);
+	}
+
 //	GaussSeidelBase
 	{
 		typedef GaussSeidelBase<TAlgebra> T;
@@ -215,6 +234,20 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "BackwardGaussSeidel", tag);
 	}
 
+//	Multicolor GaussSeidel
+	{
+		typedef MulticolorGaussSeidel<TAlgebra> T;
+		typedef GaussSeidelBase<TAlgebra> TBase;
+		string name = string("MulticolorGaussSeidel").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Multicolor Gauss Seidel Preconditioner (threaded sweeps)")
+			.add_constructor()
+			.add_method("set_backward", &T::set_backward, "", "bBackward", "process the colors in reverse order. default false")
+			.add_method("set_symmetric", &T::set_symmetric, "", "bSymmetric", "perform a forward and a backward step. default false")
+			.add_method("num_colors", &T::num_colors, "number of colors", "", "number of colors of the last preprocess")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MulticolorGaussSeidel", tag);
+	}
+
 //	BlockGaussSeidel
 	{
 		RegisterBlockGaussSeidel<TAlgebra, BlockGaussSeidel<TAlgebra, true, false> >(reg, grp, "BlockGaussSeidel");
@@ -248,6 +281,8 @@ static void Algebra(Registry& reg, string grp)
 						"set whether preprocessing (notably, LU factorization) is to be disabled - usable when the operator has not changed; use with care")
 			.add_method("enable_consistent_interfaces", &T::enable_consistent_interfaces, "", "enable", "Make Matrix consistent for connections in interfaces.")
 			.add_method("enable_overlap", &T::enable_overlap, "", "enable", "Enables matrix overlap. This also means that interfaces are consistent.")
+			.add_method("set_level_scheduling", &T::set_level_scheduling, "", "enable", "Enables the level scheduled (multithreaded) factorization and triangular solves.")
+			.add_method("set_triangular_jacobi_sweeps", &T::set_triangular_jacobi_sweeps, "", "numSweeps", "Approximates the triangular solves by numSweeps Jacobi sweeps (0: exact solves). default 0")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "ILU", tag);
 	}
@@ -285,6 +320,45 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "ILUTScalar", tag);
 	}
 
+//	Block sparse row smoothers
+	{
+		typedef IBSRPreconditioner<TAlgebra> T;
+		typedef IPreconditioner<TAlgebra> TBase;
+		string name = string("IBSRPreconditioner").append(suffix);
+		reg.add_class_<T,TBase>(name, grp)
+			.add_method("set_block_size", &T::set_block_size, "", "blockSize",
+						"number of algebra indices per block. 0: group rows with identical sparsity pattern (default)")
+			.add_method("set_max_block_size", &T::set_max_block_size, "", "maxBlockSize",
+						"maximal number of scalar rows of a detected block. default 8")
+			.add_method("set_info", &T::set_info, "", "info", "prints statistics of the block storage");
+		reg.add_class_to_group(name, "IBSRPreconditioner", tag);
+	}
+	{
+		typedef BSRGaussSeidel<TAlgebra> T;
+		typedef IBSRPreconditioner<TAlgebra> TBase;
+		string name = string("BSRGaussSeidel").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Block Gauss-Seidel on block sparse row storage")
+			.add_constructor()
+			.add_method("set_backward", &T::set_backward, "", "bBackward", "process the block rows in reverse order. default false")
+			.add_method("set_symmetric", &T::set_symmetric, "", "bSymmetric", "perform a forward and a backward step. default false")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "BSRGaussSeidel", tag);
+	}
+	{
+		typedef BSRILU<TAlgebra> T;
+		typedef IBSRPreconditioner<TAlgebra> TBase;
+		string name = string("BSRILU").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Block ILU(0) on block sparse row storage")
+			.add_constructor()
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "BSRILU", tag);
+	}
+	{
+		reg.add_function("TestBSRSmoothers", &TestBSRSmoothers<TAlgebra>, grp, "",
+		                 "matrix operator#vector#tolerance",
+		                 "compares the block sparse row kernels and smoothers with their SparseMatrix counterparts");
+	}
+
 //	LinearIteratorProduct
 	{
 		typedef LinearIteratorProduct<vector_type, vector_type> T;
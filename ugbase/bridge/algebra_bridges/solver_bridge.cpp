@@ -48,9 +48,12 @@
 #include "lib_algebra/operator/linear_solver/analyzing_solver.h"
 #include "lib_algebra/operator/linear_solver/cg.h"
 #include "lib_algebra/operator/linear_solver/bicgstab.h"
+#include "lib_algebra/operator/linear_solver/pipelined_cg.h"
+#include "lib_algebra/operator/linear_solver/pipelined_bicgstab.h"
 #include "lib_algebra/operator/linear_solver/gmres.h"
 #include "lib_algebra/operator/linear_solver/lu.h"
 #include "lib_algebra/operator/linear_solver/agglomerating_solver.h"
+#include "lib_algebra/operator/linear_solver/group_agglomerating_solver.h"
 #include "lib_algebra/operator/linear_solver/debug_iterator.h"
 #include "lib_algebra/operator/linear_solver/external_solvers/external_solvers.h"
 #ifdef UG_PARALLEL
@@ -234,6 +237,39 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "BiCGStab", tag);
 	}
 
+// 	Pipelined CG Solver
+	{
+		typedef PipelinedCG<vector_type> T;
+		typedef IPreconditionedLinearOperatorInverse<vector_type> TBase;
+		string name = string("PipelinedCG").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Pipelined Conjugate Gradient Solver (one fused reduction per step)")
+			.add_constructor()
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> > ) )("precond")
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
+			.add_method("set_residual_replacement", &T::set_residual_replacement, "", "numSteps", "recomputes the true defect every numSteps steps (0 = never)")
+			.add_method("set_fused_defect_norm", &T::set_fused_defect_norm, "", "bFused", "computes the defect norm within the fused reduction (requires a convergence check supporting update_defect)")
+			.add_method("add_postprocess_corr", &T::add_postprocess_corr, "adds a postprocess of the corrections", "op")
+			.add_method("remove_postprocess_corr", &T::remove_postprocess_corr, "removes a postprocess of the corrections", "op")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "PipelinedCG", tag);
+	}
+
+// 	Pipelined BiCGStab Solver
+	{
+		typedef PipelinedBiCGStab<vector_type> T;
+		typedef IPreconditionedLinearOperatorInverse<vector_type> TBase;
+		string name = string("PipelinedBiCGStab").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Pipelined BiCGStab Solver (two fused reductions per step)")
+			.add_constructor()
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> > ) )("precond")
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
+			.add_method("set_fused_defect_norm", &T::set_fused_defect_norm, "", "bFused", "computes the defect norm within the fused reduction (requires a convergence check supporting update_defect)")
+			.add_method("add_postprocess_corr", &T::add_postprocess_corr, "adds a postprocess of the corrections", "op")
+			.add_method("remove_postprocess_corr", &T::remove_postprocess_corr, "removes a postprocess of the corrections", "op")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "PipelinedBiCGStab", tag);
+	}
+
 // 	GMRES Solver
 	{
 		typedef GMRES<vector_type> T;
@@ -241,12 +277,24 @@ static void Algebra(Registry& reg, string grp)
 		string name = string("GMRES").append(suffix);
 		reg.add_class_<T,TBase>(name, grp, "GMRES Solver")
 			.ADD_CONSTRUCTOR( (size_t restar) )("restart")
+			.add_method("set_reorthogonalization", &T::set_reorthogonalization, "", "eta", "reorthogonalizes if the norm drops below eta times the original norm (0 = never, >= 1 = always)")
 			.add_method("add_postprocess_corr", &T::add_postprocess_corr, "adds a postprocess of the corrections", "op")
 			.add_method("remove_postprocess_corr", &T::remove_postprocess_corr, "removes a postprocess of the corrections", "op")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "GMRES", tag);
 	}
 
+// 	FGMRES Solver
+	{
+		typedef FGMRES<vector_type> T;
+		typedef GMRES<vector_type> TBase;
+		string name = string("FGMRES").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Flexible GMRES Solver")
+			.ADD_CONSTRUCTOR( (size_t restar) )("restart")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "FGMRES", tag);
+	}
+
 // 	LU Solver
 	{
 		typedef LU<TAlgebra> T;
@@ -273,6 +321,20 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "AgglomeratingSolver", tag);
 	}
 
+// 	GroupAgglomeratingSolver
+	{
+		typedef GroupAgglomeratingSolver<TAlgebra> T;
+		typedef ILinearOperatorInverse<vector_type> TBase;
+		string name = string("GroupAgglomeratingSolver").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Agglomerating solver with process groups and redundant solves")
+			.ADD_CONSTRUCTOR( (SmartPtr<ILinearOperatorInverse<vector_type, vector_type> > ) )("pLinOp")
+			.add_method("set_group_size", &T::set_group_size, "", "groupSize", "number of processes per group (0 = automatic)")
+			.add_method("set_gather_dofs", &T::set_gather_dofs, "", "n", "number of unknowns collected per group root in automatic mode")
+			.add_method("set_max_redundant_dofs", &T::set_max_redundant_dofs, "", "n", "up to this global number of unknowns all group roots solve redundantly")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "GroupAgglomeratingSolver", tag);
+	}
+
 
 #ifdef UG_PARALLEL
 // 	LocalSchurComplement
@@ -45,6 +45,7 @@
 #include "lib_disc/spatial_disc/domain_disc.h"
 #include "lib_disc/parallelization/domain_distribution.h"
 #include "lib_disc/function_spaces/grid_function.h"
+#include "lib_disc/operator/linear_operator/matrix_free_operator_test.h"
 
 
 using namespace std;
@@ -117,6 +118,14 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "DomainDiscretization", tag);
 	}
 
+//	TestMatrixFreeOperator
+	{
+		reg.add_function("TestMatrixFreeOperator",
+		                 &TestMatrixFreeOperator<TDomain, TAlgebra>, domDiscGrp, "",
+		                 "domain discretization#linearization point#tolerance",
+		                 "compares the matrix-free jacobian and its diagonal with the assembled jacobian");
+	}
+
 //	IDiscretizationItem
 	{
 		typedef IDiscretizationItem<TDomain, TAlgebra> T;
@@ -239,6 +248,8 @@ static void Algebra(Registry& reg, string grp)
 		reg.add_class_<T>(name+suffix, grp)
 			.add_method("set_matrix_is_const", &T::set_matrix_is_const, "",
 						"whether matrix is constant in time", "")
+			.add_method("set_reuse_matrix_structure", &T::set_reuse_matrix_structure, "",
+						"whether sparsity pattern and scatter map are reused", "")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name+suffix, name, tag);
 	}
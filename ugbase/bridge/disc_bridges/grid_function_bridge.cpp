@@ -587,6 +587,8 @@ static void Common(Registry& reg, string grp)
 		.add_method("init_levels", &T::init_levels)
 		.add_method("init_surfaces", &T::init_surfaces)
 		.add_method("init_top_surface", &T::init_top_surface)
+		.add_method("set_dof_index_cache", &T::set_dof_index_cache, "", "maxMemory",
+					"Caches element index lists of all dof distributions up to maxMemory bytes each (0 disables)")
 
 		.add_method("clear", &T::clear)
 		.add_method("add_fct", static_cast<void (T::*)(const char*, const char*, int, const char*)>(&T::add),
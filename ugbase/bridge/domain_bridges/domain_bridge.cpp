@@ -51,6 +51,7 @@
 #include "lib_grid/refinement/global_multi_grid_refiner.h"
 #include "lib_grid/algorithms/geom_obj_util/misc_util.h"
 #include "lib_grid/algorithms/grid_statistics.h"
+#include "lib_grid/algorithms/sfc_order_util.h"
 
 #include "lib_grid/algorithms/subset_util.h"
 
@@ -81,6 +82,28 @@ static void MinimizeMemoryFootprint(TDomain& dom)
 							 | GRIDOPT_AUTOGENERATE_SIDES);
 }
 
+///	reorders the elements of the domain along a space filling curve
+/**	Has to be called before approximation spaces are created on the domain.*/
+template <typename TDomain>
+static void OrderDomainBySFC(TDomain& dom)
+{
+	OrderGridBySFC(*dom.grid(), dom.position_accessor(),
+				   dom.subset_handler().get());
+}
+
+///	reorders the elements of the domain along a space filling curve and compacts its object pools
+/**	Has to be called directly after the domain was loaded (see CompactGridBySFC).*/
+template <typename TDomain>
+static void CompactDomainBySFC(TDomain& dom)
+{
+	std::vector<ISubsetHandler*> vSH(1, dom.subset_handler().get());
+	std::vector<std::string> vNames = dom.additional_subset_handler_names();
+	for(size_t i = 0; i < vNames.size(); ++i)
+		vSH.push_back(dom.additional_subset_handler(vNames[i]).get());
+
+	CompactGridBySFC(*dom.grid(), dom.position_accessor(), vSH);
+}
+
 template <typename TDomain>
 static void LoadAndRefineDomain(TDomain& domain, const char* filename,
 								int numRefs)
@@ -515,6 +538,10 @@ static void Domain(Registry& reg, string grp)
 	reg.add_function("TestDomainInterfaces", static_cast<bool (*)(TDomain*, bool)>(&TestDomainInterfaces<TDomain>), grp);
 
 	reg.add_function("MinimizeMemoryFootprint", &MinimizeMemoryFootprint<TDomain>, grp);
+	reg.add_function("OrderDomainBySFC", &OrderDomainBySFC<TDomain>, grp, "", "dom",
+					 "Reorders the elements of the domain along a space filling curve");
+	reg.add_function("CompactDomainBySFC", &CompactDomainBySFC<TDomain>, grp, "", "dom",
+					 "Reorders the elements of the domain along a space filling curve and stores them in that order in memory");
 }
 
 /**
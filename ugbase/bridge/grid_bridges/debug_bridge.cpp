@@ -33,6 +33,8 @@
 #include "grid_bridges.h"
 #include "lib_grid/algorithms/debug_util.h"
 #include "lib_grid/algorithms/problem_detection_util.h"
+#include "lib_grid/algorithms/unit_tests/check_flat_topology.h"
+#include "lib_grid/algorithms/unit_tests/check_grid_object_pools.h"
 
 using namespace std;
 
@@ -54,6 +56,16 @@ void RegisterGridBridge_Debug(Registry& reg, string parentGroup)
 	reg.add_function("CheckForUnconnectedSides", &CheckForUnconnectedSides,
 					 grp, "foundUnconnectedSides", "grid",
 					 "Checks whether unconnected sides exist in the given grid.");
+
+	reg.add_function("CheckFlatTopology", &grid_unit_tests::CheckFlatTopology,
+					 grp, "", "grid",
+					 "Compares the tables of a FlatTopology of the given grid with "
+					 "the associated elements of the grid. Throws on a mismatch.");
+
+	reg.add_function("CheckGridObjectPools", &grid_unit_tests::CheckGridObjectPools,
+					 grp, "", "grid",
+					 "Checks the object pools of grids with a copy of the given grid, "
+					 "including CompactGridBySFC. Throws on failure.");
 }
 
 }//	end of namespace
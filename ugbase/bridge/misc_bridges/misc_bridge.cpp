@@ -39,6 +39,7 @@
 #include "compile_info/compile_info.h"
 #include "common/util/crc32.h"
 #include "common/stopwatch.h"
+#include "common/util/omp_util.h"
 #include "ug.h"
 
 using namespace std;
@@ -206,6 +207,13 @@ bool IsDefinedPROFILE_PCL() { return true; }
 bool IsDefinedPROFILE_PCL() { return false; }
 #endif
 
+// OPENMP:
+#ifdef UG_OPENMP
+bool IsDefinedUG_OPENMP() { return true; }
+#else
+bool IsDefinedUG_OPENMP() { return false; }
+#endif
+
 // ALGEBRA - derived, no output by 'cmake' until now:
 #ifdef UG_ALGEBRA
 bool IsDefinedUG_ALGEBRA() { return true; }
@@ -365,7 +373,7 @@ void PrintBuildConfiguration()
 	UG_LOG(AppendSpacesToString(aux_str,40).append(""));
 
 	aux_str = "";
-	//aux_str.append("?:               ").append( (IsDefinedUG_?() ? "ON " : "OFF") );
+	aux_str.append("OPENMP:            ").append( (IsDefinedUG_OPENMP() ? "ON " : "OFF") );
 	UG_LOG(AppendSpacesToString(aux_str,40).append("\n"));
 	UG_LOG("--------------------------------------------------------------------------------\n");
 }
@@ -530,6 +538,7 @@ void RegisterBridge_Misc(Registry &reg, string parentGroup)
 		ADD_DEFINED_FUNC(BLAS_AVAILABLE);
 		ADD_DEFINED_FUNC(UG_HYPRE);
 		ADD_DEFINED_FUNC(UG_HLIBPRO);
+		ADD_DEFINED_FUNC(UG_OPENMP);
 
 		reg.add_function("PrintBuildConfiguration", &PrintBuildConfiguration, grp, "");
 		reg.add_function("PrintBuildConfigurationExtended", &PrintBuildConfigurationExtended, grp, "");
@@ -554,6 +563,19 @@ void RegisterBridge_Misc(Registry &reg, string parentGroup)
 		reg.add_function("ClearAbortRunFlag", &ClearAbortRunFlag, grp, "", "", "Clear the abort-run-flag.");
 		reg.add_function("TerminateAbortedRun", &TerminateAbortedRun, grp, "", "", "Terminates the current run if AbortRun() has been called before.");
 	}
+
+	{
+		stringstream ss; ss << parentGroup << "/Util/Threads";
+		string grp = ss.str();
+
+		reg.add_function("SetNumThreads", &SetNumThreads, grp, "", "numThreads",
+						 "Sets the number of threads used by threaded kernels (needs OPENMP=ON). Values <= 0 reset to the OpenMP default.");
+		reg.add_function("GetNumThreads", &GetNumThreads, grp, "numThreads", "",
+						 "Returns the number of threads used by threaded kernels (1 if compiled without OPENMP).");
+		reg.add_function("SetMinIndicesPerThread", &SetMinIndicesPerThread, grp, "", "minIndices",
+						 "Loops with less than 2*minIndices indices are not threaded.");
+		reg.add_function("GetMinIndicesPerThread", &GetMinIndicesPerThread, grp, "minIndices");
+	}
 	
 
 }
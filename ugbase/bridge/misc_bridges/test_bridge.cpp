@@ -37,6 +37,9 @@
 #include "bridge/bridge.h"
 #include "bridge/util.h"
 #include "common/util/message_hub.h"
+#include "common/stopwatch.h"
+#include "common/math/misc/math_util.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
 
 #ifdef UG_FOR_LUA
 #include "bindings/lua/lua_function_handle.h"
@@ -414,6 +417,152 @@ void TestPageContainer()
 	UG_LOG("done.\n");
 }
 
+///	returns the maximum relative difference of the entries of two NxN blocks
+template<size_t N, typename TMatrix>
+double SmallBlockDistance(const std::vector<TMatrix>& a, const std::vector<TMatrix>& b)
+{
+	double dist = 0;
+	for(size_t i = 0; i < a.size(); ++i)
+		for(size_t r = 0; r < N; ++r)
+			for(size_t c = 0; c < N; ++c)
+				dist = std::max(dist, fabs(a[i](r, c) - b[i](r, c))
+				                      / std::max(1.0, fabs(a[i](r, c))));
+	return dist;
+}
+
+///	returns the maximum relative difference of the entries of two vectors of size N
+template<size_t N, typename TVector>
+double SmallVectorDistance(const std::vector<TVector>& a, const std::vector<TVector>& b)
+{
+	double dist = 0;
+	for(size_t i = 0; i < a.size(); ++i)
+		for(size_t r = 0; r < N; ++r)
+			dist = std::max(dist, fabs(a[i][r] - b[i][r]) / std::max(1.0, fabs(a[i][r])));
+	return dist;
+}
+
+///	compares the generic DenseMatrix block kernels with the fixed size ones
+/**	Runs MatMultAdd, InverseMatMult and Invert on numBlocks random, diagonally
+ * dominant NxN blocks numRuns times, once through the generic loop templates
+ * and once through the kernels of densematrix_fixed_kernels.h, and prints
+ * the timings. The inverse kernels are only compared for N > 3, since the
+ * smaller sizes use the closed form inverses in both cases.
+ *
+ * Before timing, the results of one application of both paths are compared.
+ * Throws if they differ by more than a relative tolerance of 1e-10.*/
+template<size_t N>
+void BenchmarkSmallBlockKernels(size_t numBlocks, size_t numRuns)
+{
+	typedef FixedArray1<double, N> vector_t;
+	typedef FixedArray2<double, N, N> matrix_t;
+	typedef DenseVector<vector_t> vec_type;
+	typedef DenseMatrix<matrix_t> mat_type;
+
+	const double tol = 1e-10;
+
+	std::vector<mat_type> A(numBlocks), inv(numBlocks), invRef(numBlocks);
+	std::vector<vec_type> w(numBlocks), d(numBlocks), dRef(numBlocks);
+	for(size_t i = 0; i < numBlocks; ++i)
+		for(size_t r = 0; r < N; ++r){
+			w[i][r] = urand(-1.0, 1.0);
+			for(size_t c = 0; c < N; ++c)
+				A[i](r, c) = urand(-1.0, 1.0) + (r == c ? N : 0);
+		}
+
+	Stopwatch sw;
+	double tGeneric, tFixed, dist;
+
+//	block multiply-add, as in the block SpMV: d -= A*w
+	for(size_t i = 0; i < numBlocks; ++i){
+		d[i] = 1.0;
+		dRef[i] = 1.0;
+		MatMultAdd<vector_t, matrix_t>(dRef[i], 1.0, dRef[i], -1.0, A[i], w[i]);
+		MatMultAdd(d[i], 1.0, d[i], -1.0, A[i], w[i]);
+	}
+	dist = SmallVectorDistance<N>(d, dRef);
+	if(dist > tol)
+		UG_THROW("BenchmarkSmallBlockKernels: " << N << "x" << N << " MatMultAdd differs by "
+		         << dist << " from the generic kernel (tolerance: " << tol << ").");
+
+	for(size_t i = 0; i < numBlocks; ++i) d[i] = 0.0;
+	sw.start();
+	for(size_t k = 0; k < numRuns; ++k)
+		for(size_t i = 0; i < numBlocks; ++i)
+			MatMultAdd<vector_t, matrix_t>(d[i], 1.0, d[i], -1.0, A[i], w[i]);
+	tGeneric = sw.ms();
+	sw.start();
+	for(size_t k = 0; k < numRuns; ++k)
+		for(size_t i = 0; i < numBlocks; ++i)
+			MatMultAdd(d[i], 1.0, d[i], -1.0, A[i], w[i]);
+	tFixed = sw.ms();
+	UG_LOG(N << "x" << N << "  MatMultAdd     : " << tGeneric << " ms -> "
+			<< tFixed << " ms (speedup " << tGeneric/tFixed << ")\n");
+
+//	sizes 1..3 use the closed form inverses in both cases
+	if(N <= 3) return;
+
+//	block solve, as in the block GS: d = A^{-1} w
+	for(size_t i = 0; i < numBlocks; ++i){
+		InverseMatMultN<vector_t, matrix_t>(dRef[i], 1.0, A[i], w[i]);
+		InverseMatMult(d[i], 1.0, A[i], w[i]);
+	}
+	dist = SmallVectorDistance<N>(d, dRef);
+	if(dist > tol)
+		UG_THROW("BenchmarkSmallBlockKernels: " << N << "x" << N << " InverseMatMult differs by "
+		         << dist << " from the generic kernel (tolerance: " << tol << ").");
+
+	sw.start();
+	for(size_t k = 0; k < numRuns; ++k)
+		for(size_t i = 0; i < numBlocks; ++i)
+			InverseMatMultN<vector_t, matrix_t>(d[i], 1.0, A[i], w[i]);
+	tGeneric = sw.ms();
+	sw.start();
+	for(size_t k = 0; k < numRuns; ++k)
+		for(size_t i = 0; i < numBlocks; ++i)
+			InverseMatMult(d[i], 1.0, A[i], w[i]);
+	tFixed = sw.ms();
+	UG_LOG(N << "x" << N << "  InverseMatMult : " << tGeneric << " ms -> "
+			<< tFixed << " ms (speedup " << tGeneric/tFixed << ")\n");
+
+//	block inverse, as in the block ILU: inv = A^{-1}
+	for(size_t i = 0; i < numBlocks; ++i){
+		invRef[i] = A[i];
+		InvertNdyn(invRef[i]);
+		inv[i] = A[i];
+		Invert(inv[i]);
+	}
+	dist = SmallBlockDistance<N>(inv, invRef);
+	if(dist > tol)
+		UG_THROW("BenchmarkSmallBlockKernels: " << N << "x" << N << " Invert differs by "
+		         << dist << " from the generic kernel (tolerance: " << tol << ").");
+
+	sw.start();
+	for(size_t k = 0; k < numRuns; ++k)
+		for(size_t i = 0; i < numBlocks; ++i){
+			inv[i] = A[i];
+			InvertNdyn(inv[i]);
+		}
+	tGeneric = sw.ms();
+	sw.start();
+	for(size_t k = 0; k < numRuns; ++k)
+		for(size_t i = 0; i < numBlocks; ++i){
+			inv[i] = A[i];
+			Invert(inv[i]);
+		}
+	tFixed = sw.ms();
+	UG_LOG(N << "x" << N << "  Invert         : " << tGeneric << " ms -> "
+			<< tFixed << " ms (speedup " << tGeneric/tFixed << ")\n");
+}
+
+void BenchmarkSmallBlockKernels(size_t numBlocks, size_t numRuns)
+{
+	BenchmarkSmallBlockKernels<2>(numBlocks, numRuns);
+	BenchmarkSmallBlockKernels<3>(numBlocks, numRuns);
+	BenchmarkSmallBlockKernels<4>(numBlocks, numRuns);
+	BenchmarkSmallBlockKernels<5>(numBlocks, numRuns);
+	BenchmarkSmallBlockKernels<6>(numBlocks, numRuns);
+}
+
 void PostRegisteredFunction()
 {
 	UG_LOG("PostRegisteredFunction successfully executed.\n");
@@ -723,7 +872,10 @@ void RegisterBridge_Test(Registry& reg, string parentGroup)
 			.add_function("StringTest", StringTest, grp)
 			.add_function("StdStringTest", StdStringTest, grp)
 			.add_function("PrintStringTest", PrintStringTest, grp)
-			.add_function("TestPageContainer", TestPageContainer, grp);
+			.add_function("TestPageContainer", TestPageContainer, grp)
+			.add_function("BenchmarkSmallBlockKernels",
+					static_cast<void (*)(size_t, size_t)>(&BenchmarkSmallBlockKernels),
+					grp, "", "numBlocks#numRuns");
 
 		reg.add_class_<SmartTest>("SmartTest", grp)
 			.add_constructor()
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__COMMON__UTIL__OMP_UTIL__
+#define __H__UG__COMMON__UTIL__OMP_UTIL__
+
+#include <cstddef>
+#include <vector>
+
+#ifdef UG_OPENMP
+#include <omp.h>
+#endif
+
+namespace ug{
+
+/// \addtogroup ugbase_common_util
+/// \{
+
+/**
+ * Threaded kernels in ug (e.g. SparseMatrix::axpy) only use threads if ug
+ * was compiled with OPENMP=ON (define UG_OPENMP). Otherwise, all functions
+ * here are valid but always report one thread.
+ *
+ * All threaded kernels split their index range [0, n) with ThreadBlock into
+ * contiguous blocks, so that a thread always works on the same part of a
+ * vector/matrix. Together with a threaded first touch on allocation this
+ * keeps the memory pages local to the NUMA domain of the thread and makes
+ * all results independent of scheduling.
+ */
+
+///	sets the number of threads used by threaded kernels (<= 0 resets to the OpenMP default)
+void SetNumThreads(int numThreads);
+
+///	returns the number of threads used by threaded kernels (1 without UG_OPENMP)
+int GetNumThreads();
+
+///	sets the minimal number of indices per thread for which a kernel is threaded
+void SetMinIndicesPerThread(size_t minIndices);
+
+///	returns the minimal number of indices per thread for which a kernel is threaded
+size_t GetMinIndicesPerThread();
+
+///	returns the number of threads that should be used for a loop over n indices
+inline int NumThreadsFor(size_t n)
+{
+#ifdef UG_OPENMP
+	const size_t maxThreads = n / GetMinIndicesPerThread();
+	if(maxThreads < 2) return 1;
+	const int numThreads = GetNumThreads();
+	if((size_t)numThreads > maxThreads) return (int)maxThreads;
+	return numThreads;
+#else
+	return 1;
+#endif
+}
+
+///	returns the id of the calling thread inside of a parallel region (0 without UG_OPENMP)
+inline int ThreadID()
+{
+#ifdef UG_OPENMP
+	return omp_get_thread_num();
+#else
+	return 0;
+#endif
+}
+
+///	returns the number of threads of the current parallel region (1 without UG_OPENMP)
+inline int NumThreadsInRegion()
+{
+#ifdef UG_OPENMP
+	return omp_get_num_threads();
+#else
+	return 1;
+#endif
+}
+
+/**
+ * computes the contiguous block [begin, end) of the index range [0, n) which
+ * is owned by thread tid of numThreads. The first n % numThreads threads get
+ * one index more than the others.
+ */
+inline void ThreadBlock(size_t n, int tid, int numThreads, size_t &begin, size_t &end)
+{
+	const size_t chunk = n / numThreads;
+	const size_t rest = n % numThreads;
+	const size_t t = (size_t) tid;
+	begin = t*chunk + (t < rest ? t : rest);
+	end = begin + chunk + (t < rest ? 1 : 0);
+}
+
+///	computes the block of [0, n) owned by the calling thread of the current parallel region
+inline void ThreadBlock(size_t n, size_t &begin, size_t &end)
+{
+	ThreadBlock(n, ThreadID(), NumThreadsInRegion(), begin, end);
+}
+
+///	calls op(begin, end) on the blocks of [0, n), threaded if n is large enough
+/**
+ * Each thread of the parallel region processes its ThreadBlock. If n is too
+ * small for threading (\sa NumThreadsFor), op(0, n) is called directly.
+ */
+template <typename TBlockOp>
+inline void ForEachIndexBlock(size_t n, TBlockOp& op)
+{
+#ifdef UG_OPENMP
+	const int numThreads = NumThreadsFor(n);
+	if(numThreads > 1)
+	{
+		#pragma omp parallel num_threads(numThreads)
+		{
+			size_t begin, end;
+			ThreadBlock(n, begin, end);
+			op(begin, end);
+		}
+		return;
+	}
+#endif
+	op(0, n);
+}
+
+///	sums up num values over the blocks of [0, n), threaded if n is large enough
+/**
+ * op(begin, end, partial) has to write num partial sums for the block
+ * [begin, end) to partial. The partial sums of the threads are added in
+ * thread order, i.e. the result is reproducible for a fixed number of threads.
+ */
+template <typename TBlockOp>
+inline void SumOverIndexBlocks(size_t n, TBlockOp& op, size_t num, double* res)
+{
+#ifdef UG_OPENMP
+	const int numThreads = NumThreadsFor(n);
+	if(numThreads > 1)
+	{
+		std::vector<double> vPartial(numThreads * num, 0.0);
+		#pragma omp parallel num_threads(numThreads)
+		{
+			size_t begin, end;
+			ThreadBlock(n, begin, end);
+			op(begin, end, &vPartial[ThreadID() * num]);
+		}
+		for(size_t j = 0; j < num; ++j) res[j] = 0.0;
+		for(int t = 0; t < numThreads; ++t)
+			for(size_t j = 0; j < num; ++j)
+				res[j] += vPartial[t * num + j];
+		return;
+	}
+#endif
+	op(0, n, res);
+}
+
+// end group ugbase_common_util
+/// \}
+
+} // end namespace ug
+
+#endif /* __H__UG__COMMON__UTIL__OMP_UTIL__ */
@@ -32,6 +32,8 @@
 
 #ifndef __H__UG__CPU_ALGEBRA__CORE_SMOOTHERS__
 #define __H__UG__CPU_ALGEBRA__CORE_SMOOTHERS__
+
+#include "level_schedule.h"
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ug
@@ -89,6 +91,17 @@ namespace ug
  */
 
 
+//	fallbacks for matrix types without a fast path for finalized matrices.
+//	For SparseMatrix, see cpu_algebra/sparsematrix_crs_kernels.h.
+template<typename Vector_type>
+inline bool gs_step_LL_finalized(const void *, Vector_type &, const Vector_type &, const number) {return false;}
+template<typename Vector_type>
+inline bool gs_step_UR_finalized(const void *, Vector_type &, const Vector_type &, const number) {return false;}
+template<typename Vector_type>
+inline bool gs_step_multicolor_finalized(const void *, const LevelSchedule &, Vector_type &, const Vector_type &, const number, bool) {return false;}
+template<typename Vector_type>
+inline bool sgs_step_multicolor_finalized(const void *, const LevelSchedule &, Vector_type &, const Vector_type &, const number) {return false;}
+
 /////////////////////////////////////////////////////////////////////////////////////////////
 //	gs_step_LL
 /** \brief Performs a forward gauss-seidel-step, that is, solve on the lower left of A.
@@ -107,6 +120,8 @@ void gs_step_LL(const Matrix_type &A, Vector_type &c, const Vector_type &d, cons
 {
 	// gs LL has preconditioning matrix N = (D-L)^{-1}
 
+	if(gs_step_LL_finalized(&A, c, d, relaxFactor)) return;
+
 	typename Vector_type::value_type s;
 
 	for(size_t i=0; i < c.size(); i++)
@@ -146,6 +161,8 @@ void gs_step_UR(const Matrix_type &A, Vector_type &c, const Vector_type &d, cons
 {
 	// gs UR has preconditioning matrix N = (D-U)^{-1}
 
+	if(gs_step_UR_finalized(&A, c, d, relaxFactor)) return;
+
 	typename Vector_type::value_type s;
 
 	if(c.size() == 0) return;
@@ -200,6 +217,84 @@ void sgs_step(const Matrix_type &A, Vector_type &c, const Vector_type &d, const
 	gs_step_UR(A, c, c, relaxFactor);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	gs_step_multicolor
+/**
+ * \brief Performs a multicolor (forward or backward) gauss-seidel-step.
+ * The rows are processed color by color (in reverse color order for the backward
+ * step). Since the rows of one color are not coupled, this is a gauss-seidel-step
+ * for the matrix permuted by colors, and all rows of a color can be computed
+ * concurrently. For finalized SparseMatrix, the colors are processed with threads.
+ *
+ * \param A Matrix \f$A = D - L - U\f$
+ * \param colors coloring of A \sa LevelSchedule::init_multicolor
+ * \param c will be \f$c = N * d = (D-L)^{-1} * d \f$ (L w.r.t. the color ordering)
+ * \param d the vector d.
+ * \param bBackward if true, the backward step \f$ (D-U)^{-1} \f$ is performed
+ * \sa gs_step_LL, gs_step_UR, sgs_step_multicolor
+ */
+template<typename Matrix_type, typename Vector_type>
+void gs_step_multicolor(const Matrix_type &A, const LevelSchedule &colors,
+                        Vector_type &c, const Vector_type &d,
+                        const number relaxFactor, bool bBackward = false)
+{
+	if(gs_step_multicolor_finalized(&A, colors, c, d, relaxFactor, bBackward)) return;
+
+	UG_COND_THROW(colors.num_rows() != c.size(), "gs_step_multicolor: coloring has "
+	              << colors.num_rows() << " rows, but vector has size " << c.size());
+
+	typename Vector_type::value_type s;
+	const size_t numColors = colors.num_levels();
+	for(size_t cc = 0; cc < numColors; ++cc)
+	{
+		const size_t col = bBackward ? numColors - 1 - cc : cc;
+		for(size_t k = colors.level_begin(col); k < colors.level_end(col); ++k)
+		{
+			const size_t i = colors.rows()[k];
+			s = d[i];
+			for(typename Matrix_type::const_row_iterator it = A.begin_row(i);
+					it != A.end_row(i); ++it)
+			{
+				const size_t cj = colors.level(it.index());
+				if(bBackward ? (cj > col) : (cj < col))
+					// s -= it.value() * c[it.index()];
+					MatMultAdd(s, 1.0, s, -1.0, it.value(), c[it.index()]);
+			}
+
+			// c[i] = relaxFactor * s/A(i,i)
+			InverseMatMult(c[i], relaxFactor, A(i,i), s);
+		}
+	}
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	sgs_step_multicolor
+/**
+ * \brief Performs a multicolor symmetric gauss-seidel step.
+ * \param c will be \f$c = N * d = (D-U)^{-1} D (D-L)^{-1} d \f$ (L, U w.r.t. the color ordering)
+ * \sa sgs_step, gs_step_multicolor
+ */
+template<typename Matrix_type, typename Vector_type>
+void sgs_step_multicolor(const Matrix_type &A, const LevelSchedule &colors,
+                         Vector_type &c, const Vector_type &d, const number relaxFactor)
+{
+	if(sgs_step_multicolor_finalized(&A, colors, c, d, relaxFactor)) return;
+
+	// c1 = (D-L)^{-1} d
+	gs_step_multicolor(A, colors, c, d, relaxFactor, false);
+
+	// c2 = D c1
+	typename Vector_type::value_type s;
+	for(size_t i = 0; i<c.size(); i++)
+	{
+		s=c[i];
+		MatMult(c[i], 1.0, A(i, i), s);
+	}
+
+	// c3 = (D-U)^{-1} c2
+	gs_step_multicolor(A, colors, c, c, relaxFactor, true);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////
 //	diag_step
 /**
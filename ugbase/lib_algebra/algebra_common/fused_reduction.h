@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__FUSED_REDUCTION__
+#define __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__FUSED_REDUCTION__
+
+#include <vector>
+#include "common/error.h"
+#include "common/profiler/profiler.h"
+#include "common/util/omp_util.h"
+#include "lib_algebra/common/operations_vec.h"
+#ifdef UG_PARALLEL
+	#include "pcl/pcl_process_communicator.h"
+	#include "lib_algebra/parallelization/parallel_vector.h"
+#endif
+
+namespace ug{
+
+///	block op of LocalMultiDotprod
+template <typename TVector, typename TVectorPtr>
+struct LocalMultiDotprodBlockOp
+{
+	LocalMultiDotprodBlockOp(const TVector& v_, const TVectorPtr* vW_, size_t num_)
+		: v(v_), vW(vW_), num(num_) {}
+	void operator()(size_t begin, size_t end, double* sum)
+	{
+		for(size_t j = 0; j < num; ++j) sum[j] = 0.0;
+		for(size_t i = begin; i < end; ++i)
+			for(size_t j = 0; j < num; ++j)
+				sum[j] += VecProd(v[i], (*vW[j])[i]);
+	}
+	const TVector& v; const TVectorPtr* vW; const size_t num;
+};
+
+///	computes res[j] = sum_i VecProd(v[i], (*vW[j])[i]) for j < num in one (threaded) pass over v
+template <typename TVector, typename TVectorPtr>
+void LocalMultiDotprod(const TVector& v, const TVectorPtr* vW, size_t num, double* res)
+{
+	LocalMultiDotprodBlockOp<TVector, TVectorPtr> op(v, vW, num);
+	SumOverIndexBlocks(v.size(), op, num, res);
+}
+
+///	local parts of dot products and the global summation for a vector type
+/**
+ * The default implementation is used for vectors without a parallel layout.
+ * Here, the local values are already the global ones.
+ */
+template <typename TVector>
+struct FusedReductionTraits
+{
+	static number local_dotprod(TVector& a, TVector& b)
+	{
+		return a.dotprod(b);
+	}
+
+	static number local_norm2(TVector& a)
+	{
+		const number n = a.norm(); return n*n;
+	}
+
+	static void local_multi_dotprod(TVector& v, TVector* const* vW, size_t num, double* res)
+	{
+		LocalMultiDotprod(v, vW, num, res);
+	}
+
+	struct communicator_type {};
+	struct request_type {};
+
+	static void communicator(const TVector& v, communicator_type& com) {}
+
+	static void start_sum(const communicator_type& com,
+	                      const std::vector<double>& vLocal,
+	                      std::vector<double>& vGlobal, request_type& req)
+	{
+		vGlobal = vLocal;
+	}
+
+	static void finish_sum(request_type& req) {}
+};
+
+#ifdef UG_PARALLEL
+///	local parts of dot products and the global summation for parallel vectors
+/**
+ * The storage types are adjusted as in ParallelVector::dotprod and
+ * ParallelVector::norm, such that the process-local parts can be summed
+ * up. The global sum is performed for all values at once.
+ */
+template <typename T>
+struct FusedReductionTraits<ParallelVector<T> >
+{
+	static number local_dotprod(ParallelVector<T>& a, ParallelVector<T>& b)
+	{
+		ParallelVector<T>* pB = &b;
+		double res;
+		local_multi_dotprod(a, &pB, 1, &res);
+		return res;
+	}
+
+	static number local_norm2(ParallelVector<T>& a)
+	{
+		if(!a.change_storage_type(PST_UNIQUE))
+			UG_THROW("FusedReduction: Cannot change storage type to unique.");
+		const number n = static_cast<const T&>(a).norm();
+		return n*n;
+	}
+
+	static void local_multi_dotprod(ParallelVector<T>& v, ParallelVector<T>* const* vW,
+	                                size_t num, double* res)
+	{
+		if(v.has_storage_type(PST_UNDEFINED))
+			UG_THROW("FusedReduction: No parallel storage type given.");
+
+	//	a consistent v can be used as it is, if all w are additive. Otherwise
+	//	v is made unique and all w must be unique or consistent. Consistent
+	//	to unique needs no communication.
+		bool bConsistentV = v.has_storage_type(PST_CONSISTENT);
+		for(size_t j = 0; j < num && bConsistentV; ++j)
+			if(vW[j] == &v && !v.has_storage_type(PST_ADDITIVE))
+				bConsistentV = false;
+
+		if(!bConsistentV && !v.change_storage_type(PST_UNIQUE))
+			UG_THROW("FusedReduction: Cannot change storage type to unique.");
+
+		for(size_t j = 0; j < num; ++j)
+		{
+			ParallelVector<T>& w = *vW[j];
+			if(w.has_storage_type(PST_UNDEFINED))
+				UG_THROW("FusedReduction: No parallel storage type given.");
+			if(bConsistentV ? w.has_storage_type(PST_ADDITIVE)
+			                : (w.has_storage_type(PST_UNIQUE) || w.has_storage_type(PST_CONSISTENT)))
+				continue;
+			if(!w.change_storage_type(PST_UNIQUE))
+				UG_THROW("FusedReduction: Cannot change storage type to unique.");
+		}
+
+		LocalMultiDotprod(v, vW, num, res);
+	}
+
+	typedef pcl::ProcessCommunicator communicator_type;
+	typedef pcl::Request request_type;
+
+	static void communicator(const ParallelVector<T>& v, communicator_type& com)
+	{
+		com = v.layouts()->proc_comm();
+	}
+
+	static void start_sum(const communicator_type& com,
+	                      const std::vector<double>& vLocal,
+	                      std::vector<double>& vGlobal, request_type& req)
+	{
+		if(com.empty() || vLocal.empty()) {vGlobal = vLocal; return;}
+		vGlobal.resize(vLocal.size());
+		com.iallreduce(&vLocal[0], &vGlobal[0], (int)vLocal.size(),
+		               PCL_DT_DOUBLE, PCL_RO_SUM, req);
+	}
+
+	static void finish_sum(request_type& req)
+	{
+		req.wait();
+	}
+};
+#endif
+
+///	collects several dot products and norms and sums them in one reduction
+/**
+ * Krylov methods usually need several inner products per iteration, each of
+ * them requiring a global reduction in parallel. This class collects the
+ * process-local contributions of several inner products and sums them up
+ * with a single reduction.
+ *
+ * Usage:
+ * <pre>
+ * 	FusedReduction<vector_type> red;
+ * 	const size_t iGamma = red.add_dotprod(r, u);
+ * 	const size_t iNorm = red.add_norm2(r);
+ * 	red.start();
+ * 	// ... work not depending on the reduced values, e.g. SpMV ...
+ * 	red.finish();
+ * 	number gamma = red.value(iGamma);
+ * </pre>
+ *
+ * Several dot products with the same vector should be added with
+ * add_dotprods, which computes them in one pass over the vectors.
+ *
+ * The local contributions are computed when added. The work between
+ * start() and finish() may change the added vectors. In parallel, start()
+ * begins a non-blocking allreduce (pcl::ProcessCommunicator::iallreduce),
+ * which finish() waits for. Thus, the reduction is hidden behind the work
+ * in between. Instances can't be copied.
+ */
+template <typename TVector>
+class FusedReduction
+{
+	typedef FusedReductionTraits<TVector> traits;
+	typedef typename traits::communicator_type communicator_type;
+	typedef typename traits::request_type request_type;
+
+	public:
+		FusedReduction() : m_bStarted(false), m_bFinished(false) {}
+
+	///	removes all values
+		void clear()
+		{
+			if(m_bStarted && !m_bFinished) traits::finish_sum(m_request);
+			m_vLocal.clear(); m_vGlobal.clear();
+			m_bStarted = false; m_bFinished = false;
+		}
+
+	///	adds the local part of (a,b), returns the index of the value
+	/**
+	 * The storage types of the vectors may be changed as in dotprod.
+	 */
+		size_t add_dotprod(TVector& a, TVector& b)
+		{
+			UG_COND_THROW(m_bStarted, "FusedReduction: Reduction already started.");
+			if(m_vLocal.empty()) traits::communicator(a, m_com);
+			m_vLocal.push_back(traits::local_dotprod(a, b));
+			return m_vLocal.size() - 1;
+		}
+
+	///	adds the local parts of (v,*vW[0]), ..., (v,*vW[n-1])
+	/**
+	 * The products are computed in one pass over the vectors. Returns the
+	 * index of (v,*vW[0]), the other values follow consecutively. vW may
+	 * contain v itself, giving ||v||^2. The storage types of the vectors may
+	 * be changed.
+	 */
+		size_t add_dotprods(TVector& v, const std::vector<TVector*>& vW)
+		{
+			UG_COND_THROW(m_bStarted, "FusedReduction: Reduction already started.");
+			if(m_vLocal.empty()) traits::communicator(v, m_com);
+			const size_t first = m_vLocal.size();
+			m_vLocal.resize(first + vW.size());
+			if(!vW.empty())
+				traits::local_multi_dotprod(v, &vW[0], vW.size(), &m_vLocal[first]);
+			return first;
+		}
+
+	///	adds the local part of ||a||^2, returns the index of the value
+	/**
+	 * The vector is changed to unique storage type.
+	 */
+		size_t add_norm2(TVector& a)
+		{
+			UG_COND_THROW(m_bStarted, "FusedReduction: Reduction already started.");
+			if(m_vLocal.empty()) traits::communicator(a, m_com);
+			m_vLocal.push_back(traits::local_norm2(a));
+			return m_vLocal.size() - 1;
+		}
+
+	///	starts the global summation of all added values
+		void start()
+		{
+			PROFILE_BEGIN_GROUP(FusedReduction_start, "algebra parallelization");
+			UG_COND_THROW(m_bStarted, "FusedReduction: Reduction already started.");
+			m_bStarted = true;
+			traits::start_sum(m_com, m_vLocal, m_vGlobal, m_request);
+		}
+
+	///	waits for the global summation to complete
+		void finish()
+		{
+			UG_COND_THROW(!m_bStarted, "FusedReduction: Reduction not started.");
+			if(m_bFinished) return;
+			PROFILE_BEGIN_GROUP(FusedReduction_finish, "algebra parallelization");
+			traits::finish_sum(m_request);
+			m_bFinished = true;
+		}
+
+	///	returns the globally summed value with index i
+		number value(size_t i) const
+		{
+			UG_COND_THROW(!m_bFinished, "FusedReduction: Reduction not finished.");
+			UG_ASSERT(i < m_vGlobal.size(), "FusedReduction: invalid index " << i);
+			return m_vGlobal[i];
+		}
+
+	///	number of added values
+		size_t size() const {return m_vLocal.size();}
+
+	protected:
+		communicator_type m_com;
+		std::vector<double> m_vLocal;
+		std::vector<double> m_vGlobal;
+		bool m_bStarted;
+		bool m_bFinished;
+
+	///	pending reduction, declared last to be completed before the buffers are freed
+		request_type m_request;
+
+	private:
+		FusedReduction(const FusedReduction&);
+		FusedReduction& operator=(const FusedReduction&);
+};
+
+///	computes the dot products (v,*vW[j]) with one pass over the vectors and one reduction
+/**
+ * vRes[j] = (v,*vW[j]). The storage types of the vectors may be changed.
+ * \sa FusedReduction::add_dotprods
+ */
+template <typename TVector>
+void MultiDotprod(TVector& v, const std::vector<TVector*>& vW, std::vector<number>& vRes)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	FusedReduction<TVector> red;
+	const size_t first = red.add_dotprods(v, vW);
+	red.start();
+	red.finish();
+	vRes.resize(vW.size());
+	for(size_t j = 0; j < vW.size(); ++j)
+		vRes[j] = red.value(first + j);
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__FUSED_REDUCTION__ */
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULE__
+#define __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULE__
+
+#include <vector>
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+/**
+ * Dependency levels of a triangular sweep over the rows of a sparse matrix.
+ *
+ * For a forward sweep (e.g. solving with L or ILU(0) factorization), row i
+ * depends on all rows j < i with A(i,j) != 0. The level of row i is one more
+ * than the largest level of these rows, i.e. all rows of one level only
+ * depend on rows of smaller levels and can be processed concurrently.
+ * For a backward sweep (solving with U), row i depends on the rows j > i.
+ *
+ * The rows of level l are rows()[level_begin(l)] ... rows()[level_end(l)-1],
+ * sorted ascending for forward and descending for backward sweeps.
+ *
+ * A multicolor schedule (init_multicolor) groups the rows into colors, such
+ * that no two rows of one color are coupled. Here, the levels are the colors
+ * and every color only depends on the values of the other colors, e.g. in a
+ * multicolor Gauss-Seidel sweep.
+ *
+ * The schedule only depends on the sparsity pattern and has to be
+ * recomputed if the pattern changes.
+ */
+class LevelSchedule
+{
+	public:
+	///	constructor
+		LevelSchedule() : m_vLevelStart(1, 0) {}
+
+	///	computes the levels of a forward sweep (dependencies A(i,j), j < i)
+		template <typename TMatrix>
+		void init_lower(const TMatrix& A)
+		{
+			PROFILE_FUNC_GROUP("algebra");
+			const size_t n = A.num_rows();
+			std::vector<size_t> vLevel(n, 0);
+			for(size_t i = 0; i < n; ++i)
+				for(typename TMatrix::const_row_iterator it = A.begin_row(i);
+						it != A.end_row(i); ++it)
+					if(it.index() < i && vLevel[it.index()] + 1 > vLevel[i])
+						vLevel[i] = vLevel[it.index()] + 1;
+
+			create(vLevel, false);
+		}
+
+	///	computes the levels of a backward sweep (dependencies A(i,j), j > i)
+		template <typename TMatrix>
+		void init_upper(const TMatrix& A)
+		{
+			PROFILE_FUNC_GROUP("algebra");
+			const size_t n = A.num_rows();
+			std::vector<size_t> vLevel(n, 0);
+			for(size_t i = n; i-- != 0; )
+				for(typename TMatrix::const_row_iterator it = A.begin_row(i);
+						it != A.end_row(i); ++it)
+					if(it.index() > i && it.index() < n
+						&& vLevel[it.index()] + 1 > vLevel[i])
+						vLevel[i] = vLevel[it.index()] + 1;
+
+			create(vLevel, true);
+		}
+
+	///	computes a greedy coloring with A(i,j) = A(j,i) = 0 for all rows i != j of a color
+		template <typename TMatrix>
+		void init_multicolor(const TMatrix& A)
+		{
+			PROFILE_FUNC_GROUP("algebra");
+			const size_t n = A.num_rows();
+			const size_t none = (size_t) -1;
+
+		//	transposed pattern, to respect couplings in both directions
+			std::vector<size_t> vTStart(n + 1, 0), vTRow;
+			for(size_t i = 0; i < n; ++i)
+				for(typename TMatrix::const_row_iterator it = A.begin_row(i);
+						it != A.end_row(i); ++it)
+					if(it.index() != i && it.index() < n) ++vTStart[it.index() + 1];
+			for(size_t i = 0; i < n; ++i) vTStart[i+1] += vTStart[i];
+			vTRow.resize(vTStart[n]);
+			std::vector<size_t> vPos(vTStart.begin(), vTStart.end() - 1);
+			for(size_t i = 0; i < n; ++i)
+				for(typename TMatrix::const_row_iterator it = A.begin_row(i);
+						it != A.end_row(i); ++it)
+					if(it.index() != i && it.index() < n) vTRow[vPos[it.index()]++] = i;
+
+		//	smallest color not used by a neighbor (vMark[c] == i: c used)
+			std::vector<size_t> vColor(n, none), vMark;
+			for(size_t i = 0; i < n; ++i)
+			{
+				for(typename TMatrix::const_row_iterator it = A.begin_row(i);
+						it != A.end_row(i); ++it)
+					if(it.index() < n && vColor[it.index()] != none)
+						vMark[vColor[it.index()]] = i;
+				for(size_t k = vTStart[i]; k < vTStart[i+1]; ++k)
+					if(vColor[vTRow[k]] != none)
+						vMark[vColor[vTRow[k]]] = i;
+
+				size_t c = 0;
+				while(c < vMark.size() && vMark[c] == i) ++c;
+				if(c == vMark.size()) vMark.push_back(none);
+				vColor[i] = c;
+			}
+
+			create(vColor, false);
+		}
+
+	///	removes the schedule
+		void clear() {m_vLevelStart.assign(1, 0); m_vRow.clear(); m_vLevel.clear();}
+
+	///	number of rows in the schedule
+		size_t num_rows() const {return m_vRow.size();}
+
+	///	number of levels (i.e. the depth of the dependency graph)
+		size_t num_levels() const {return m_vLevelStart.size() - 1;}
+
+	///	position of the first row of level l in rows()
+		size_t level_begin(size_t l) const {return m_vLevelStart[l];}
+
+	///	position after the last row of level l in rows()
+		size_t level_end(size_t l) const {return m_vLevelStart[l+1];}
+
+	///	rows sorted by level
+		const size_t* rows() const {return m_vRow.empty() ? NULL : &m_vRow[0];}
+
+	///	level (or color) of row i
+		size_t level(size_t i) const {return m_vLevel[i];}
+
+	///	levels (or colors) of all rows
+		const size_t* levels() const {return m_vLevel.empty() ? NULL : &m_vLevel[0];}
+
+	///	average number of rows per level
+		double average_level_size() const
+		{
+			if(num_levels() == 0) return 0.0;
+			return (double)num_rows() / (double)num_levels();
+		}
+
+	protected:
+	///	sorts the rows by level (bucket sort, stable in sweep direction)
+		void create(const std::vector<size_t>& vLevel, bool bBackward)
+		{
+			const size_t n = vLevel.size();
+			size_t numLevel = 0;
+			for(size_t i = 0; i < n; ++i)
+				if(vLevel[i] + 1 > numLevel) numLevel = vLevel[i] + 1;
+
+			m_vLevelStart.assign(numLevel + 1, 0);
+			for(size_t i = 0; i < n; ++i)
+				++m_vLevelStart[vLevel[i] + 1];
+			for(size_t l = 0; l < numLevel; ++l)
+				m_vLevelStart[l+1] += m_vLevelStart[l];
+
+			std::vector<size_t> vPos(m_vLevelStart.begin(), m_vLevelStart.end() - 1);
+			m_vRow.resize(n);
+			for(size_t k = 0; k < n; ++k)
+			{
+				const size_t i = bBackward ? n - 1 - k : k;
+				m_vRow[vPos[vLevel[i]]++] = i;
+			}
+			m_vLevel = vLevel;
+		}
+
+	protected:
+	///	start of each level in m_vRow (size num_levels() + 1)
+		std::vector<size_t> m_vLevelStart;
+
+	///	rows sorted by level
+		std::vector<size_t> m_vRow;
+
+	///	level of each row
+		std::vector<size_t> m_vLevel;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULE__ */
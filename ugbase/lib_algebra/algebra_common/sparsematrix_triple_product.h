@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__SPARSEMATRIX_TRIPLE_PRODUCT__
+#define __H__UG__LIB_ALGEBRA__SPARSEMATRIX_TRIPLE_PRODUCT__
+
+#include <vector>
+#include <algorithm>
+#include "common/common.h"
+#include "common/profiler/profiler.h"
+#include "common/util/omp_util.h"
+#include "../small_algebra/small_algebra.h"
+
+namespace ug
+{
+
+/// \addtogroup lib_algebra
+///	@{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SparseTripleProduct:
+//-------------------------
+/**
+ * \brief Calculates M = A*B*C (e.g. a Galerkin product R*A*P) in a symbolic
+ * and a numeric phase.
+ *
+ * CreateAsMultiplyOf(M, A, B, C) and AddMultiplyOf(M, A, B, C) compute the
+ * sparsity pattern of M together with the values on every call. If the
+ * product has to be recomputed for matrices with an unchanged pattern (e.g.
+ * in each Newton step of a multigrid with galerkin coarse grid operators),
+ * most of this work is redundant.
+ *
+ * This class splits the computation:
+ * - In the symbolic phase, the pattern of A*B*C is computed and inserted
+ * 	into M (existing entries of M are kept). M is finalized afterwards.
+ * 	Note that the pattern is structural, i.e. connections with value zero
+ * 	are not dropped.
+ * - In the numeric phase (add_to, assign_to), the products are computed from
+ * 	the CRS arrays of the finalized matrices A, B, C and added directly to the
+ * 	value slots of M. The rows of M are computed threaded if openmp is
+ * 	enabled.
+ *
+ * No copies of A, B, C or of the product are stored. Instead, the symbolic
+ * phase is reused as long as A, B, C and M are the same, finalized matrices
+ * with unchanged sparsity pattern (see SparseMatrix::pattern_revision).
+ * Otherwise it is redone automatically, i.e. the numeric phase always
+ * computes the correct product. Factors which are not finalized are copied
+ * into temporary finalized matrices, the symbolic phase is redone then.
+ */
+template<typename ABC_type, typename A_type = ABC_type,
+		 typename B_type = ABC_type, typename C_type = ABC_type>
+class SparseTripleProduct
+{
+	public:
+		typedef typename ABC_type::value_type value_type;
+		typedef typename ABC_type::connection connection;
+
+	public:
+		SparseTripleProduct() : m_bValid(false), m_numSymbolic(0) {}
+
+	///	symbolic phase: inserts the pattern of A*B*C into M and finalizes M
+	/**	A, B and C must be finalized.*/
+		void init(ABC_type& M, const A_type& A, const B_type& B, const C_type& C);
+
+	///	returns if a symbolic phase has been performed
+		bool valid() const {return m_bValid;}
+
+	///	forces the next numeric phase to redo the symbolic phase
+		void invalidate() {m_bValid = false;}
+
+	///	returns how often the symbolic phase has been performed
+		size_t num_symbolic() const {return m_numSymbolic;}
+
+	///	numeric phase: M += A*B*C
+		void add_to(ABC_type& M, const A_type& A, const B_type& B, const C_type& C);
+
+	///	numeric phase: M = A*B*C
+		void assign_to(ABC_type& M, const A_type& A, const B_type& B, const C_type& C);
+
+	protected:
+	///	identifies a finalized matrix together with its sparsity pattern
+		struct PatternID
+		{
+			PatternID() : pMat(NULL), revision(0), numRows(0), numCols(0) {}
+
+			template <typename TMatrix>
+			void set(const TMatrix& A)
+			{
+				pMat = &A; revision = A.pattern_revision();
+				numRows = A.num_rows(); numCols = A.num_cols();
+			}
+
+			template <typename TMatrix>
+			bool matches(const TMatrix& A) const
+			{
+				return pMat == &A && A.is_finalized() && revision == A.pattern_revision()
+						&& numRows == A.num_rows() && numCols == A.num_cols();
+			}
+
+			const void* pMat;
+			size_t revision;
+			size_t numRows, numCols;
+		};
+
+	///	returns if the symbolic phase can be reused for the given matrices
+		bool symbolic_valid(const ABC_type& M, const A_type& A,
+		                    const B_type& B, const C_type& C) const;
+
+	///	numeric phase on finalized factors
+		void compute(ABC_type& M, const A_type& A, const B_type& B, const C_type& C);
+
+	///	adds the values of A*B*C for a block of rows to the value slots of M
+		struct NumericRowOp
+		{
+			NumericRowOp(ABC_type& M, const A_type& A, const B_type& B, const C_type& C)
+				: m_M(M), m_A(A), m_B(B), m_C(C) {}
+			void operator()(size_t begin, size_t end);
+			ABC_type& m_M;
+			const A_type& m_A;
+			const B_type& m_B;
+			const C_type& m_C;
+		};
+
+	protected:
+	///	flag if symbolic phase has been performed
+		bool m_bValid;
+
+	///	number of symbolic phases performed
+		size_t m_numSymbolic;
+
+	///	factors and product of the last symbolic phase
+		PatternID m_idA, m_idB, m_idC, m_idM;
+};
+
+// end group lib_algebra
+/// \}
+
+} // end namespace ug
+
+#include "sparsematrix_triple_product_impl.h"
+
+#endif /* __H__UG__LIB_ALGEBRA__SPARSEMATRIX_TRIPLE_PRODUCT__ */
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__SPARSEMATRIX_TRIPLE_PRODUCT_IMPL__
+#define __H__UG__LIB_ALGEBRA__SPARSEMATRIX_TRIPLE_PRODUCT_IMPL__
+
+#include "sparsematrix_triple_product.h"
+
+namespace ug
+{
+
+template<typename ABC_type, typename A_type, typename B_type, typename C_type>
+void SparseTripleProduct<ABC_type, A_type, B_type, C_type>::
+init(ABC_type& M, const A_type& A, const B_type& B, const C_type& C)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	UG_COND_THROW(C.num_rows() != B.num_cols() || B.num_rows() != A.num_cols(),
+	              "SparseTripleProduct: sizes mismatch: A is "<<A.num_rows()<<" x "
+	              <<A.num_cols()<<", B is "<<B.num_rows()<<" x "<<B.num_cols()
+	              <<", C is "<<C.num_rows()<<" x "<<C.num_cols());
+	UG_COND_THROW(M.num_rows() != A.num_rows() || M.num_cols() != C.num_cols(),
+	              "SparseTripleProduct: M is "<<M.num_rows()<<" x "<<M.num_cols()
+	              <<", but A*B*C is "<<A.num_rows()<<" x "<<C.num_cols());
+	UG_COND_THROW(!A.is_finalized() || !B.is_finalized() || !C.is_finalized(),
+	              "SparseTripleProduct: the factors have to be finalized.");
+
+	const int* aRow = A.crs_row_start();
+	const int* aCol = A.crs_cols();
+	const int* bRow = B.crs_row_start();
+	const int* bCol = B.crs_cols();
+	const int* cRow = C.crs_row_start();
+	const int* cCol = C.crs_cols();
+
+//	compute pattern of M_{ij} = \sum_kl A_{ik} * B_{kl} * C_{lj} and add it
+//	to M with zero values. marker[j] == i iff column j is already in row i
+	const size_t numRows = A.num_rows();
+	const size_t invalid = (size_t)-1;
+	std::vector<size_t> vMarker(C.num_cols(), invalid);
+	std::vector<connection> vRow;
+
+	for(size_t i = 0; i < numRows; ++i)
+	{
+		vRow.clear();
+		for(int ik = aRow[i]; ik < aRow[i+1]; ++ik)
+		{
+			const size_t k = aCol[ik];
+			for(int kl = bRow[k]; kl < bRow[k+1]; ++kl)
+			{
+				const size_t l = bCol[kl];
+				for(int lj = cRow[l]; lj < cRow[l+1]; ++lj)
+				{
+					const size_t j = cCol[lj];
+					if(vMarker[j] == i) continue;
+					vMarker[j] = i;
+					connection c;
+					c.iIndex = j;
+					c.dValue = 0.0;
+					vRow.push_back(c);
+				}
+			}
+		}
+		if(vRow.empty()) continue;
+		std::sort(vRow.begin(), vRow.end());
+		M.add_matrix_row(i, &vRow[0], vRow.size());
+	}
+
+//	the products are added to the value slots of the finalized M
+	M.finalize();
+
+	m_idA.set(A);
+	m_idB.set(B);
+	m_idC.set(C);
+	m_idM.set(M);
+	m_bValid = true;
+	++m_numSymbolic;
+}
+
+template<typename ABC_type, typename A_type, typename B_type, typename C_type>
+bool SparseTripleProduct<ABC_type, A_type, B_type, C_type>::
+symbolic_valid(const ABC_type& M, const A_type& A, const B_type& B, const C_type& C) const
+{
+	return m_bValid && m_idA.matches(A) && m_idB.matches(B)
+			&& m_idC.matches(C) && m_idM.matches(M);
+}
+
+template<typename ABC_type, typename A_type, typename B_type, typename C_type>
+void SparseTripleProduct<ABC_type, A_type, B_type, C_type>::
+NumericRowOp::operator()(size_t begin, size_t end)
+{
+	const int* aRow = m_A.crs_row_start();
+	const int* aCol = m_A.crs_cols();
+	const typename A_type::value_type* aVal = m_A.crs_values();
+	const int* bRow = m_B.crs_row_start();
+	const int* bCol = m_B.crs_cols();
+	const typename B_type::value_type* bVal = m_B.crs_values();
+	const int* cRow = m_C.crs_row_start();
+	const int* cCol = m_C.crs_cols();
+	const typename C_type::value_type* cVal = m_C.crs_values();
+	const int* mRow = m_M.crs_row_start();
+	const int* mCol = m_M.crs_cols();
+	value_type* mVal = m_M.crs_values();
+
+	typename block_multiply_traits<typename A_type::value_type,
+								   typename B_type::value_type>::ReturnType ab;
+
+//	value slot of column j in the current row of M (only valid for the
+//	columns of the current row, that are set before use)
+	std::vector<size_t> vPos(m_M.num_cols());
+
+	for(size_t i = begin; i < end; ++i)
+	{
+		for(int s = mRow[i]; s < mRow[i+1]; ++s)
+			vPos[mCol[s]] = s;
+
+		for(int ik = aRow[i]; ik < aRow[i+1]; ++ik)
+		{
+			const typename A_type::value_type& a = aVal[ik];
+			if(a == 0.0) continue;
+
+			const size_t k = aCol[ik];
+			for(int kl = bRow[k]; kl < bRow[k+1]; ++kl)
+			{
+				const typename B_type::value_type& b = bVal[kl];
+				if(b == 0.0) continue;
+
+				// ab = A_{ik} * B_{kl}
+				AssignMult(ab, a, b);
+
+				const size_t l = bCol[kl];
+				for(int lj = cRow[l]; lj < cRow[l+1]; ++lj)
+					AddMult(mVal[vPos[cCol[lj]]], ab, cVal[lj]);
+			}
+		}
+	}
+}
+
+template<typename ABC_type, typename A_type, typename B_type, typename C_type>
+void SparseTripleProduct<ABC_type, A_type, B_type, C_type>::
+compute(ABC_type& M, const A_type& A, const B_type& B, const C_type& C)
+{
+	NumericRowOp op(M, A, B, C);
+	ForEachIndexBlock(A.num_rows(), op);
+}
+
+template<typename ABC_type, typename A_type, typename B_type, typename C_type>
+void SparseTripleProduct<ABC_type, A_type, B_type, C_type>::
+add_to(ABC_type& M, const A_type& A, const B_type& B, const C_type& C)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	if(M.num_rows() != A.num_rows())
+		UG_THROW("SparseTripleProduct: row sizes mismatch: M.num_rows = "<<
+		         M.num_rows()<<", A.num_rows = "<<A.num_rows());
+	if(M.num_cols() != C.num_cols())
+		UG_THROW("SparseTripleProduct: column sizes mismatch: M.num_cols = "<<
+		         M.num_cols()<<", C.num_cols = "<<C.num_cols());
+
+	if(A.is_finalized() && B.is_finalized() && C.is_finalized())
+	{
+		if(!symbolic_valid(M, A, B, C))
+			init(M, A, B, C);
+		compute(M, A, B, C);
+		return;
+	}
+
+//	use temporary finalized copies of the factors, which are not finalized
+	A_type tmpA; B_type tmpB; C_type tmpC;
+	const A_type* pA = &A;
+	const B_type* pB = &B;
+	const C_type* pC = &C;
+	if(!A.is_finalized()) {tmpA = A; tmpA.finalize(); pA = &tmpA;}
+	if(!B.is_finalized()) {tmpB = B; tmpB.finalize(); pB = &tmpB;}
+	if(!C.is_finalized()) {tmpC = C; tmpC.finalize(); pC = &tmpC;}
+
+	init(M, *pA, *pB, *pC);
+	compute(M, *pA, *pB, *pC);
+
+//	the temporary copies are released
+	invalidate();
+}
+
+template<typename ABC_type, typename A_type, typename B_type, typename C_type>
+void SparseTripleProduct<ABC_type, A_type, B_type, C_type>::
+assign_to(ABC_type& M, const A_type& A, const B_type& B, const C_type& C)
+{
+//	keep the pattern of M if the symbolic phase can be reused
+	if(symbolic_valid(M, A, B, C))
+		M.set(0.0);
+	else
+		M.resize_and_clear(A.num_rows(), C.num_cols());
+	add_to(M, A, B, C);
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__SPARSEMATRIX_TRIPLE_PRODUCT_IMPL__ */
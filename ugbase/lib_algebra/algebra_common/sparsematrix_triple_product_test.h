@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__SPARSEMATRIX_TRIPLE_PRODUCT_TEST__
+#define __H__UG__LIB_ALGEBRA__SPARSEMATRIX_TRIPLE_PRODUCT_TEST__
+
+#include <algorithm>
+#include "common/error.h"
+#include "common/log.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+#include "sparsematrix_util.h"
+#include "sparsematrix_triple_product.h"
+#include "sparsematrix_triple_product_impl.h"
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+#endif
+
+namespace ug{
+
+///	returns the (local) maximum of the blockwise distance of two matrices
+/**	Entries missing in one of the matrices are treated as zero.*/
+template <typename TMatrix>
+number TripleProductTestDistance(const TMatrix& M, const TMatrix& Ref)
+{
+	UG_COND_THROW(M.num_rows() != Ref.num_rows() || M.num_cols() != Ref.num_cols(),
+	              "TestSparseTripleProduct: sizes of the products do not match.");
+
+	number dist = 0;
+	for(size_t r = 0; r < M.num_rows(); ++r)
+	{
+		for(typename TMatrix::const_row_iterator it = M.begin_row(r); it != M.end_row(r); ++it)
+		{
+			typename TMatrix::value_type t = it.value();
+			t -= Ref(r, it.index());
+			dist = std::max(dist, (number)BlockNorm(t));
+		}
+		for(typename TMatrix::const_row_iterator it = Ref.begin_row(r); it != Ref.end_row(r); ++it)
+		{
+			typename TMatrix::value_type t = it.value();
+			t -= M(r, it.index());
+			dist = std::max(dist, (number)BlockNorm(t));
+		}
+	}
+	return dist;
+}
+
+///	returns the (local) maximum of the block norms of the entries of a matrix
+template <typename TMatrix>
+number TripleProductTestMaxNorm(const TMatrix& M)
+{
+	number norm = 0;
+	for(size_t r = 0; r < M.num_rows(); ++r)
+		for(typename TMatrix::const_row_iterator it = M.begin_row(r); it != M.end_row(r); ++it)
+			norm = std::max(norm, (number)BlockNorm(it.value()));
+	return norm;
+}
+
+///	computes Ref = R*A*P with AddMultiplyOf
+template <typename TMatrix>
+void TripleProductTestReference(TMatrix& Ref, const TMatrix& R, const TMatrix& A, const TMatrix& P)
+{
+	Ref.resize_and_clear(R.num_rows(), P.num_cols());
+	AddMultiplyOf(Ref, R, A, P);
+}
+
+///	compares SparseTripleProduct with AddMultiplyOf
+/**
+ * Computes the (local) product A*A*A of the matrix of the operator with
+ * SparseTripleProduct and compares it to the product computed by
+ * AddMultiplyOf, on the union of both patterns. This is done
+ * - for the initial matrix (one symbolic phase),
+ * - after changing the values of A in place (the symbolic phase must be
+ * 	reused),
+ * - after adding a connection to A (the symbolic phase must be redone).
+ *
+ * Throws if a product differs by more than tol (relative to the largest entry
+ * of the reference products, if it is larger than 1) or if the symbolic phase
+ * is not performed as expected.
+ *
+ * \param[in]	spOp	matrix operator
+ * \param[in]	tol		relative tolerance
+ */
+template <typename TAlgebra>
+void TestSparseTripleProduct(SmartPtr<MatrixOperator<typename TAlgebra::matrix_type,
+                                                     typename TAlgebra::vector_type> > spOp,
+                             number tol)
+{
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef typename matrix_type::value_type value_type;
+
+	matrix_type R, A, P;
+	R = spOp->get_matrix(); R.finalize();
+	A = R; A.finalize();
+	P = R; P.finalize();
+	UG_COND_THROW(A.num_rows() != A.num_cols() || A.num_rows() == 0,
+	              "TestSparseTripleProduct: a non-empty, square matrix is needed.");
+
+	SparseTripleProduct<matrix_type> tp;
+	matrix_type M, Ref;
+
+//	initial product
+	tp.assign_to(M, R, A, P);
+	TripleProductTestReference(Ref, R, A, P);
+	number scale = TripleProductTestMaxNorm(Ref);
+	number errInit = TripleProductTestDistance(M, Ref);
+	UG_COND_THROW(tp.num_symbolic() != 1,
+	              "TestSparseTripleProduct: expected one symbolic phase, got " << tp.num_symbolic());
+
+//	same pattern, new values: the symbolic phase must be reused
+	A.scale(2.0);
+	tp.assign_to(M, R, A, P);
+	TripleProductTestReference(Ref, R, A, P);
+	scale = std::max(scale, TripleProductTestMaxNorm(Ref));
+	number errValues = TripleProductTestDistance(M, Ref);
+	UG_COND_THROW(tp.num_symbolic() != 1,
+	              "TestSparseTripleProduct: symbolic phase not reused for an unchanged pattern.");
+
+//	new connection in A: the symbolic phase must be redone
+	size_t r = 0, c = 0;
+	for(r = 0; r < A.num_rows(); ++r)
+	{
+		for(c = 0; c < A.num_cols(); ++c)
+			if(!A.has_connection(r, c)) break;
+		if(c < A.num_cols()) break;
+	}
+	number errPattern = 0;
+	if(r < A.num_rows())
+	{
+		const value_type v = const_cast<const matrix_type&>(A)(r, r);
+		A(r, c) = v;
+		A.finalize();
+		tp.assign_to(M, R, A, P);
+		TripleProductTestReference(Ref, R, A, P);
+		scale = std::max(scale, TripleProductTestMaxNorm(Ref));
+		errPattern = TripleProductTestDistance(M, Ref);
+		UG_COND_THROW(tp.num_symbolic() != 2,
+		              "TestSparseTripleProduct: symbolic phase not redone after a pattern change.");
+	}
+	else
+		UG_LOG("TestSparseTripleProduct: matrix is dense, pattern change not tested.\n");
+
+#ifdef UG_PARALLEL
+	const pcl::ProcessCommunicator& pc = A.layouts()->proc_comm();
+	if(!pc.empty())
+	{
+		scale = pc.allreduce(scale, PCL_RO_MAX);
+		errInit = pc.allreduce(errInit, PCL_RO_MAX);
+		errValues = pc.allreduce(errValues, PCL_RO_MAX);
+		errPattern = pc.allreduce(errPattern, PCL_RO_MAX);
+	}
+#endif
+	scale = std::max((number)1.0, scale);
+
+	UG_LOG("TestSparseTripleProduct: max. deviation initial: " << errInit
+	       << ", new values: " << errValues << ", new pattern: " << errPattern << "\n");
+
+	if(errInit > tol * scale || errValues > tol * scale || errPattern > tol * scale)
+		UG_THROW("TestSparseTripleProduct: triple product differs by "
+		         << std::max(errInit, std::max(errValues, errPattern))
+		         << " from AddMultiplyOf (tolerance: " << tol * scale << ").");
+}
+
+}// end of namespace
+
+#endif
@@ -202,6 +202,51 @@ inline void VecHadamardProd(vector_t &dest, const vector_t &v1, const vector_t &
 		VecHadamardProd(dest[i], v1[i], v2[i]);
 }
 
+
+// Fused operations: several updates and reductions in one pass over the vectors
+
+//! calculates x = x + alpha*p and r = r + beta*q
+template<typename vector_t>
+inline void VecScaleAddPair(vector_t &x, double alpha, const vector_t &p,
+                            vector_t &r, double beta, const vector_t &q)
+{
+	for(size_t i=0; i<x.size(); i++)
+	{
+		VecScaleAdd(x[i], 1.0, x[i], alpha, p[i]);
+		VecScaleAdd(r[i], 1.0, r[i], beta, q[i]);
+	}
+}
+
+//! calculates x = x + alpha*p, r = r + beta*q and returns norm_2^2(r)
+template<typename vector_t>
+inline double VecScaleAddPairNormSquared(vector_t &x, double alpha, const vector_t &p,
+                                         vector_t &r, double beta, const vector_t &q)
+{
+	double sum=0;
+	for(size_t i=0; i<x.size(); i++)
+	{
+		VecScaleAdd(x[i], 1.0, x[i], alpha, p[i]);
+		VecScaleAdd(r[i], 1.0, r[i], beta, q[i]);
+		VecNormSquaredAdd(r[i], sum);
+	}
+	return sum;
+}
+
+//! calculates dest = alpha1*v1 + alpha2*v2 together with norm_2^2(dest) and scal<dest, w>
+template<typename vector_t>
+inline void VecScaleAddProd(vector_t &dest, double alpha1, const vector_t &v1,
+                            double alpha2, const vector_t &v2, const vector_t &w,
+                            double &destNorm2, double &destProdW)
+{
+	destNorm2 = 0; destProdW = 0;
+	for(size_t i=0; i<dest.size(); i++)
+	{
+		VecScaleAdd(dest[i], alpha1, v1[i], alpha2, v2[i]);
+		VecNormSquaredAdd(dest[i], destNorm2);
+		VecProdAdd(dest[i], w[i], destProdW);
+	}
+}
+
 } // namespace ug
 
 #endif /* __H__UG__LIB_ALGEBRA__OPERATIONS_VEC__ */
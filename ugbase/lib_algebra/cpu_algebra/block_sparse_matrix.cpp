@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <cmath>
+#include <algorithm>
+#include "block_sparse_matrix.h"
+#include "common/util/omp_util.h"
+
+namespace ug{
+
+////////////////////////////////////////////////////////////////////////////////
+//	dense block kernels, blocks are stored row major
+////////////////////////////////////////////////////////////////////////////////
+
+///	s += alpha * A*x for a nr x nc block A
+static inline void BlockMatVecAdd(double* s, double alpha, const double* A,
+                                  const double* x, size_t nr, size_t nc)
+{
+	for(size_t r = 0; r < nr; ++r, A += nc)
+	{
+		double sum = 0.0;
+		for(size_t c = 0; c < nc; ++c)
+			sum += A[c] * x[c];
+		s[r] += alpha * sum;
+	}
+}
+
+///	y = A*x for a n x n block A
+static inline void BlockMatVec(double* y, const double* A, const double* x, size_t n)
+{
+	for(size_t r = 0; r < n; ++r)
+		y[r] = 0.0;
+	BlockMatVecAdd(y, 1.0, A, x, n, n);
+}
+
+///	C -= A*B for a nr x nk block A and a nk x nc block B
+static inline void BlockMatMatSub(double* C, const double* A, const double* B,
+                                  size_t nr, size_t nk, size_t nc)
+{
+	for(size_t r = 0; r < nr; ++r, C += nc, A += nk)
+		for(size_t k = 0; k < nk; ++k)
+		{
+			const double a = A[k];
+			if(a == 0.0) continue;
+			const double* Bk = B + k*nc;
+			for(size_t c = 0; c < nc; ++c)
+				C[c] -= a * Bk[c];
+		}
+}
+
+///	A = A*B for a nr x n block A and a n x n block B, tmp has size n
+static inline void BlockMatMatAssignRight(double* A, const double* B,
+                                          size_t nr, size_t n, double* tmp)
+{
+	for(size_t r = 0; r < nr; ++r, A += n)
+	{
+		for(size_t c = 0; c < n; ++c)
+			tmp[c] = 0.0;
+		for(size_t k = 0; k < n; ++k)
+		{
+			const double a = A[k];
+			const double* Bk = B + k*n;
+			for(size_t c = 0; c < n; ++c)
+				tmp[c] += a * Bk[c];
+		}
+		for(size_t c = 0; c < n; ++c)
+			A[c] = tmp[c];
+	}
+}
+
+///	inverts the n x n block A in place (Gauss-Jordan with partial pivoting)
+/**	\return false if A is singular */
+static bool BlockInvert(double* A, size_t n, size_t* piv)
+{
+	for(size_t k = 0; k < n; ++k)
+	{
+	//	find pivot
+		size_t p = k;
+		double maxVal = fabs(A[k*n + k]);
+		for(size_t r = k+1; r < n; ++r)
+			if(fabs(A[r*n + k]) > maxVal) {maxVal = fabs(A[r*n + k]); p = r;}
+		if(maxVal == 0.0) return false;
+
+		piv[k] = p;
+		if(p != k)
+			for(size_t c = 0; c < n; ++c)
+				std::swap(A[k*n + c], A[p*n + c]);
+
+	//	scale pivot row
+		const double invPivot = 1.0 / A[k*n + k];
+		A[k*n + k] = 1.0;
+		for(size_t c = 0; c < n; ++c)
+			A[k*n + c] *= invPivot;
+
+	//	eliminate column k in all other rows
+		for(size_t r = 0; r < n; ++r)
+		{
+			if(r == k) continue;
+			const double f = A[r*n + k];
+			if(f == 0.0) continue;
+			A[r*n + k] = 0.0;
+			for(size_t c = 0; c < n; ++c)
+				A[r*n + c] -= f * A[k*n + c];
+		}
+	}
+
+//	undo row interchanges by column interchanges
+	for(size_t k = n; k-- > 0; )
+		if(piv[k] != k)
+			for(size_t r = 0; r < n; ++r)
+				std::swap(A[r*n + k], A[r*n + piv[k]]);
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//	BlockSparseMatrix
+////////////////////////////////////////////////////////////////////////////////
+
+BlockSparseMatrix::BlockSparseMatrix()
+	: m_maxBlockSize(0)
+{}
+
+void BlockSparseMatrix::uniform_block_partition(std::vector<size_t>& vBlockOffset,
+                                                size_t numRows, size_t blockSize)
+{
+	UG_COND_THROW(blockSize == 0, "BlockSparseMatrix: block size must be positive.");
+	vBlockOffset.clear();
+	for(size_t i = 0; i < numRows; i += blockSize)
+		vBlockOffset.push_back(i);
+	vBlockOffset.push_back(numRows);
+}
+
+size_t BlockSparseMatrix::memory() const
+{
+	return (m_vRowOffset.size() + m_vRowStart.size() + m_vCol.size()
+			+ m_vValueOffset.size() + m_vDiag.size() + m_vDiagInvOffset.size())
+				* sizeof(size_t)
+		+ (m_vValue.size() + m_vDiagInv.size()) * sizeof(double);
+}
+
+void BlockSparseMatrix::apply_block_rows(double* y, const double* x,
+                                         size_t from, size_t to, bool bSub) const
+{
+	const double alpha = bSub ? -1.0 : 1.0;
+	for(size_t I = from; I < to; ++I)
+	{
+		const size_t nr = block_size(I);
+		double* yI = y + m_vRowOffset[I];
+		if(!bSub)
+			for(size_t r = 0; r < nr; ++r) yI[r] = 0.0;
+
+		for(size_t k = m_vRowStart[I]; k < m_vRowStart[I+1]; ++k)
+		{
+			const size_t J = m_vCol[k];
+			BlockMatVecAdd(yI, alpha, block(k), x + m_vRowOffset[J], nr, block_size(J));
+		}
+	}
+}
+
+void BlockSparseMatrix::apply(double* y, const double* x) const
+{
+	PROFILE_FUNC_GROUP("algebra");
+	ApplyBlockOp op(*this, y, x, false);
+	ForEachIndexBlock(num_block_rows(), op);
+}
+
+void BlockSparseMatrix::apply_sub(double* y, const double* x) const
+{
+	PROFILE_FUNC_GROUP("algebra");
+	ApplyBlockOp op(*this, y, x, true);
+	ForEachIndexBlock(num_block_rows(), op);
+}
+
+void BlockSparseMatrix::block_row_defect(double* s, size_t I, const double* c,
+                                         const double* d, size_t kFrom, size_t kTo) const
+{
+	const size_t nr = block_size(I);
+	if(d != NULL)
+		for(size_t r = 0; r < nr; ++r) s[r] = d[m_vRowOffset[I] + r];
+	else
+		for(size_t r = 0; r < nr; ++r) s[r] = 0.0;
+
+	for(size_t k = kFrom; k < kTo; ++k)
+	{
+		const size_t J = m_vCol[k];
+		BlockMatVecAdd(s, -1.0, block(k), c + m_vRowOffset[J], nr, block_size(J));
+	}
+}
+
+void BlockSparseMatrix::init_diag_inverse_storage()
+{
+	m_vDiagInvOffset.resize(num_block_rows() + 1);
+	size_t offset = 0;
+	for(size_t I = 0; I < num_block_rows(); ++I)
+	{
+		m_vDiagInvOffset[I] = offset;
+		offset += block_size(I) * block_size(I);
+	}
+	m_vDiagInvOffset[num_block_rows()] = offset;
+	m_vDiagInv.resize(offset);
+}
+
+bool BlockSparseMatrix::invert_diagonal()
+{
+	PROFILE_FUNC_GROUP("algebra");
+	init_diag_inverse_storage();
+
+	std::vector<size_t> vPiv(m_maxBlockSize);
+	for(size_t I = 0; I < num_block_rows(); ++I)
+	{
+		const size_t n = block_size(I);
+		double* Dinv = &m_vDiagInv[m_vDiagInvOffset[I]];
+		std::copy(block(m_vDiag[I]), block(m_vDiag[I]) + n*n, Dinv);
+		if(!BlockInvert(Dinv, n, &vPiv[0])) return false;
+	}
+	return true;
+}
+
+void BlockSparseMatrix::gs_step_LD(double* c, const double* d) const
+{
+	PROFILE_FUNC_GROUP("algebra");
+	std::vector<double> s(m_maxBlockSize);
+	for(size_t I = 0; I < num_block_rows(); ++I)
+	{
+		block_row_defect(&s[0], I, c, d, m_vRowStart[I], m_vDiag[I]);
+		BlockMatVec(c + m_vRowOffset[I], diag_inverse(I), &s[0], block_size(I));
+	}
+}
+
+void BlockSparseMatrix::gs_step_UD(double* c, const double* d) const
+{
+	PROFILE_FUNC_GROUP("algebra");
+	std::vector<double> s(m_maxBlockSize);
+	for(size_t I = num_block_rows(); I-- > 0; )
+	{
+		block_row_defect(&s[0], I, c, d, m_vDiag[I]+1, m_vRowStart[I+1]);
+		BlockMatVec(c + m_vRowOffset[I], diag_inverse(I), &s[0], block_size(I));
+	}
+}
+
+void BlockSparseMatrix::sgs_step(double* c, const double* d) const
+{
+	PROFILE_FUNC_GROUP("algebra");
+	gs_step_LD(c, d);
+
+//	c := (D+U)^{-1} D c, i.e. c_I -= D_I^{-1} sum_{J>I} A_IJ c_J
+	std::vector<double> s(m_maxBlockSize);
+	for(size_t I = num_block_rows(); I-- > 0; )
+	{
+		block_row_defect(&s[0], I, c, NULL, m_vDiag[I]+1, m_vRowStart[I+1]);
+		BlockMatVecAdd(c + m_vRowOffset[I], 1.0, diag_inverse(I), &s[0],
+		               block_size(I), block_size(I));
+	}
+}
+
+bool BlockSparseMatrix::factorize_ilu0()
+{
+	PROFILE_FUNC_GROUP("algebra");
+	init_diag_inverse_storage();
+
+	std::vector<double> tmp(m_maxBlockSize);
+	std::vector<size_t> vPiv(m_maxBlockSize);
+
+	for(size_t I = 0; I < num_block_rows(); ++I)
+	{
+		const size_t nI = block_size(I);
+		const size_t rowEnd = m_vRowStart[I+1];
+
+		for(size_t k = m_vRowStart[I]; k < m_vDiag[I]; ++k)
+		{
+			const size_t K = m_vCol[k];
+			const size_t nK = block_size(K);
+
+		//	L_IK = A_IK * U_KK^{-1}
+			BlockMatMatAssignRight(block(k), diag_inverse(K), nI, nK, &tmp[0]);
+
+		//	A_IJ -= L_IK * U_KJ for all J > K present in row I and row K
+			size_t j = k+1, kj = m_vDiag[K]+1;
+			const size_t rowEndK = m_vRowStart[K+1];
+			while(j < rowEnd && kj < rowEndK)
+			{
+				if(m_vCol[j] < m_vCol[kj]) ++j;
+				else if(m_vCol[j] > m_vCol[kj]) ++kj;
+				else
+				{
+					BlockMatMatSub(block(j), block(k), block(kj), nI, nK, block_size(m_vCol[j]));
+					++j; ++kj;
+				}
+			}
+		}
+
+	//	invert U_II
+		double* Dinv = &m_vDiagInv[m_vDiagInvOffset[I]];
+		std::copy(block(m_vDiag[I]), block(m_vDiag[I]) + nI*nI, Dinv);
+		if(!BlockInvert(Dinv, nI, &vPiv[0])) return false;
+	}
+	return true;
+}
+
+void BlockSparseMatrix::ilu_solve(double* c, const double* d) const
+{
+	PROFILE_FUNC_GROUP("algebra");
+	std::vector<double> s(m_maxBlockSize);
+
+//	forward solve with L (unit diagonal)
+	for(size_t I = 0; I < num_block_rows(); ++I)
+	{
+		block_row_defect(&s[0], I, c, d, m_vRowStart[I], m_vDiag[I]);
+		std::copy(s.begin(), s.begin() + block_size(I), c + m_vRowOffset[I]);
+	}
+
+//	backward solve with U
+	for(size_t I = num_block_rows(); I-- > 0; )
+	{
+		block_row_defect(&s[0], I, c, c, m_vDiag[I]+1, m_vRowStart[I+1]);
+		BlockMatVec(c + m_vRowOffset[I], diag_inverse(I), &s[0], block_size(I));
+	}
+}
+
+} // end namespace ug
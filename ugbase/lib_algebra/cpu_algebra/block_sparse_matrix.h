@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__CPU_ALGEBRA__BLOCK_SPARSE_MATRIX__
+#define __H__UG__CPU_ALGEBRA__BLOCK_SPARSE_MATRIX__
+
+#include <vector>
+#include "common/common.h"
+
+namespace ug{
+
+/// \addtogroup cpu_algebra
+///	@{
+
+/// Block sparse row (BSR) matrix with variable block sizes
+/**
+ * The matrix is stored as a sparse pattern of dense blocks. Block row I covers
+ * the scalar rows [row_offset(I), row_offset(I+1)), the columns are
+ * partitioned the same way. In contrast to SparseMatrix, only one column index
+ * is stored per block and the block values are stored densely (row major)
+ * in one contiguous array. Entries missing in the source matrix are stored
+ * as zeros inside their block.
+ *
+ * The block rows are built from consecutive algebra indices of a SparseMatrix,
+ * so scalar matrices with interleaved components as well as the block
+ * algebras (also with variable block size) can be converted. The partition
+ * can be given explicitly or be detected by grouping consecutive rows with
+ * identical sparsity pattern (detect_block_partition).
+ *
+ * The class provides the kernels of the block smoothers: SpMV, forward,
+ * backward and symmetric Gauss-Seidel, and an ILU(0) factorization on the
+ * block pattern with the corresponding solve. All kernels work on plain
+ * double arrays in the scalar numbering.
+ */
+class BlockSparseMatrix
+{
+	public:
+		BlockSparseMatrix();
+
+	///	computes a partition into block rows by grouping consecutive rows
+	/**
+	 * Consecutive algebra rows with identical column pattern are merged into
+	 * one block row as long as the block has at most maxBlockSize scalar rows.
+	 * \param[out]	vBlockOffset	first algebra index of each block row (size: #blocks+1)
+	 * \param[in]	A				a SparseMatrix (scalar or block)
+	 * \param[in]	maxBlockSize	maximal number of scalar rows per block
+	 */
+		template <typename TSparseMatrix>
+		static void detect_block_partition(std::vector<size_t>& vBlockOffset,
+		                                   const TSparseMatrix& A, size_t maxBlockSize);
+
+	///	computes a partition into block rows of blockSize algebra indices
+		static void uniform_block_partition(std::vector<size_t>& vBlockOffset,
+		                                    size_t numRows, size_t blockSize);
+
+	///	copies the matrix A into block storage
+	/**
+	 * \param[in]	A				a SparseMatrix with sorted rows
+	 * \param[in]	vBlockOffset	first algebra index of each block row (size: #blocks+1)
+	 */
+		template <typename TSparseMatrix>
+		void init(const TSparseMatrix& A, const std::vector<size_t>& vBlockOffset);
+
+	///	number of scalar rows
+		size_t num_rows() const {return m_vRowOffset.empty() ? 0 : m_vRowOffset.back();}
+
+	///	number of block rows
+		size_t num_block_rows() const {return m_vDiag.size();}
+
+	///	number of stored blocks
+		size_t num_blocks() const {return m_vCol.size();}
+
+	///	number of stored scalar values (including zeros inside blocks)
+		size_t num_values() const {return m_vValue.size();}
+
+	///	first scalar row of block row I
+		size_t row_offset(size_t I) const {return m_vRowOffset[I];}
+
+	///	number of scalar rows of block row I
+		size_t block_size(size_t I) const {return m_vRowOffset[I+1] - m_vRowOffset[I];}
+
+	///	memory used for the index structure and the values
+		size_t memory() const;
+
+	///	y = A*x
+		void apply(double* y, const double* x) const;
+
+	///	y -= A*x
+		void apply_sub(double* y, const double* x) const;
+
+	///	computes the inverses of the diagonal blocks, needed by the gs steps
+	/**	\return false if a diagonal block is singular */
+		bool invert_diagonal();
+
+	///	c = (D+L)^{-1} d
+		void gs_step_LD(double* c, const double* d) const;
+
+	///	c = (D+U)^{-1} d
+		void gs_step_UD(double* c, const double* d) const;
+
+	///	c = (D+U)^{-1} D (D+L)^{-1} d
+		void sgs_step(double* c, const double* d) const;
+
+	///	overwrites the matrix by its ILU(0) factorization on the block pattern
+	/**
+	 * After the call, the strict lower blocks hold L (with unit diagonal
+	 * blocks), the upper blocks hold U and the inverses of the diagonal blocks
+	 * of U are stored separately. The matrix can then only be used by
+	 * ilu_solve.
+	 * \return false if a diagonal block is singular
+	 */
+		bool factorize_ilu0();
+
+	///	c = (LU)^{-1} d, after factorize_ilu0
+		void ilu_solve(double* c, const double* d) const;
+
+	protected:
+	///	pointer to the values of block k
+		double* block(size_t k) {return &m_vValue[m_vValueOffset[k]];}
+		const double* block(size_t k) const {return &m_vValue[m_vValueOffset[k]];}
+
+	///	pointer to the inverse of the diagonal block of block row I
+		const double* diag_inverse(size_t I) const {return &m_vDiagInv[m_vDiagInvOffset[I]];}
+
+	///	computes the offsets of the diagonal inverses
+		void init_diag_inverse_storage();
+
+	///	s = d_I - sum_k A_k c_{col(k)} for the blocks k in [kFrom, kTo) of row I
+	/**	if d is NULL, d_I = 0 is used */
+		void block_row_defect(double* s, size_t I, const double* c, const double* d,
+		                      size_t kFrom, size_t kTo) const;
+
+	///	y_I (+/-)= A_I x for the block rows I in [from, to)
+		void apply_block_rows(double* y, const double* x, size_t from, size_t to,
+		                      bool bSub) const;
+
+	///	functor applying the block rows of a thread block
+		struct ApplyBlockOp
+		{
+			ApplyBlockOp(const BlockSparseMatrix& A, double* y, const double* x, bool bSub)
+				: m_A(A), m_y(y), m_x(x), m_bSub(bSub) {}
+			void operator()(size_t from, size_t to) const
+			{
+				m_A.apply_block_rows(m_y, m_x, from, to, m_bSub);
+			}
+			const BlockSparseMatrix& m_A;
+			double* m_y;
+			const double* m_x;
+			bool m_bSub;
+		};
+
+	///	number of scalar rows of the row of algebra index i
+		template <typename TSparseMatrix>
+		static size_t algebra_row_size(const TSparseMatrix& A, size_t i);
+
+	///	returns if the algebra rows i and j have the same column pattern
+		template <typename TSparseMatrix>
+		static bool same_pattern(const TSparseMatrix& A, size_t i, size_t j);
+
+	protected:
+	///	first scalar row of each block row (size: #block rows + 1)
+		std::vector<size_t> m_vRowOffset;
+
+	///	first block of each block row (size: #block rows + 1)
+		std::vector<size_t> m_vRowStart;
+
+	///	block column of each block
+		std::vector<size_t> m_vCol;
+
+	///	offset of the values of each block in m_vValue (size: #blocks + 1)
+		std::vector<size_t> m_vValueOffset;
+
+	///	index of the diagonal block of each block row
+		std::vector<size_t> m_vDiag;
+
+	///	block values, each block dense and row major
+		std::vector<double> m_vValue;
+
+	///	inverses of the diagonal blocks and their offsets
+		std::vector<double> m_vDiagInv;
+		std::vector<size_t> m_vDiagInvOffset;
+
+	///	largest block size
+		size_t m_maxBlockSize;
+};
+
+/// @}
+
+} // end namespace ug
+
+#include "block_sparse_matrix_impl.h"
+
+#endif /* __H__UG__CPU_ALGEBRA__BLOCK_SPARSE_MATRIX__ */
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__CPU_ALGEBRA__BLOCK_SPARSE_MATRIX_IMPL__
+#define __H__UG__CPU_ALGEBRA__BLOCK_SPARSE_MATRIX_IMPL__
+
+#include <algorithm>
+#include "block_sparse_matrix.h"
+#include "common/profiler/profiler.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+
+namespace ug{
+
+template <typename TSparseMatrix>
+size_t BlockSparseMatrix::algebra_row_size(const TSparseMatrix& A, size_t i)
+{
+	typedef typename TSparseMatrix::value_type value_type;
+
+	typename TSparseMatrix::const_row_iterator it = A.begin_row(i);
+	if(it != A.end_row(i)) return GetRows(it.value());
+
+	UG_COND_THROW(!block_traits<value_type>::is_static,
+			"BlockSparseMatrix: cannot determine the block size of empty row " << i);
+	return block_traits<value_type>::static_num_rows;
+}
+
+template <typename TSparseMatrix>
+bool BlockSparseMatrix::same_pattern(const TSparseMatrix& A, size_t i, size_t j)
+{
+	typedef typename TSparseMatrix::const_row_iterator const_row_iterator;
+
+	const_row_iterator it1 = A.begin_row(i), end1 = A.end_row(i);
+	const_row_iterator it2 = A.begin_row(j), end2 = A.end_row(j);
+	for(; it1 != end1 && it2 != end2; ++it1, ++it2)
+		if(it1.index() != it2.index()) return false;
+	return it1 == end1 && it2 == end2;
+}
+
+template <typename TSparseMatrix>
+void BlockSparseMatrix::detect_block_partition(std::vector<size_t>& vBlockOffset,
+                                               const TSparseMatrix& A, size_t maxBlockSize)
+{
+	vBlockOffset.clear();
+	vBlockOffset.push_back(0);
+
+	size_t blockRows = 0;
+	for(size_t i = 0; i < A.num_rows(); ++i)
+	{
+		const size_t size = algebra_row_size(A, i);
+		if(i > 0 && blockRows + size <= maxBlockSize && same_pattern(A, i-1, i))
+			blockRows += size;
+		else
+		{
+			if(i > 0) vBlockOffset.push_back(i);
+			blockRows = size;
+		}
+	}
+	if(A.num_rows() > 0) vBlockOffset.push_back(A.num_rows());
+}
+
+template <typename TSparseMatrix>
+void BlockSparseMatrix::init(const TSparseMatrix& A, const std::vector<size_t>& vBlockOffset)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	typedef typename TSparseMatrix::const_row_iterator const_row_iterator;
+	typedef typename TSparseMatrix::value_type value_type;
+
+	UG_COND_THROW(vBlockOffset.empty() || vBlockOffset.front() != 0
+			|| vBlockOffset.back() != A.num_rows(),
+			"BlockSparseMatrix::init: block partition does not match the "
+			"matrix with " << A.num_rows() << " rows.");
+	const size_t numAlgRows = A.num_rows();
+	const size_t numBlockRows = vBlockOffset.size() - 1;
+
+//	scalar offset and block row of each algebra index
+	std::vector<size_t> vScalarOffset(numAlgRows + 1), vBlockOf(numAlgRows);
+	vScalarOffset[0] = 0;
+	for(size_t i = 0; i < numAlgRows; ++i)
+		vScalarOffset[i+1] = vScalarOffset[i] + algebra_row_size(A, i);
+
+	m_vRowOffset.resize(numBlockRows + 1);
+	m_maxBlockSize = 0;
+	for(size_t I = 0; I < numBlockRows; ++I)
+	{
+		for(size_t i = vBlockOffset[I]; i < vBlockOffset[I+1]; ++i)
+			vBlockOf[i] = I;
+		m_vRowOffset[I] = vScalarOffset[vBlockOffset[I]];
+		m_maxBlockSize = std::max(m_maxBlockSize,
+		                          vScalarOffset[vBlockOffset[I+1]] - m_vRowOffset[I]);
+	}
+	m_vRowOffset[numBlockRows] = vScalarOffset[numAlgRows];
+
+//	block pattern, the diagonal block is always stored
+	m_vRowStart.resize(numBlockRows + 1);
+	m_vDiag.resize(numBlockRows);
+	m_vCol.clear();
+	std::vector<size_t> vCol;
+	for(size_t I = 0; I < numBlockRows; ++I)
+	{
+		vCol.clear();
+		vCol.push_back(I);
+		for(size_t i = vBlockOffset[I]; i < vBlockOffset[I+1]; ++i)
+			for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+				vCol.push_back(vBlockOf[it.index()]);
+		std::sort(vCol.begin(), vCol.end());
+		vCol.erase(std::unique(vCol.begin(), vCol.end()), vCol.end());
+
+		m_vRowStart[I] = m_vCol.size();
+		m_vDiag[I] = m_vRowStart[I] + (std::lower_bound(vCol.begin(), vCol.end(), I) - vCol.begin());
+		m_vCol.insert(m_vCol.end(), vCol.begin(), vCol.end());
+	}
+	m_vRowStart[numBlockRows] = m_vCol.size();
+
+//	value storage
+	m_vValueOffset.resize(m_vCol.size() + 1);
+	size_t offset = 0;
+	for(size_t I = 0; I < numBlockRows; ++I)
+		for(size_t k = m_vRowStart[I]; k < m_vRowStart[I+1]; ++k)
+		{
+			m_vValueOffset[k] = offset;
+			offset += block_size(I) * block_size(m_vCol[k]);
+		}
+	m_vValueOffset[m_vCol.size()] = offset;
+	m_vValue.assign(offset, 0.0);
+
+//	copy values
+	for(size_t I = 0; I < numBlockRows; ++I)
+	{
+		const size_t* colBegin = &m_vCol[0] + m_vRowStart[I];
+		const size_t* colEnd = &m_vCol[0] + m_vRowStart[I+1];
+
+		for(size_t i = vBlockOffset[I]; i < vBlockOffset[I+1]; ++i)
+		{
+			const size_t r0 = vScalarOffset[i] - m_vRowOffset[I];
+			for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+			{
+				const size_t J = vBlockOf[it.index()];
+				const size_t k = m_vRowStart[I] + (std::lower_bound(colBegin, colEnd, J) - colBegin);
+				const size_t nc = block_size(J);
+				const size_t c0 = vScalarOffset[it.index()] - m_vRowOffset[J];
+
+				const value_type& v = it.value();
+				double* b = block(k);
+				for(size_t r = 0; r < GetRows(v); ++r)
+					for(size_t c = 0; c < GetCols(v); ++c)
+						b[(r0 + r)*nc + c0 + c] = BlockRef(v, r, c);
+			}
+		}
+	}
+
+	m_vDiagInv.clear();
+	m_vDiagInvOffset.clear();
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__CPU_ALGEBRA__BLOCK_SPARSE_MATRIX_IMPL__ */
@@ -39,6 +39,7 @@
 #include <iostream>
 #include <algorithm>
 #include "common/util/ostream_util.h"
+#include "common/util/omp_util.h"
 
 #include "../algebra_common/connection.h"
 #include "../algebra_common/matrixrow.h"
@@ -81,6 +82,29 @@ namespace ug{
 // rowMax = 4 8 11
 // cols : 2 3 5 6 | 2 3 6 7 | 8 9 10
 
+// finalize: defragment, free rowMax. rowStart is now a real CRS row pointer,
+// row i is [rowStart[i], rowStart[i+1]).
+// rowStart 0 4 8 11
+// rowEnd 4 8 11
+// cols : 2 3 5 6 | 2 3 6 7 | 8 9 10
+// inserting a new connection unfinalizes the matrix again.
+
+
+///	returns a new pattern revision, unique among all sparse matrices
+/**	Since the revisions are unique, a (matrix, revision) pair still identifies
+ * a sparsity pattern if the matrix has been destroyed and another one has been
+ * allocated at the same address.*/
+inline size_t NextSparseMatrixPatternRevision()
+{
+	static size_t s_revision = 0;
+	size_t rev;
+#ifdef UG_OPENMP
+	#pragma omp atomic capture
+#endif
+	rev = ++s_revision;
+	return rev;
+}
+
 
 /** SparseMatrix
  *  \brief sparse matrix for big, variable sparse matrices.
@@ -160,6 +184,13 @@ public:
 			const number &alpha1, const vector_t &v1,
 			const number &beta1, const vector_t &w1) const;
 
+	//! calculate dest[i] = alpha1*v1[i] + beta1*(A*w1)[i] only for the rows i in rows[0], ..., rows[numRows-1]
+	template<typename vector_t>
+	void axpy_row_list(vector_t &dest,
+			const number &alpha1, const vector_t &v1,
+			const number &beta1, const vector_t &w1,
+			const size_t *rows, size_t numRows) const;
+
 	//! calculate dest = alpha1*v1 + beta1*A^T*w1 (A = this matrix)
 	template<typename vector_t>
 	void axpy_transposed(vector_t &dest,
@@ -242,6 +273,28 @@ public:
 	// finalizing functions
 	//----------------------
 
+	/**
+	 * \brief compacts the matrix into a contiguous CRS layout.
+	 * After assembly, call finalize to store all rows contiguously (rowStart
+	 * then is a CRS row pointer) and to free the memory needed for changing
+	 * the sparsity pattern. Values can still be changed. axpy, Gauss-Seidel
+	 * and ILU use a faster path for finalized matrices.
+	 * Adding a new connection unfinalizes the matrix automatically.
+	 */
+	void finalize();
+
+	//! leaves the finalized state, so that the sparsity pattern can be changed efficiently
+	void unfinalize();
+
+	//! returns true if the matrix is finalized \sa finalize
+	bool is_finalized() const { return bFinalized; }
+
+	//! changes every time the matrix is finalized.
+	/** While is_finalized() is true, the sparsity pattern is fixed. Data depending
+	 * only on the pattern can be cached together with this number. The revisions
+	 * are unique among all matrices (\sa NextSparseMatrixPatternRevision).*/
+	size_t pattern_revision() const { return m_patternRevision; }
+
 
 
 	inline void check_rc(size_t r, size_t c) const
@@ -506,7 +559,7 @@ public:
 
 	void defragment()
     {
-		if(num_rows() != 0 && num_cols() != 0)
+		if(!bFinalized && num_rows() != 0 && num_cols() != 0)
 			copyToNewSize(nnz);
     }
 
@@ -557,6 +610,24 @@ public:
 	}
 
 
+public:
+	// direct access to finalized matrices
+	//---------------------------------------
+	// these are only valid while the matrix is finalized and not modified.
+
+	//! row r is stored in [crs_row_start()[r], crs_row_start()[r+1])
+	const int *crs_row_start() const { UG_ASSERT(bFinalized, "matrix not finalized"); return &rowStart[0]; }
+
+	//! column indices of all connections
+	const int *crs_cols() const { UG_ASSERT(bFinalized, "matrix not finalized"); return cols.empty() ? NULL : &cols[0]; }
+
+	//! values of all connections
+	const value_type *crs_values() const { UG_ASSERT(bFinalized, "matrix not finalized"); return values.empty() ? NULL : &values[0]; }
+	value_type *crs_values() { UG_ASSERT(bFinalized, "matrix not finalized"); return values.empty() ? NULL : &values[0]; }
+
+	//! position of the first connection (r, c) with c >= r, so row r is split into [start, diag) and [diag, end)
+	const int *crs_diag() const { UG_ASSERT(bFinalized, "matrix not finalized"); return diagIndex.empty() ? NULL : &diagIndex[0]; }
+
 public:
 	// output functions
 	//----------------------
@@ -609,6 +680,56 @@ private:
     void assureValuesSize(size_t s);
     size_t get_nnz() const { return nnz; }
 
+	//! axpy for rows [rowFrom, rowTo) only. used by axpy for each thread.
+	template<typename vector_t>
+	void axpy_rows(vector_t &dest,
+			const number &alpha1, const vector_t &v1,
+			const number &beta1, const vector_t &w1,
+			size_t rowFrom, size_t rowTo) const;
+
+	//! dest[i] = alpha1*v1[i] + beta1*(A*w1)[i] for a single row. pRowEnd is row_end_array().
+	template<typename vector_t>
+	inline void axpy_row(vector_t &dest,
+			const number &alpha1, const vector_t &v1,
+			const number &beta1, const vector_t &w1,
+			size_t i, const int *pRowEnd) const;
+
+	//! apply_ignore_zero_rows for rows [rowFrom, rowTo) only.
+	template<typename vector_t>
+	void apply_ignore_zero_rows_rows(vector_t &dest,
+			const number &beta1, const vector_t &w1,
+			size_t rowFrom, size_t rowTo) const;
+
+	//! adds beta1*A^T*w1 to dest, row by row.
+	template<typename vector_t>
+	void mat_mult_transposed_add(vector_t &dest,
+			const number &beta1, const vector_t &w1) const;
+
+	//! adds beta1*A^T*w1 to the entries [colBegin, colEnd) of dest. used by the threaded transposed kernels.
+	/** The connections are taken from the transposed index, which has to be up to date
+	 * (\sa update_transposed_index). Each entry of dest gets the contributions in the
+	 * same (row) order as in mat_mult_transposed_add.*/
+	template<typename vector_t>
+	void mat_mult_transposed_add_cols(vector_t &dest,
+			const number &beta1, const vector_t &w1,
+			size_t colBegin, size_t colEnd) const;
+
+	//! builds the transposed index of a finalized matrix, if not done for the current pattern
+	void update_transposed_index() const;
+
+	//! returns an array with the end of each row. for finalized matrices, this is rowStart+1.
+	inline const int *row_end_array() const
+	{
+		if(bFinalized) return &rowStart[0]+1;
+		return rowEnd.empty() ? NULL : &rowEnd[0];
+	}
+
+	//! returns the first index in row r with column >= c
+	inline int lower_bound_in_row(size_t r, int c) const
+	{
+		return std::lower_bound(&cols[0] + rowStart[r], &cols[0] + rowEnd[r], c) - &cols[0];
+	}
+
 private:
 	// disallowed operations (not defined):
 	//---------------------------------------
@@ -636,6 +757,18 @@ protected:
     size_t fragmented;
     size_t nnz;
     bool bNeedsValues;
+    bool bFinalized;
+    size_t m_patternRevision;	///< see pattern_revision()
+    std::vector<int> diagIndex;	///< only for finalized matrices, see crs_diag()
+
+    //! transposed index of a finalized matrix (built on demand by the threaded transposed kernels).
+    /** the connections of column c are m_vTransposedPos[k] (index in cols/values) and
+     * m_vTransposedRow[k] (row) for k in [m_vTransposedStart[c], m_vTransposedStart[c+1]),
+     * sorted by row. */
+    mutable std::vector<int> m_vTransposedStart;
+    mutable std::vector<int> m_vTransposedPos;
+    mutable std::vector<int> m_vTransposedRow;
+    mutable size_t m_transposedRevision;	///< pattern revision of the transposed index
 
     std::vector<value_type> values;
     int maxValues;
@@ -681,5 +814,6 @@ inline void MatMultTransposedAdd(vector_t &dest,
 //#include "matrixrow.h"
 #include "sparsematrix_impl.h"
 #include "sparsematrix_print.h"
+#include "sparsematrix_crs_kernels.h"
 
 #endif
@@ -0,0 +1,667 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__CPU_ALGEBRA__SPARSEMATRIX_CRS_KERNELS__
+#define __H__UG__CPU_ALGEBRA__SPARSEMATRIX_CRS_KERNELS__
+
+#include <string>
+#include <vector>
+#include "sparsematrix.h"
+#include "common/util/omp_util.h"
+#include "../algebra_common/level_schedule.h"
+
+namespace ug{
+
+/// \addtogroup cpu_algebra
+///	@{
+
+// Fast paths of the Gauss-Seidel and ILU kernels for finalized SparseMatrix
+// (\sa SparseMatrix::finalize). They work directly on the CRS arrays and use
+// the stored diagonal positions instead of row iterators and searching
+// A(i,i). The generic kernels in core_smoothers.h and ilu.h call these
+// functions with a pointer to the matrix, so that they are also found for
+// types derived from SparseMatrix (ParallelMatrix, MatrixOperator).
+// All functions return false if the matrix is not finalized, then the
+// generic kernel is used.
+
+//! returns A(i,i) of a finalized matrix (zero if not in the pattern)
+template<typename T>
+inline const T &FinalizedDiag(const SparseMatrix<T> &A, size_t i)
+{
+	const int k = A.crs_diag()[i];
+	if(k != A.crs_row_start()[i+1] && A.crs_cols()[k] == (int)i)
+		return A.crs_values()[k];
+	static T zero(0.0);
+	return zero;
+}
+
+//! forward Gauss-Seidel step c = relax*(D-L)^{-1} d \sa gs_step_LL
+template<typename T, typename Vector_type>
+bool gs_step_LL_finalized(const SparseMatrix<T> *pA, Vector_type &c, const Vector_type &d, const number relaxFactor)
+{
+	const SparseMatrix<T> &A = *pA;
+	if(!A.is_finalized()) return false;
+	const int *rowStart = A.crs_row_start();
+	const int *diag = A.crs_diag();
+	const int *cols = A.crs_cols();
+	const T *values = A.crs_values();
+
+	typename Vector_type::value_type s;
+	for(size_t i=0; i < c.size(); i++)
+	{
+		s = d[i];
+		for(int k=rowStart[i]; k < diag[i]; ++k)
+			// s -= A(i,j) * c[j];
+			MatMultAdd(s, 1.0, s, -1.0, values[k], c[cols[k]]);
+
+		// c[i] = relaxFactor * s/A(i,i)
+		InverseMatMult(c[i], relaxFactor, FinalizedDiag(A, i), s);
+	}
+	return true;
+}
+
+//! backward Gauss-Seidel step c = relax*(D-U)^{-1} d \sa gs_step_UR
+template<typename T, typename Vector_type>
+bool gs_step_UR_finalized(const SparseMatrix<T> *pA, Vector_type &c, const Vector_type &d, const number relaxFactor)
+{
+	const SparseMatrix<T> &A = *pA;
+	if(!A.is_finalized()) return false;
+	const int *rowStart = A.crs_row_start();
+	const int *diag = A.crs_diag();
+	const int *cols = A.crs_cols();
+	const T *values = A.crs_values();
+
+	typename Vector_type::value_type s;
+	if(c.size() == 0) return true;
+	size_t i = c.size()-1;
+	do
+	{
+		s = d[i];
+		int k = diag[i];
+		if(k != rowStart[i+1] && cols[k] == (int)i) ++k;
+		for(; k < rowStart[i+1]; ++k)
+			// s -= A(i,j) * c[j];
+			MatMultAdd(s, 1.0, s, -1.0, values[k], c[cols[k]]);
+
+		// c[i] = relaxFactor * s/A(i,i)
+		InverseMatMult(c[i], relaxFactor, FinalizedDiag(A, i), s);
+	} while(i-- != 0);
+	return true;
+}
+
+//! solves x = L^{-1} b for an ILU-factorized matrix \sa invert_L
+template<typename T, typename Vector_type>
+bool invert_L_finalized(const SparseMatrix<T> *pA, Vector_type &x, const Vector_type &b)
+{
+	const SparseMatrix<T> &A = *pA;
+	if(!A.is_finalized()) return false;
+	const int *rowStart = A.crs_row_start();
+	const int *diag = A.crs_diag();
+	const int *cols = A.crs_cols();
+	const T *values = A.crs_values();
+
+	typename Vector_type::value_type s;
+	for(size_t i=0; i < x.size(); i++)
+	{
+		s = b[i];
+		for(int k=rowStart[i]; k < diag[i]; ++k)
+			MatMultAdd(s, 1.0, s, -1.0, values[k], x[cols[k]]);
+		x[i] = s;
+	}
+	return true;
+}
+
+//! computes sum_{j>i} A(i,j) x[j] for finalized matrices, used by invert_U_finalized
+template<typename T, typename Vector_type>
+inline void FinalizedSubtractUpper(const SparseMatrix<T> &A, size_t i,
+		typename Vector_type::value_type &s, const Vector_type &x)
+{
+	const int *rowStart = A.crs_row_start();
+	const int *cols = A.crs_cols();
+	const T *values = A.crs_values();
+	int k = A.crs_diag()[i];
+	if(k != rowStart[i+1] && cols[k] == (int)i) ++k;
+	for(; k < rowStart[i+1]; ++k)
+		// s -= A(i,j) * x[j];
+		MatMultAdd(s, 1.0, s, -1.0, values[k], x[cols[k]]);
+}
+
+//! solves x = U^{-1} b for an ILU-factorized matrix \sa invert_U
+/**
+ * \param result	set to the return value of invert_U
+ * \return false if the matrix is not finalized
+ */
+template<typename T, typename Vector_type>
+bool invert_U_finalized(const SparseMatrix<T> *pA, Vector_type &x, const Vector_type &b,
+		const number eps, bool &result)
+{
+	const SparseMatrix<T> &A = *pA;
+	if(!A.is_finalized()) return false;
+
+	typename Vector_type::value_type s;
+	result = true;
+
+	// last row, see invert_U
+	if(x.size() > 0)
+	{
+		size_t i=x.size()-1;
+		s = b[i];
+		const T &uii = FinalizedDiag(A, i);
+		if (BlockNorm(uii) <= eps * BlockNorm(s))
+		{
+			UG_LOG("ILU Warning: Near-zero last diagonal entry "
+					"with norm "<<BlockNorm(uii)<<" in U "
+					"for non-near-zero rhs entry with norm "
+					<< BlockNorm(s) << ". Setting rhs to zero.\n"
+					"NOTE: Reduce 'eps' using e.g. ILU::set_inversion_eps(...) "
+					"to avoid this warning. Current eps: " << eps << ".\n")
+			x[i] = 0;
+			result = false;
+		}
+		else
+			InverseMatMult(x[i], 1.0, uii, s);
+	}
+	if(x.size() <= 1) return true;
+
+	for(size_t i = x.size()-2; ; --i)
+	{
+		s = b[i];
+		FinalizedSubtractUpper(A, i, s, x);
+		// x[i] = s/A(i,i);
+		InverseMatMult(x[i], 1.0, FinalizedDiag(A, i), s);
+		if(i == 0) break;
+	}
+	return true;
+}
+
+//! eliminates row i of a finalized matrix with the rows k < i (ILU(0))
+/**
+ * All rows k < i with A(i,k) != 0 must already be factorized. Only row i is
+ * changed, so rows without mutual dependencies can be processed concurrently.
+ */
+template<typename T>
+inline void FactorizeILURow_finalized(SparseMatrix<T> &A, size_t i, const number eps)
+{
+	const int *rowStart = A.crs_row_start();
+	const int *diag = A.crs_diag();
+	const int *cols = A.crs_cols();
+	T *values = A.crs_values();
+
+	// eliminate all entries A(i, k) with k<i with rows A(k, .) and k<i
+	for(int ik = rowStart[i]; ik < diag[i]; ++ik)
+	{
+		const size_t k = cols[ik];
+		T &a_ik = values[ik];
+		const int kk = diag[k];
+		if(kk == rowStart[k+1] || cols[kk] != (int)k)
+			UG_THROW("ILU: Diagonal entry of row k="<<k<<" is not in the sparsity pattern.");
+		T &a_kk = values[kk];
+
+		if(fabs(BlockNorm(a_kk)) < eps * BlockNorm(a_ik))
+			UG_THROW("ILU: Blocknorm of diagonal is near-zero for k="<<k<<
+			         " with eps: "<< eps <<", ||A_kk||="<<fabs(BlockNorm(a_kk))
+			         <<", ||A_ik||="<<BlockNorm(a_ik));
+
+		try {a_ik /= a_kk;}
+		UG_CATCH_THROW("Failed to calculate A_ik /= A_kk "
+			"with i = " << i << " and k = " << k << ".");
+
+		// A(i, j) -= A(i,k) * A(k,j) for all j > k in both rows
+		int ij = ik+1;
+		int kj = rowStart[k];
+		const int ijEnd = rowStart[i+1];
+		const int kjEnd = rowStart[k+1];
+		while(ij != ijEnd && kj != kjEnd)
+		{
+			if(cols[ij] > cols[kj])
+				++kj;
+			else if(cols[ij] < cols[kj])
+				++ij;
+			else
+			{
+				values[ij] -= a_ik * values[kj];
+				++kj; ++ij;
+			}
+		}
+	}
+}
+
+//! ILU(0) factorization for sorted rows \sa FactorizeILUSorted
+/**
+ * The factorization works in place on the CRS arrays. The matrix is finalized
+ * first, since the pattern does not change during the factorization.
+ */
+template<typename T>
+bool FactorizeILUSorted_finalized(SparseMatrix<T> *pA, const number eps)
+{
+	SparseMatrix<T> &A = *pA;
+	A.finalize();
+
+	for(size_t i=1; i < A.num_rows(); i++)
+		FactorizeILURow_finalized(A, i, eps);
+	return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Level scheduled (threaded) ILU kernels
+////////////////////////////////////////////////////////////////////////////////
+
+// The kernels below process the rows in the order of a LevelSchedule. All rows
+// of one level are independent and are split between the threads with
+// ThreadBlock, the threads synchronize after each level. Threads are only
+// used if the average level is large enough (\sa NumThreadsFor), otherwise
+// the rows are processed sequentially in level order. The results do not
+// depend on the number of threads.
+
+//! calls op(i) for all rows i of the schedule in level order (or reverse level order)
+template<typename TRowOp>
+void ForEachRowByLevel(const LevelSchedule &ls, TRowOp &op, bool bReverse = false)
+{
+	const size_t *rows = ls.rows();
+	const size_t numLevels = ls.num_levels();
+#ifdef UG_OPENMP
+	const int numThreads = NumThreadsFor((size_t) ls.average_level_size());
+	if(numThreads > 1)
+	{
+		std::vector<std::string> vErr(numThreads);
+		#pragma omp parallel num_threads(numThreads)
+		{
+			const int tid = ThreadID();
+			for(size_t ll = 0; ll < numLevels; ++ll)
+			{
+				const size_t l = bReverse ? numLevels - 1 - ll : ll;
+				size_t from, to;
+				ThreadBlock(ls.level_end(l) - ls.level_begin(l), from, to);
+				if(vErr[tid].empty())
+				{
+					try
+					{
+						for(size_t k = ls.level_begin(l) + from; k < ls.level_begin(l) + to; ++k)
+							op(rows[k]);
+					}
+					catch(UGError& err) {vErr[tid] = err.get_stacktrace();}
+					catch(std::exception& ex) {vErr[tid] = ex.what();}
+				}
+				#pragma omp barrier
+			}
+		}
+
+		for(int t = 0; t < numThreads; ++t)
+			if(!vErr[t].empty())
+				UG_THROW("ForEachRowByLevel: Error in thread " << t << ":\n" << vErr[t]);
+		return;
+	}
+#endif
+	for(size_t ll = 0; ll < numLevels; ++ll)
+	{
+		const size_t l = bReverse ? numLevels - 1 - ll : ll;
+		for(size_t k = ls.level_begin(l); k < ls.level_end(l); ++k)
+			op(rows[k]);
+	}
+}
+
+//! calls op(i) for all rows i in [0, n), threaded if the range is large enough
+template<typename TRowOp>
+void ForEachRow(size_t n, TRowOp &op)
+{
+#ifdef UG_OPENMP
+	const int numThreads = NumThreadsFor(n);
+	if(numThreads > 1)
+	{
+		#pragma omp parallel num_threads(numThreads)
+		{
+			size_t from, to;
+			ThreadBlock(n, from, to);
+			for(size_t i = from; i < to; ++i)
+				op(i);
+		}
+		return;
+	}
+#endif
+	for(size_t i = 0; i < n; ++i)
+		op(i);
+}
+
+//! row operation of FactorizeILUSorted_levels
+template<typename T>
+struct ILUFactorizeRowOp
+{
+	ILUFactorizeRowOp(SparseMatrix<T> &A_, number eps_) : A(A_), eps(eps_) {}
+	void operator()(size_t i) {FactorizeILURow_finalized(A, i, eps);}
+	SparseMatrix<T> &A;
+	number eps;
+};
+
+//! ILU(0) factorization over the levels of a lower LevelSchedule \sa FactorizeILUSorted
+/**
+ * \param ls	schedule computed by LevelSchedule::init_lower on the pattern of A
+ */
+template<typename T>
+bool FactorizeILUSorted_levels(SparseMatrix<T> *pA, const LevelSchedule &ls, const number eps)
+{
+	SparseMatrix<T> &A = *pA;
+	A.finalize();
+	if(ls.num_rows() != A.num_rows())
+		UG_THROW("FactorizeILUSorted_levels: Level schedule has "<<ls.num_rows()
+		         <<" rows, but matrix has "<<A.num_rows()<<" rows.");
+
+	ILUFactorizeRowOp<T> op(A, eps);
+	ForEachRowByLevel(ls, op);
+	return true;
+}
+
+//! row operation of invert_L_levels: x[i] = b[i] - sum_{j<i} A(i,j) x[j]
+template<typename T, typename Vector_type>
+struct ILUSolveLRowOp
+{
+	ILUSolveLRowOp(const SparseMatrix<T> &A, Vector_type &x_, const Vector_type &b_)
+		: rowStart(A.crs_row_start()), diag(A.crs_diag()), cols(A.crs_cols()),
+		  values(A.crs_values()), x(x_), b(b_) {}
+	void operator()(size_t i)
+	{
+		typename Vector_type::value_type s = b[i];
+		for(int k=rowStart[i]; k < diag[i]; ++k)
+			MatMultAdd(s, 1.0, s, -1.0, values[k], x[cols[k]]);
+		x[i] = s;
+	}
+	const int *rowStart, *diag, *cols;
+	const T *values;
+	Vector_type &x;
+	const Vector_type &b;
+};
+
+//! solves x = L^{-1} b over the levels of a lower LevelSchedule \sa invert_L
+template<typename T, typename Vector_type>
+bool invert_L_levels(const SparseMatrix<T> *pA, const LevelSchedule &ls,
+		Vector_type &x, const Vector_type &b)
+{
+	const SparseMatrix<T> &A = *pA;
+	if(!A.is_finalized() || ls.num_rows() != x.size()) return false;
+
+	ILUSolveLRowOp<T, Vector_type> op(A, x, b);
+	ForEachRowByLevel(ls, op);
+	return true;
+}
+
+//! row operation of invert_U_levels: x[i] = A(i,i)^{-1} (b[i] - sum_{j>i} A(i,j) x[j])
+template<typename T, typename Vector_type>
+struct ILUSolveURowOp
+{
+	ILUSolveURowOp(const SparseMatrix<T> &A_, Vector_type &x_, const Vector_type &b_,
+	               number eps_)
+		: A(A_), x(x_), b(b_), eps(eps_), result(true) {}
+	void operator()(size_t i)
+	{
+		typename Vector_type::value_type s = b[i];
+		FinalizedSubtractUpper(A, i, s, x);
+		const T &uii = FinalizedDiag(A, i);
+
+		// last row, see invert_U
+		if(i == x.size()-1 && BlockNorm(uii) <= eps * BlockNorm(s))
+		{
+			UG_LOG("ILU Warning: Near-zero last diagonal entry "
+					"with norm "<<BlockNorm(uii)<<" in U "
+					"for non-near-zero rhs entry with norm "
+					<< BlockNorm(s) << ". Setting rhs to zero.\n"
+					"NOTE: Reduce 'eps' using e.g. ILU::set_inversion_eps(...) "
+					"to avoid this warning. Current eps: " << eps << ".\n")
+			x[i] = 0;
+			result = false;
+		}
+		else
+			InverseMatMult(x[i], 1.0, uii, s);
+	}
+	const SparseMatrix<T> &A;
+	Vector_type &x;
+	const Vector_type &b;
+	number eps;
+	bool result;
+};
+
+//! solves x = U^{-1} b over the levels of an upper LevelSchedule \sa invert_U
+/**
+ * \param result	set to the return value of invert_U
+ * \return false if the matrix is not finalized
+ */
+template<typename T, typename Vector_type>
+bool invert_U_levels(const SparseMatrix<T> *pA, const LevelSchedule &ls,
+		Vector_type &x, const Vector_type &b, const number eps, bool &result)
+{
+	const SparseMatrix<T> &A = *pA;
+	if(!A.is_finalized() || ls.num_rows() != x.size()) return false;
+
+	ILUSolveURowOp<T, Vector_type> op(A, x, b, eps);
+	ForEachRowByLevel(ls, op);
+	result = op.result;
+	return true;
+}
+
+//! row operation of the Jacobi sweeps for L: xNew[i] = b[i] - sum_{j<i} A(i,j) xOld[j]
+template<typename T, typename Vector_type>
+struct ILUJacobiLRowOp
+{
+	ILUJacobiLRowOp(const SparseMatrix<T> &A, Vector_type &xNew_,
+	                const Vector_type &xOld_, const Vector_type &b_)
+		: rowStart(A.crs_row_start()), diag(A.crs_diag()), cols(A.crs_cols()),
+		  values(A.crs_values()), xNew(xNew_), xOld(xOld_), b(b_) {}
+	void operator()(size_t i)
+	{
+		typename Vector_type::value_type s = b[i];
+		for(int k=rowStart[i]; k < diag[i]; ++k)
+			MatMultAdd(s, 1.0, s, -1.0, values[k], xOld[cols[k]]);
+		xNew[i] = s;
+	}
+	const int *rowStart, *diag, *cols;
+	const T *values;
+	Vector_type &xNew;
+	const Vector_type &xOld;
+	const Vector_type &b;
+};
+
+//! row operation of the Jacobi sweeps for U: xNew[i] = A(i,i)^{-1} (b[i] - sum_{j>i} A(i,j) xOld[j])
+template<typename T, typename Vector_type>
+struct ILUJacobiURowOp
+{
+	ILUJacobiURowOp(const SparseMatrix<T> &A_, Vector_type &xNew_,
+	                const Vector_type &xOld_, const Vector_type &b_)
+		: A(A_), xNew(xNew_), xOld(xOld_), b(b_) {}
+	void operator()(size_t i)
+	{
+		typename Vector_type::value_type s = b[i];
+		FinalizedSubtractUpper(A, i, s, xOld);
+		InverseMatMult(xNew[i], 1.0, FinalizedDiag(A, i), s);
+	}
+	const SparseMatrix<T> &A;
+	Vector_type &xNew;
+	const Vector_type &xOld;
+	const Vector_type &b;
+};
+
+//! approximates x = L^{-1} b by Jacobi sweeps \sa invert_L
+/**
+ * Starting with x = b, each sweep computes x = b - (L-I) x for all rows
+ * concurrently. After n sweeps the result is exact for all rows with a
+ * level < n, i.e. numSweeps >= LevelSchedule::num_levels() gives the exact
+ * solution.
+ * \param tmp		help vector of size x.size()
+ */
+template<typename T, typename Vector_type>
+bool invert_L_jacobi(const SparseMatrix<T> *pA, Vector_type &x, const Vector_type &b,
+		size_t numSweeps, Vector_type &tmp)
+{
+	const SparseMatrix<T> &A = *pA;
+	if(!A.is_finalized()) return false;
+
+	for(size_t i = 0; i < x.size(); ++i)
+		x[i] = b[i];
+
+	Vector_type *pOld = &x, *pNew = &tmp;
+	for(size_t sweep = 0; sweep < numSweeps; ++sweep)
+	{
+		ILUJacobiLRowOp<T, Vector_type> op(A, *pNew, *pOld, b);
+		ForEachRow(x.size(), op);
+		std::swap(pOld, pNew);
+	}
+	if(pOld != &x)
+		for(size_t i = 0; i < x.size(); ++i)
+			x[i] = tmp[i];
+	return true;
+}
+
+//! approximates x = U^{-1} b by Jacobi sweeps \sa invert_U
+/**
+ * Starting with x = D^{-1} b, each sweep computes x = D^{-1}(b - (U-D) x) for
+ * all rows concurrently (D is the diagonal of U).
+ * \param tmp		help vector of size x.size()
+ */
+template<typename T, typename Vector_type>
+bool invert_U_jacobi(const SparseMatrix<T> *pA, Vector_type &x, const Vector_type &b,
+		size_t numSweeps, Vector_type &tmp)
+{
+	const SparseMatrix<T> &A = *pA;
+	if(!A.is_finalized()) return false;
+
+	for(size_t i = 0; i < x.size(); ++i)
+		InverseMatMult(x[i], 1.0, FinalizedDiag(A, i), b[i]);
+	Vector_type *pOld = &x, *pNew = &tmp;
+	for(size_t sweep = 0; sweep < numSweeps; ++sweep)
+	{
+		ILUJacobiURowOp<T, Vector_type> op(A, *pNew, *pOld, b);
+		ForEachRow(x.size(), op);
+		std::swap(pOld, pNew);
+	}
+	if(pOld != &x)
+		for(size_t i = 0; i < x.size(); ++i)
+			x[i] = tmp[i];
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Multicolor Gauss-Seidel kernels
+////////////////////////////////////////////////////////////////////////////////
+
+//! row operation of gs_step_multicolor_finalized
+/**
+ * Computes c[i] = relax * A(i,i)^{-1} (d[i] - sum A(i,j) c[j]) where the sum
+ * runs over all j with a smaller (forward) or larger (backward) color than i.
+ */
+template<typename T, typename Vector_type>
+struct MulticolorGSRowOp
+{
+	MulticolorGSRowOp(const SparseMatrix<T> &A_, const LevelSchedule &colors,
+	                  Vector_type &c_, const Vector_type &d_, number relax_, bool bBackward_)
+		: A(A_), color(colors.levels()), c(c_), d(d_), relax(relax_), bBackward(bBackward_) {}
+	void operator()(size_t i)
+	{
+		const int *rowStart = A.crs_row_start();
+		const int *cols = A.crs_cols();
+		const T *values = A.crs_values();
+
+		typename Vector_type::value_type s = d[i];
+		const size_t ci = color[i];
+		for(int k = rowStart[i]; k < rowStart[i+1]; ++k)
+		{
+			const size_t cj = color[cols[k]];
+			if(bBackward ? (cj > ci) : (cj < ci))
+				// s -= A(i,j) * c[j];
+				MatMultAdd(s, 1.0, s, -1.0, values[k], c[cols[k]]);
+		}
+		// c[i] = relaxFactor * s/A(i,i)
+		InverseMatMult(c[i], relax, FinalizedDiag(A, i), s);
+	}
+	const SparseMatrix<T> &A;
+	const size_t *color;
+	Vector_type &c;
+	const Vector_type &d;
+	number relax;
+	bool bBackward;
+};
+
+//! row operation c[i] = A(i,i) c[i] of sgs_step_multicolor_finalized
+template<typename T, typename Vector_type>
+struct DiagMultRowOp
+{
+	DiagMultRowOp(const SparseMatrix<T> &A_, Vector_type &c_) : A(A_), c(c_) {}
+	void operator()(size_t i)
+	{
+		typename Vector_type::value_type s = c[i];
+		MatMult(c[i], 1.0, FinalizedDiag(A, i), s);
+	}
+	const SparseMatrix<T> &A;
+	Vector_type &c;
+};
+
+//! multicolor (forward or backward) Gauss-Seidel step \sa gs_step_multicolor
+/**
+ * The colors are processed one after another, all rows of a color are
+ * computed concurrently.
+ */
+template<typename T, typename Vector_type>
+bool gs_step_multicolor_finalized(const SparseMatrix<T> *pA, const LevelSchedule &colors,
+		Vector_type &c, const Vector_type &d, const number relaxFactor, bool bBackward)
+{
+	const SparseMatrix<T> &A = *pA;
+	if(!A.is_finalized() || colors.num_rows() != c.size()) return false;
+
+	MulticolorGSRowOp<T, Vector_type> op(A, colors, c, d, relaxFactor, bBackward);
+	ForEachRowByLevel(colors, op, bBackward);
+	return true;
+}
+
+//! multicolor symmetric Gauss-Seidel step \sa sgs_step_multicolor
+template<typename T, typename Vector_type>
+bool sgs_step_multicolor_finalized(const SparseMatrix<T> *pA, const LevelSchedule &colors,
+		Vector_type &c, const Vector_type &d, const number relaxFactor)
+{
+	const SparseMatrix<T> &A = *pA;
+	if(!A.is_finalized() || colors.num_rows() != c.size()) return false;
+
+	// c1 = (D-L)^{-1} d
+	MulticolorGSRowOp<T, Vector_type> opL(A, colors, c, d, relaxFactor, false);
+	ForEachRowByLevel(colors, opL);
+
+	// c2 = D c1
+	DiagMultRowOp<T, Vector_type> opD(A, c);
+	ForEachRow(c.size(), opD);
+
+	// c3 = (D-U)^{-1} c2
+	MulticolorGSRowOp<T, Vector_type> opU(A, colors, c, c, relaxFactor, true);
+	ForEachRowByLevel(colors, opU, true);
+	return true;
+}
+
+// end group cpu_algebra
+/// \}
+
+} // namespace ug
+
+#endif /* __H__UG__CPU_ALGEBRA__SPARSEMATRIX_CRS_KERNELS__ */
@@ -53,6 +53,9 @@ SparseMatrix<T>::SparseMatrix()
 {
 	PROFILE_SPMATRIX(SparseMatrix_constructor);
 	bNeedsValues = true;
+	bFinalized = false;
+	m_patternRevision = 0;
+	m_transposedRevision = 0;
 	iIterators=0;
 	nnz = 0;
 	m_numCols = 0;
@@ -73,6 +76,12 @@ void SparseMatrix<T>::clear_and_free()
 	std::vector<int>().swap(cols);
 	std::vector<value_type>().swap(values);
 	maxValues = 0;
+	bFinalized = false;
+	std::vector<int>().swap(diagIndex);
+	std::vector<int>().swap(m_vTransposedStart);
+	std::vector<int>().swap(m_vTransposedPos);
+	std::vector<int>().swap(m_vTransposedRow);
+	m_transposedRevision = 0;
 
 #ifdef CHECK_ROW_ITERATORS
 	std::vector<int>().swap(nrOfRowIterators);
@@ -94,6 +103,8 @@ void SparseMatrix<T>::resize_and_clear(size_t newRows, size_t newCols)
 	values.clear();
 	if(bNeedsValues) values.resize(newRows);
 	maxValues = 0;
+	bFinalized = false;
+	diagIndex.clear();
 
 #ifdef CHECK_ROW_ITERATORS
 	nrOfRowIterators.clear();
@@ -109,6 +120,8 @@ void SparseMatrix<T>::resize_and_keep_values(size_t newRows, size_t newCols)
 	if(newRows == 0 && newCols == 0)
 		return resize_and_clear(0,0);
 
+	unfinalize();
+
 	if(newRows != num_rows())
 	{
 		size_t oldrows = num_rows();
@@ -187,7 +200,29 @@ template<typename vector_t>
 void SparseMatrix<T>::apply_ignore_zero_rows(vector_t &dest,
 		const number &beta1, const vector_t &w1) const
 {
-	for(size_t i=0; i < num_rows(); i++)
+#ifdef UG_OPENMP
+	const int numThreads = NumThreadsFor(num_rows());
+	if(numThreads > 1)
+	{
+		#pragma omp parallel num_threads(numThreads)
+		{
+			size_t rowFrom, rowTo;
+			ThreadBlock(num_rows(), rowFrom, rowTo);
+			apply_ignore_zero_rows_rows(dest, beta1, w1, rowFrom, rowTo);
+		}
+		return;
+	}
+#endif
+	apply_ignore_zero_rows_rows(dest, beta1, w1, 0, num_rows());
+}
+
+template<typename T>
+template<typename vector_t>
+void SparseMatrix<T>::apply_ignore_zero_rows_rows(vector_t &dest,
+		const number &beta1, const vector_t &w1,
+		size_t rowFrom, size_t rowTo) const
+{
+	for(size_t i=rowFrom; i < rowTo; i++)
 	{
 		size_t rowIt=rowStart[i];
 		size_t itEnd=rowEnd[i];
@@ -211,45 +246,92 @@ void SparseMatrix<T>::axpy(vector_t &dest,
 {
 	PROFILE_SPMATRIX(SparseMatrix_axpy);
 	check_fragmentation();
-	if(alpha1 == 0.0)
+#ifdef UG_OPENMP
+	// every row is computed by exactly one thread, so the result does not
+	// depend on the number of threads
+	const int numThreads = NumThreadsFor(num_rows());
+	if(numThreads > 1)
 	{
-		for(size_t i=0; i < num_rows(); i++)
+		#pragma omp parallel num_threads(numThreads)
 		{
-			size_t rowIt=rowStart[i];
-			size_t itEnd=rowEnd[i];
-			if(rowIt == itEnd)
-			{
-				dest[i] = 0.0;
-				continue;
-			}
-			MatMult(dest[i], beta1, values[rowIt], w1[cols[rowIt]]);
-			for(++rowIt; rowIt != itEnd; ++rowIt)
-				// res[i] += conn.value() * x[conn.index()];
-				MatMultAdd(dest[i], 1.0, dest[i], beta1, values[rowIt], w1[cols[rowIt]]);
+			size_t rowFrom, rowTo;
+			ThreadBlock(num_rows(), rowFrom, rowTo);
+			axpy_rows(dest, alpha1, v1, beta1, w1, rowFrom, rowTo);
 		}
+		return;
 	}
-	else if(&dest == &v1)
+#endif
+	axpy_rows(dest, alpha1, v1, beta1, w1, 0, num_rows());
+}
+
+template<typename T>
+template<typename vector_t>
+inline void SparseMatrix<T>::axpy_row(vector_t &dest,
+		const number &alpha1, const vector_t &v1,
+		const number &beta1, const vector_t &w1,
+		size_t i, const int *pRowEnd) const
+{
+	size_t rowIt=rowStart[i];
+	size_t itEnd=pRowEnd[i];
+	if(alpha1 == 0.0)
 	{
-		if(alpha1 != 1.0) {
-			for(size_t i=0; i < num_rows(); i++)
-			{
-				dest[i] *= alpha1;
-				mat_mult_add_row(i, dest[i], beta1, w1);
-			}
+		if(rowIt == itEnd)
+		{
+			dest[i] = 0.0;
+			return;
 		}
-		else
-			for(size_t i=0; i < num_rows(); i++)
-				mat_mult_add_row(i, dest[i], beta1, w1);
-
+		MatMult(dest[i], beta1, values[rowIt], w1[cols[rowIt]]);
+		++rowIt;
 	}
-	else
+	else if(&dest != &v1)
+		VecScaleAssign(dest[i], alpha1, v1[i]);
+	else if(alpha1 != 1.0)
+		dest[i] *= alpha1;
+
+	for(; rowIt != itEnd; ++rowIt)
+		// res[i] += conn.value() * x[conn.index()];
+		MatMultAdd(dest[i], 1.0, dest[i], beta1, values[rowIt], w1[cols[rowIt]]);
+}
+
+template<typename T>
+template<typename vector_t>
+void SparseMatrix<T>::axpy_rows(vector_t &dest,
+		const number &alpha1, const vector_t &v1,
+		const number &beta1, const vector_t &w1,
+		size_t rowFrom, size_t rowTo) const
+{
+	// for finalized matrices, this is rowStart+1
+	const int *pRowEnd = row_end_array();
+	for(size_t i=rowFrom; i < rowTo; i++)
+		axpy_row(dest, alpha1, v1, beta1, w1, i, pRowEnd);
+}
+
+template<typename T>
+template<typename vector_t>
+void SparseMatrix<T>::axpy_row_list(vector_t &dest,
+		const number &alpha1, const vector_t &v1,
+		const number &beta1, const vector_t &w1,
+		const size_t *rows, size_t numRows) const
+{
+	PROFILE_SPMATRIX(SparseMatrix_axpy_row_list);
+	check_fragmentation();
+	const int *pRowEnd = row_end_array();
+#ifdef UG_OPENMP
+	const int numThreads = NumThreadsFor(numRows);
+	if(numThreads > 1)
 	{
-		for(size_t i=0; i < num_rows(); i++)
+		#pragma omp parallel num_threads(numThreads)
 		{
-			VecScaleAssign(dest[i], alpha1, v1[i]);
-			mat_mult_add_row(i, dest[i], beta1, w1);
+			size_t from, to;
+			ThreadBlock(numRows, from, to);
+			for(size_t k=from; k < to; k++)
+				axpy_row(dest, alpha1, v1, beta1, w1, rows[k], pRowEnd);
 		}
+		return;
 	}
+#endif
+	for(size_t k=0; k < numRows; k++)
+		axpy_row(dest, alpha1, v1, beta1, w1, rows[k], pRowEnd);
 }
 
 // calculate dest = alpha1*v1 + beta1*A^T*w1 (A = this matrix)
@@ -261,6 +343,34 @@ void SparseMatrix<T>::axpy_transposed(vector_t &dest,
 {
 	PROFILE_SPMATRIX(SparseMatrix_axpy_transposed);
 	check_fragmentation();
+#ifdef UG_OPENMP
+	// the entries of dest are split among the threads. every thread adds
+	// the contributions to its entries in the same row order as the serial
+	// loop below, so the result is bitwise the same for all thread numbers.
+	// the connections of each column are taken from the transposed index,
+	// thus every thread only visits the connections of its own columns.
+	const int numThreads = bFinalized ? NumThreadsFor(dest.size()) : 1;
+	if(numThreads > 1)
+	{
+		update_transposed_index();
+		#pragma omp parallel num_threads(numThreads)
+		{
+			size_t colBegin, colEnd;
+			ThreadBlock(dest.size(), colBegin, colEnd);
+			for(size_t c=colBegin; c<colEnd; c++)
+			{
+				if(alpha1 == 0.0)
+					dest[c] = 0.0;
+				else if(&dest != &v1)
+					VecScaleAssign(dest[c], alpha1, v1[c]);
+				else if(alpha1 != 1.0)
+					dest[c] *= alpha1;
+			}
+			mat_mult_transposed_add_cols(dest, beta1, w1, colBegin, colEnd);
+		}
+		return;
+	}
+#endif
 	if(&dest == &v1) {
 		if(alpha1 == 0.0)
 			dest.set(0.0);
@@ -272,38 +382,108 @@ void SparseMatrix<T>::axpy_transposed(vector_t &dest,
 	else
 		VecScaleAssign(dest, alpha1, v1);
 
+	mat_mult_transposed_add(dest, beta1, w1);
+}
+
+template<typename T>
+template<typename vector_t>
+void SparseMatrix<T>::mat_mult_transposed_add(vector_t &dest,
+		const number &beta1, const vector_t &w1) const
+{
 	for(size_t i=0; i<num_rows(); i++)
 	{
-
-		size_t itEnd=rowEnd[i];
-		for(size_t rowIt=rowStart[i]; rowIt != itEnd; ++rowIt)
+		if(rowStart[i] == -1) continue;
+		size_t itEnd = rowEnd[i];
+		for(size_t rowIt = rowStart[i]; rowIt != itEnd; ++rowIt)
 			// dest[conn.index()] += beta1 * conn.value() * w1[i];
 			if(values[rowIt] != 0.0)
 				MatMultTransposedAdd(dest[cols[rowIt]], 1.0, dest[cols[rowIt]], beta1, values[rowIt], w1[i]);
 	}
 }
 
+template<typename T>
+template<typename vector_t>
+void SparseMatrix<T>::mat_mult_transposed_add_cols(vector_t &dest,
+		const number &beta1, const vector_t &w1,
+		size_t colBegin, size_t colEnd) const
+{
+	UG_ASSERT(m_transposedRevision == m_patternRevision && bFinalized,
+			"transposed index not up to date.");
+	colEnd = std::min(colEnd, num_cols());
+	for(size_t c=colBegin; c<colEnd; c++)
+	{
+		const int kEnd = m_vTransposedStart[c+1];
+		for(int k = m_vTransposedStart[c]; k < kEnd; ++k)
+		{
+			const int pos = m_vTransposedPos[k];
+			if(values[pos] != 0.0)
+				MatMultTransposedAdd(dest[c], 1.0, dest[c], beta1, values[pos], w1[m_vTransposedRow[k]]);
+		}
+	}
+}
+
+template<typename T>
+void SparseMatrix<T>::update_transposed_index() const
+{
+	UG_ASSERT(bFinalized, "transposed index only for finalized matrices.");
+	if(m_transposedRevision == m_patternRevision) return;
+	PROFILE_SPMATRIX(SparseMatrix_update_transposed_index);
+
+	// count the connections of each column
+	m_vTransposedStart.assign(num_cols()+1, 0);
+	for(size_t i=0; i<num_rows(); i++)
+		for(int rowIt = rowStart[i]; rowIt < rowEnd[i]; ++rowIt)
+			m_vTransposedStart[cols[rowIt]+1]++;
+	for(size_t c=0; c<num_cols(); c++)
+		m_vTransposedStart[c+1] += m_vTransposedStart[c];
+
+	// fill in row order, so that the connections of each column are sorted by row
+	const size_t numConn = m_vTransposedStart[num_cols()];
+	m_vTransposedPos.resize(numConn);
+	m_vTransposedRow.resize(numConn);
+	std::vector<int> vNext(m_vTransposedStart.begin(), m_vTransposedStart.end()-1);
+	for(size_t i=0; i<num_rows(); i++)
+		for(int rowIt = rowStart[i]; rowIt < rowEnd[i]; ++rowIt)
+		{
+			const int k = vNext[cols[rowIt]]++;
+			m_vTransposedPos[k] = rowIt;
+			m_vTransposedRow[k] = (int)i;
+		}
+
+	m_transposedRevision = m_patternRevision;
+}
+
 
 template<typename T>
 template<typename vector_t>
 void SparseMatrix<T>::apply_transposed_ignore_zero_rows(vector_t &dest,
 		const number &beta1, const vector_t &w1) const
 {
+#ifdef UG_OPENMP
+	const int numThreads = bFinalized ? NumThreadsFor(dest.size()) : 1;
+	if(numThreads > 1)
+	{
+		update_transposed_index();
+		#pragma omp parallel num_threads(numThreads)
+		{
+			size_t colBegin, colEnd;
+			ThreadBlock(dest.size(), colBegin, colEnd);
+			for(size_t c=colBegin; c<std::min(colEnd, num_cols()); c++)
+				if(m_vTransposedStart[c] != m_vTransposedStart[c+1])
+					dest[c] = 0.0;
+			mat_mult_transposed_add_cols(dest, beta1, w1, colBegin, colEnd);
+		}
+		return;
+	}
+#endif
 	for(size_t i=0; i<num_rows(); i++)
 	{
-		row_iterator itEnd = end_row(i);
+		const_row_iterator itEnd = end_row(i);
 		for(const_row_iterator conn = begin_row(i); conn != itEnd; ++conn)
 			dest[conn.index()] = 0.0;
 	}
 
-	for(size_t i=0; i<num_rows(); i++)
-	{
-		size_t itEnd=rowEnd[i];
-		for(size_t rowIt=rowStart[i]; rowIt != itEnd; ++rowIt)
-			// dest[conn.index()] += beta1 * conn.value() * w1[i];
-			if(values[rowIt] != 0.0)
-				MatMultTransposedAdd(dest[cols[rowIt]], 1.0, dest[cols[rowIt]], beta1, values[rowIt], w1[i]);
-	}
+	mat_mult_transposed_add(dest, beta1, w1);
 }
 
 
@@ -513,6 +693,7 @@ int SparseMatrix<T>::get_index(int r, int c)
 //	UG_LOG(rowStart[r] << " - " << rowMax[r] << " - " << rowEnd[r] << " - " << cols.size() << " - "  << maxValues << "\n");
 	if(rowStart[r] == -1 || rowStart[r] == rowEnd[r])
 	{
+		unfinalize();
 //		UG_LOG("new row\n");
 		// row did not start, start new row at the end of cols array
 		assureValuesSize(maxValues+1);
@@ -543,6 +724,7 @@ int SparseMatrix<T>::get_index(int r, int c)
 	// we did not find it, so we have to add it
 
 	check_row_modifiable(r);
+	unfinalize();
 
 #ifndef NDEBUG
 	assert(index == rowEnd[r] || cols[index] > c);
@@ -613,6 +795,41 @@ int SparseMatrix<T>::get_index(int r, int c)
 
 }
 
+template<typename T>
+void SparseMatrix<T>::finalize()
+{
+	if(bFinalized) return;
+	PROFILE_SPMATRIX(SparseMatrix_finalize);
+	UG_ASSERT(iIterators == 0, "cannot finalize while iterators are in use.");
+
+	// compact all rows, so that rowStart[r+1] == rowEnd[r]
+	if(num_rows() != 0 && num_cols() != 0)
+		copyToNewSize(nnz);
+	else
+		for(size_t r=0; r<num_rows(); r++)
+			rowStart[r] = rowEnd[r] = rowMax[r] = 0;
+	rowStart[num_rows()] = (num_rows() == 0) ? 0 : rowEnd[num_rows()-1];
+
+	// the pattern is fixed now, rowMax is not needed
+	std::vector<int>().swap(rowMax);
+
+	bFinalized = true;
+	m_patternRevision = NextSparseMatrixPatternRevision();
+	diagIndex.resize(num_rows());
+	for(size_t r=0; r<num_rows(); r++)
+		diagIndex[r] = cols.empty() ? rowStart[r] : lower_bound_in_row(r, r);
+}
+
+template<typename T>
+void SparseMatrix<T>::unfinalize()
+{
+	if(!bFinalized) return;
+	PROFILE_SPMATRIX(SparseMatrix_unfinalize);
+	rowMax = rowEnd;
+	std::vector<int>().swap(diagIndex);
+	bFinalized = false;
+}
+
 template<typename T>
 void SparseMatrix<T>::copyToNewSize(size_t newSize, size_t maxCol)
 {
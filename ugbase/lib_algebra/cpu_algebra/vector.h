@@ -222,6 +222,9 @@ protected:
 private:
 	void destroy();
 
+	//! with UG_OPENMP, initializes the values using the thread partition of the threaded kernels
+	void first_touch();
+
 	size_t m_size;			///< size of the vector (vector is from 0..size-1)
 	size_t m_capacity;		///< size of the vector (vector is from 0..size-1)
 	value_type *values;		///< array where the values are stored, size m_size
@@ -39,6 +39,7 @@
 #include "algebra_misc.h"
 #include "common/math/ugmath.h"
 #include "vector.h" // for urand
+#include "vector_kernels.h"
 
 #define prefetchReadWrite(a)
 
@@ -73,9 +74,7 @@ inline double Vector<value_type>::dotprod(const Vector &w) //const
 {
 	UG_ASSERT(m_size == w.m_size,  *this << " has not same size as " << w);
 
-	double sum=0;
-	for(size_t i=0; i<m_size; i++)	sum += VecProd(values[i], w[i]);
-	return sum;
+	return VecProd(*this, w);
 }
 
 // assign double to whole Vector
@@ -162,6 +161,7 @@ void Vector<value_type>::create(size_t size)
 	m_size = size;
 	values = new value_type[size];
 	m_capacity = size;
+	first_touch();
 }
 
 
@@ -195,6 +195,28 @@ void Vector<value_type>::reserve_exactly(size_t newCapacity, bool bCopyValues)
 	UG_ASSERT(newCapacity >= m_size, "use resize, then reserve_exactly");
 	value_type *new_values = new value_type[newCapacity];	
 	// we cannot use memcpy here bcs of variable blocks.
+#ifdef UG_OPENMP
+	// copy with the same thread partition as the threaded kernels
+	// (first touch), so that the pages are local to the thread using them
+	const int numThreads = NumThreadsFor(newCapacity);
+	if(numThreads > 1)
+	{
+		const bool bCopy = (values != NULL && bCopyValues);
+		#pragma omp parallel num_threads(numThreads)
+		{
+			size_t from, to;
+			ThreadBlock(newCapacity, from, to);
+			for(size_t i=from; i<to; i++)
+			{
+				if(bCopy && i < m_size)
+					std::swap(new_values[i], values[i]);
+				else
+					new_values[i] = 0.0;
+			}
+		}
+	}
+	else
+#endif
 	if(values != NULL && bCopyValues)
 	{
 		for(size_t i=0; i<m_size; i++)
@@ -208,6 +230,24 @@ void Vector<value_type>::reserve_exactly(size_t newCapacity, bool bCopyValues)
 }
 
 
+template<typename value_type>
+void Vector<value_type>::first_touch()
+{
+#ifdef UG_OPENMP
+	const int numThreads = NumThreadsFor(m_size);
+	if(numThreads > 1)
+	{
+		#pragma omp parallel num_threads(numThreads)
+		{
+			size_t from, to;
+			ThreadBlock(m_size, from, to);
+			for(size_t i=from; i<to; i++)
+				values[i] = 0.0;
+		}
+	}
+#endif
+}
+
 template<typename value_type>
 void Vector<value_type>::reserve_sloppy(size_t newCapacity, bool bCopyValues)
 {
@@ -322,10 +362,7 @@ double operator *(const TRANSPOSED<Vector<value_type> > &x, const Vector<value_t
 template<typename value_type>
 inline double Vector<value_type>::norm() const
 {
-	double d=0;
-	for(size_t i=0; i<size(); ++i)
-		d+=BlockNorm2(values[i]);
-	return sqrt(d);
+	return sqrt(VecNormSquared(*this));
 }
 
 template<typename value_type>
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__CPU_ALGEBRA__VECTOR_KERNELS__
+#define __H__UG__CPU_ALGEBRA__VECTOR_KERNELS__
+
+#include "common/util/omp_util.h"
+#include "../common/operations_vec.h"
+
+namespace ug{
+
+/// \addtogroup cpu_algebra
+///	@{
+
+// BLAS-1 kernels for Vector. The generic functions in operations_vec.h loop
+// over the entries of any vector type. The overloads here are more
+// specialized, so they are chosen for Vector (and, via the forwarding
+// functions in parallel_vector_impl.h, for ParallelVector<Vector>). They
+// split the index range into contiguous ThreadBlocks (\sa omp_util.h), so that
+// each thread works on the part of the vector it touched first. The loops
+// run over contiguous arrays, which the compiler can vectorize.
+//
+// All of these kernels are bandwidth-bound. The fused kernels therefore
+// combine several updates and reductions into one pass over memory. Their
+// reductions return the process-local values.
+
+template<typename T> class Vector;
+
+//! block op for dest = alpha1*v1
+template<typename T>
+struct VecScaleAssignBlockOp
+{
+	VecScaleAssignBlockOp(Vector<T> &dest_, double alpha1_, const Vector<T> &v1_)
+		: dest(dest_), alpha1(alpha1_), v1(v1_) {}
+	void operator()(size_t begin, size_t end)
+	{
+		for(size_t i = begin; i < end; ++i)
+			VecScaleAssign(dest[i], alpha1, v1[i]);
+	}
+	Vector<T> &dest; const double alpha1; const Vector<T> &v1;
+};
+
+//! block op for dest = alpha1*v1 + alpha2*v2
+template<typename T>
+struct VecScaleAdd2BlockOp
+{
+	VecScaleAdd2BlockOp(Vector<T> &dest_, double alpha1_, const Vector<T> &v1_,
+	                    double alpha2_, const Vector<T> &v2_)
+		: dest(dest_), alpha1(alpha1_), v1(v1_), alpha2(alpha2_), v2(v2_) {}
+	void operator()(size_t begin, size_t end)
+	{
+		for(size_t i = begin; i < end; ++i)
+			VecScaleAdd(dest[i], alpha1, v1[i], alpha2, v2[i]);
+	}
+	Vector<T> &dest; const double alpha1; const Vector<T> &v1;
+	const double alpha2; const Vector<T> &v2;
+};
+
+//! block op for dest = alpha1*v1 + alpha2*v2 + alpha3*v3
+template<typename T>
+struct VecScaleAdd3BlockOp
+{
+	VecScaleAdd3BlockOp(Vector<T> &dest_, double alpha1_, const Vector<T> &v1_,
+	                    double alpha2_, const Vector<T> &v2_, double alpha3_, const Vector<T> &v3_)
+		: dest(dest_), alpha1(alpha1_), v1(v1_), alpha2(alpha2_), v2(v2_), alpha3(alpha3_), v3(v3_) {}
+	void operator()(size_t begin, size_t end)
+	{
+		for(size_t i = begin; i < end; ++i)
+			VecScaleAdd(dest[i], alpha1, v1[i], alpha2, v2[i], alpha3, v3[i]);
+	}
+	Vector<T> &dest; const double alpha1; const Vector<T> &v1;
+	const double alpha2; const Vector<T> &v2; const double alpha3; const Vector<T> &v3;
+};
+
+//! block op for sum = (a,b)
+template<typename T>
+struct VecProdBlockOp
+{
+	VecProdBlockOp(const Vector<T> &a_, const Vector<T> &b_) : a(a_), b(b_) {}
+	void operator()(size_t begin, size_t end, double *sum)
+	{
+		double s = 0.0;
+		for(size_t i = begin; i < end; ++i)
+			VecProdAdd(a[i], b[i], s);
+		*sum = s;
+	}
+	const Vector<T> &a; const Vector<T> &b;
+};
+
+//! block op for sum = |a|^2
+template<typename T>
+struct VecNormSquaredBlockOp
+{
+	VecNormSquaredBlockOp(const Vector<T> &a_) : a(a_) {}
+	void operator()(size_t begin, size_t end, double *sum)
+	{
+		double s = 0.0;
+		for(size_t i = begin; i < end; ++i)
+			s += BlockNorm2(a[i]);
+		*sum = s;
+	}
+	const Vector<T> &a;
+};
+
+//! block op for x = x + alpha*p, r = r + beta*q and (optionally) sum = |r|^2
+template<typename T>
+struct VecScaleAddPairBlockOp
+{
+	VecScaleAddPairBlockOp(Vector<T> &x_, double alpha_, const Vector<T> &p_,
+	                       Vector<T> &r_, double beta_, const Vector<T> &q_)
+		: x(x_), alpha(alpha_), p(p_), r(r_), beta(beta_), q(q_) {}
+	void operator()(size_t begin, size_t end)
+	{
+		for(size_t i = begin; i < end; ++i)
+		{
+			VecScaleAdd(x[i], 1.0, x[i], alpha, p[i]);
+			VecScaleAdd(r[i], 1.0, r[i], beta, q[i]);
+		}
+	}
+	void operator()(size_t begin, size_t end, double *sum)
+	{
+		double s = 0.0;
+		for(size_t i = begin; i < end; ++i)
+		{
+			VecScaleAdd(x[i], 1.0, x[i], alpha, p[i]);
+			VecScaleAdd(r[i], 1.0, r[i], beta, q[i]);
+			s += BlockNorm2(r[i]);
+		}
+		*sum = s;
+	}
+	Vector<T> &x; const double alpha; const Vector<T> &p;
+	Vector<T> &r; const double beta; const Vector<T> &q;
+};
+
+//! block op for dest = alpha1*v1 + alpha2*v2, sum = ((dest,dest), (dest,w))
+template<typename T>
+struct VecScaleAddProdBlockOp
+{
+	VecScaleAddProdBlockOp(Vector<T> &dest_, double alpha1_, const Vector<T> &v1_,
+	                       double alpha2_, const Vector<T> &v2_, const Vector<T> &w_)
+		: dest(dest_), alpha1(alpha1_), v1(v1_), alpha2(alpha2_), v2(v2_), w(w_) {}
+	void operator()(size_t begin, size_t end, double *sum)
+	{
+		double s0 = 0.0, s1 = 0.0;
+		for(size_t i = begin; i < end; ++i)
+		{
+			VecScaleAdd(dest[i], alpha1, v1[i], alpha2, v2[i]);
+			s0 += BlockNorm2(dest[i]);
+			VecProdAdd(dest[i], w[i], s1);
+		}
+		sum[0] = s0; sum[1] = s1;
+	}
+	Vector<T> &dest; const double alpha1; const Vector<T> &v1;
+	const double alpha2; const Vector<T> &v2; const Vector<T> &w;
+};
+
+
+//! calculates dest = alpha1*v1
+template<typename T>
+inline void VecScaleAssign(Vector<T> &dest, double alpha1, const Vector<T> &v1)
+{
+	VecScaleAssignBlockOp<T> op(dest, alpha1, v1);
+	ForEachIndexBlock(dest.size(), op);
+}
+
+//! calculates dest = alpha1*v1 + alpha2*v2
+template<typename T>
+inline void VecScaleAdd(Vector<T> &dest, double alpha1, const Vector<T> &v1,
+                        double alpha2, const Vector<T> &v2)
+{
+	VecScaleAdd2BlockOp<T> op(dest, alpha1, v1, alpha2, v2);
+	ForEachIndexBlock(dest.size(), op);
+}
+
+//! calculates dest = alpha1*v1 + alpha2*v2 + alpha3*v3
+template<typename T>
+inline void VecScaleAdd(Vector<T> &dest, double alpha1, const Vector<T> &v1,
+                        double alpha2, const Vector<T> &v2,
+                        double alpha3, const Vector<T> &v3)
+{
+	VecScaleAdd3BlockOp<T> op(dest, alpha1, v1, alpha2, v2, alpha3, v3);
+	ForEachIndexBlock(dest.size(), op);
+}
+
+//! calculates s += scal<a, b>
+template<typename T>
+inline void VecProd(const Vector<T> &a, const Vector<T> &b, double &sum)
+{
+	VecProdBlockOp<T> op(a, b);
+	double s;
+	SumOverIndexBlocks(a.size(), op, 1, &s);
+	sum += s;
+}
+
+//! returns scal<a, b>
+template<typename T>
+inline double VecProd(const Vector<T> &a, const Vector<T> &b)
+{
+	double sum = 0.0;
+	VecProd(a, b, sum);
+	return sum;
+}
+
+//! calculates s += norm_2^2(a)
+template<typename T>
+inline void VecNormSquaredAdd(const Vector<T> &a, double &sum)
+{
+	VecNormSquaredBlockOp<T> op(a);
+	double s;
+	SumOverIndexBlocks(a.size(), op, 1, &s);
+	sum += s;
+}
+
+//! returns norm_2^2(a)
+template<typename T>
+inline double VecNormSquared(const Vector<T> &a)
+{
+	double sum = 0.0;
+	VecNormSquaredAdd(a, sum);
+	return sum;
+}
+
+//! calculates x = x + alpha*p and r = r + beta*q in one pass
+template<typename T>
+inline void VecScaleAddPair(Vector<T> &x, double alpha, const Vector<T> &p,
+                            Vector<T> &r, double beta, const Vector<T> &q)
+{
+	VecScaleAddPairBlockOp<T> op(x, alpha, p, r, beta, q);
+	ForEachIndexBlock(x.size(), op);
+}
+
+//! calculates x = x + alpha*p, r = r + beta*q in one pass and returns norm_2^2(r)
+template<typename T>
+inline double VecScaleAddPairNormSquared(Vector<T> &x, double alpha, const Vector<T> &p,
+                                         Vector<T> &r, double beta, const Vector<T> &q)
+{
+	VecScaleAddPairBlockOp<T> op(x, alpha, p, r, beta, q);
+	double s;
+	SumOverIndexBlocks(x.size(), op, 1, &s);
+	return s;
+}
+
+//! calculates dest = alpha1*v1 + alpha2*v2 together with norm_2^2(dest) and scal<dest, w>
+template<typename T>
+inline void VecScaleAddProd(Vector<T> &dest, double alpha1, const Vector<T> &v1,
+                            double alpha2, const Vector<T> &v2, const Vector<T> &w,
+                            double &destNorm2, double &destProdW)
+{
+	VecScaleAddProdBlockOp<T> op(dest, alpha1, v1, alpha2, v2, w);
+	double s[2];
+	SumOverIndexBlocks(dest.size(), op, 2, s);
+	destNorm2 = s[0]; destProdW = s[1];
+}
+
+// end group cpu_algebra
+/// \}
+
+} // end namespace ug
+
+#endif /* __H__UG__CPU_ALGEBRA__VECTOR_KERNELS__ */
@@ -85,6 +85,7 @@ class AlgebraicConvCheck : public IConvergenceCheck<TVector>
 		void start(const TVector& d);
 		void update_defect(number newDefect);
 		void update(const TVector& d);
+		void correct(const TVector& d);
 		bool iteration_ended();
 		bool post();
 
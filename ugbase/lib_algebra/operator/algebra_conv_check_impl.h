@@ -223,6 +223,14 @@ void AlgebraicConvCheck<TVector>::update(const TVector& vec)
 }
 
 
+template <class TVector>
+void AlgebraicConvCheck<TVector>::correct(const TVector& vec)
+{
+	for (size_t fct = 0; fct < m_vCmpInfo.size(); fct++)
+		m_vCmpInfo[fct].currDefect = norm(vec, fct);
+}
+
+
 template <class TVector>
 bool AlgebraicConvCheck<TVector>::iteration_ended()
 {
@@ -83,6 +83,15 @@ class IConvergenceCheck
 		/// computes the defect and sets it a the next defect value
 		virtual void update(const TVector& d) = 0;
 
+		/// computes the defect and replaces the current defect value by it
+		/**	No step is counted. Solvers use this if the current defect has been
+		 * set to an estimate and the true defect is computed afterwards.*/
+		virtual void correct(const TVector& d) = 0;
+
+		/// returns true if update(d) is the same as update_defect(||d||) (analogously for start)
+		/** Solvers may then compute the norm together with other reductions. */
+		virtual bool defect_is_norm() const {return false;}
+
 		/** iteration_ended
 		 *
 		 *	Checks if the iteration must be ended.
@@ -198,6 +207,10 @@ class StdConvCheck : public IConvergenceCheck<TVector>
 
 		void update(const TVector& d);
 
+		void correct(const TVector& d);
+
+		virtual bool defect_is_norm() const {return true;}
+
 		bool iteration_ended();
 
 		bool post();
@@ -235,6 +248,9 @@ class StdConvCheck : public IConvergenceCheck<TVector>
 	protected:
 		void print_offset();
 
+		/// replaces the current defect without counting a step
+		void correct_defect(number newDefect);
+
 		bool is_valid_number(number value);
 
 	protected:
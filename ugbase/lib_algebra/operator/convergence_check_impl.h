@@ -158,6 +158,22 @@ void StdConvCheck<TVector>::update(const TVector& d)
 	update_defect(d.norm());
 }
 
+template <typename TVector>
+void StdConvCheck<TVector>::correct_defect(number newDefect)
+{
+	if(m_currentDefect != 0.0) m_ratesProduct *= newDefect/m_currentDefect;
+	m_currentDefect = newDefect;
+
+	if(m_verbose && !_defects.empty())
+		_defects.back() = newDefect;
+}
+
+template <typename TVector>
+void StdConvCheck<TVector>::correct(const TVector& d)
+{
+	correct_defect(d.norm());
+}
+
 template <typename TVector>
 bool StdConvCheck<TVector>::iteration_ended()
 {
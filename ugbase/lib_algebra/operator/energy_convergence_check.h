@@ -66,6 +66,11 @@ class EnergyConvCheck : public StdConvCheck<TVector>
 	{
 		base_type::update_defect(energy_norm(d));
 	}
+	void correct(const TVector& d)
+	{
+		base_type::correct_defect(energy_norm(d));
+	}
+	virtual bool defect_is_norm() const {return false;}
 
 	double energy_norm(const TVector &d)
 	{
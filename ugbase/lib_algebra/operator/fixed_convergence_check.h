@@ -69,6 +69,12 @@ class FixedConvergenceCheck : public IConvergenceCheck<TVector>
 			m_currentStep++;
 		}
 
+		/// the defect is not used at all
+		virtual void correct(const TVector& d) {}
+
+		/// the defect is not used at all
+		virtual bool defect_is_norm() const {return true;}
+
 		/** iteration_ended
 		 *
 		 *	Checks if the iteration must be ended.
@@ -123,20 +123,23 @@ class IPreconditioner :
 	public:
 	///	default constructor
 		IPreconditioner() :
-			m_spDefectOperator(NULL), m_spApproxOperator(NULL), m_bInit(false), m_bOtherApproxOperator(false)
+			m_spDefectOperator(NULL), m_spApproxOperator(NULL), m_bInit(false), m_bOtherApproxOperator(false),
+			m_bNumericReinit(false)
 		{};
 
 	///	constructor setting debug writer
 		IPreconditioner(SmartPtr<IDebugWriter<algebra_type> > spDebugWriter) :
 			DebugWritingObject<TAlgebra>(spDebugWriter),
-			m_spDefectOperator(NULL), m_spApproxOperator(NULL), m_bInit(false), m_bOtherApproxOperator(false)
+			m_spDefectOperator(NULL), m_spApproxOperator(NULL), m_bInit(false), m_bOtherApproxOperator(false),
+			m_bNumericReinit(false)
 		{};
 
 	/// clone constructor
 		IPreconditioner( const IPreconditioner<TAlgebra> &parent ) :
 			ILinearIterator<vector_type>(parent),
 			DebugWritingObject<TAlgebra>(parent),
-			m_spDefectOperator(NULL), m_spApproxOperator(NULL), m_bInit(false), m_bOtherApproxOperator(false)
+			m_spDefectOperator(NULL), m_spApproxOperator(NULL), m_bInit(false), m_bOtherApproxOperator(false),
+			m_bNumericReinit(false)
 		{
 		}
 	protected:
@@ -271,6 +274,38 @@ class IPreconditioner :
 			return true;
 		}
 
+	/**
+	 * This method re-initializes the preconditioner for an operator J(u),
+	 * whose matrix is expected to have the same sparsity pattern as the matrix
+	 * of the previous initialization, i.e. only the values have changed.
+	 * Derived classes may reuse their symbolic setup (e.g. orderings or
+	 * schedules) in the 'preprocess'-method, if the pattern revision of the
+	 * matrix confirms that the pattern is unchanged, \sa same_pattern. If the
+	 * preconditioner has not been initialized yet, a full initialization is
+	 * performed.
+	 *
+	 * \param[in]	J		linear operator
+	 * \param[in]	u		linearization point
+	 * \returns		bool	success flag
+	 */
+		bool init_numeric(SmartPtr<ILinearOperator<vector_type> > J,
+		                  const vector_type& u)
+		{
+			if(!m_bInit) return init(J, u);
+
+			m_bNumericReinit = true;
+			bool bSuccess;
+			try{
+				bSuccess = init(J, u);
+			}
+			catch(...){
+				m_bNumericReinit = false;
+				throw;
+			}
+			m_bNumericReinit = false;
+			return bSuccess;
+		}
+
 	///	compute new correction c = B*d
 	/**
 	 * This method implements the virtual method of the ILinearIterator-interface.
@@ -283,36 +318,8 @@ class IPreconditioner :
 	 */
 		virtual bool apply(vector_type& c, const vector_type& d)
 		{
-		//	Check that operator is initialized
-			if(!m_bInit)
-			{
-				UG_LOG("ERROR in '"<<name()<<"::apply': Iterator not initialized.\n");
-				return false;
-			}
-
-		//	Check parallel status
-			#ifdef UG_PARALLEL
-			if(!d.has_storage_type(PST_ADDITIVE))
-				UG_THROW(name() << "::apply: Wrong parallel "
-				               "storage format. Defect must be additive.");
-			#endif
-
-		//	Check sizes
-			THROW_IF_NOT_EQUAL_4(c.size(), d.size(),
-					m_spApproxOperator->num_rows(), m_spApproxOperator->num_cols());
-
-		// 	apply iterator: c = B*d
-			if(!step(m_spApproxOperator, c, d))
-			{
-				UG_LOG("ERROR in '"<<name()<<"::apply': Step Routine failed.\n");
-				return false;
-			}
-
-		//	apply scaling
-			const number kappa = damping()->damping(c, d, m_spApproxOperator);
-			if(kappa != 1.0){
-				c *= kappa;
-			}
+		//	compute new correction
+			if(!compute_correction(c, d)) return false;
 
 		//	Correction is always consistent
 			#ifdef UG_PARALLEL
@@ -374,6 +381,96 @@ class IPreconditioner :
 			return m_spApproxOperator;
 		}
 
+	protected:
+	///	computes the correction c = B*d
+	/**
+	 * The correction is scaled by the damping, but it is left in the storage
+	 * type returned by 'step', i.e. it is not necessarily consistent.
+	 */
+		bool compute_correction(vector_type& c, const vector_type& d)
+		{
+		//	Check that operator is initialized
+			if(!m_bInit)
+			{
+				UG_LOG("ERROR in '"<<name()<<"::apply': Iterator not initialized.\n");
+				return false;
+			}
+
+		//	Check parallel status
+			#ifdef UG_PARALLEL
+			if(!d.has_storage_type(PST_ADDITIVE))
+				UG_THROW(name() << "::apply: Wrong parallel "
+				               "storage format. Defect must be additive.");
+			#endif
+
+		//	Check sizes
+			THROW_IF_NOT_EQUAL_4(c.size(), d.size(),
+					m_spApproxOperator->num_rows(), m_spApproxOperator->num_cols());
+
+		// 	apply iterator: c = B*d
+			if(!step(m_spApproxOperator, c, d))
+			{
+				UG_LOG("ERROR in '"<<name()<<"::apply': Step Routine failed.\n");
+				return false;
+			}
+
+		//	apply scaling
+			if(damping()->constant_damping()){
+				const number kappa = damping()->damping();
+				if(kappa != 1.0) c *= kappa;
+			}
+			else{
+			//	the damping is computed from the consistent correction
+				#ifdef UG_PARALLEL
+				if(!c.change_storage_type(PST_CONSISTENT))
+					UG_THROW(name() << "::apply': Cannot change "
+							"parallel storage type of correction to consistent.");
+				#endif
+				const number kappa = damping()->damping(c, d, m_spApproxOperator);
+				if(kappa != 1.0) c *= kappa;
+			}
+
+			return true;
+		}
+
+	///	computes c = B*d and d := d - A*c, making c consistent within the defect update
+	/**
+	 * If the defect is computed with the matrix of the preconditioner, the
+	 * (unique or additive) correction of the step is passed to the matrix
+	 * directly. The matrix then exchanges the interface values of c while it
+	 * computes the rows that do not depend on them (\sa ParallelMatrix).
+	 * Preconditioners whose step does not return a consistent correction use
+	 * this for apply_update_defect.
+	 */
+		bool apply_update_defect_overlapped(vector_type& c, vector_type& d)
+		{
+		//	compute new correction
+			if(!compute_correction(c, d)) return false;
+
+		// 	update defect d := d - A*c
+			if(m_spDefectOperator.get() == m_spApproxOperator.get())
+				m_spApproxOperator->apply_sub(d, c);
+			else
+			{
+				#ifdef UG_PARALLEL
+				if(!c.change_storage_type(PST_CONSISTENT))
+					UG_THROW(name() << "::apply': Cannot change "
+							"parallel storage type of correction to consistent.");
+				#endif
+				m_spDefectOperator->apply_sub(d, c);
+			}
+
+		//	Correction is always consistent
+			#ifdef UG_PARALLEL
+			if(!c.change_storage_type(PST_CONSISTENT))
+				UG_THROW(name() << "::apply': Cannot change "
+						"parallel storage type of correction to consistent.");
+			#endif
+
+		//	we're done
+			return true;
+		}
+
 	protected:
 	///	underlying matrix based operator for calculation of defect
 		SmartPtr<ILinearOperator<vector_type> > m_spDefectOperator;
@@ -385,6 +482,29 @@ class IPreconditioner :
 		bool m_bInit;
 
 		bool m_bOtherApproxOperator;
+
+	///	flag indicating if the current preprocess only has to refresh the values
+		bool m_bNumericReinit;
+
+	///	returns if the current preprocess is a re-init for an unchanged sparsity pattern
+		bool numeric_reinit() const {return m_bNumericReinit;}
+
+	///	returns if a symbolic setup computed for the pattern revision 'revision' can be reused for A
+	/**	This is the case for a numeric re-init, if A is finalized and still has
+	 * the given pattern revision (\sa SparseMatrix::pattern_revision).*/
+		template <typename TMatrix>
+		bool same_pattern(const TMatrix& A, size_t revision) const
+		{
+			return m_bNumericReinit && A.is_finalized()
+					&& A.pattern_revision() == revision;
+		}
+
+	///	returns the pattern revision of A to be passed to same_pattern (0 if A is not finalized)
+		template <typename TMatrix>
+		static size_t pattern_revision_of(const TMatrix& A)
+		{
+			return A.is_finalized() ? A.pattern_revision() : 0;
+		}
 };
 
 
@@ -115,6 +115,7 @@ class AgglomeratingBase : public TBase
 			CollectMatrixOnOneProc(A, collectedA, agglomerationLayout.master(), agglomerationLayout.slave());
 			agglomerationLayout.comm() = A.layouts()->comm();
 			agglomerationLayout.proc_comm() = A.layouts()->proc_comm();
+			agglomerationLayout.layouts_changed();
 
 			m_spLocalAlgebraLayouts = CreateLocalAlgebraLayouts();
 			collectedA.set_layouts(m_spLocalAlgebraLayouts);
@@ -40,6 +40,7 @@
 #include "lib_algebra/operator/interface/operator.h"
 #include "lib_algebra/operator/interface/linear_solver_profiling.h"
 #include "lib_algebra/operator/interface/pprocess.h"
+#include "lib_algebra/algebra_common/fused_reduction.h"
 #ifdef UG_PARALLEL
 	#include "lib_algebra/parallelization/parallelization.h"
 #endif
@@ -150,6 +151,11 @@ class BiCGStab
 		//	restart flag (set to true at first run)
 			bool bRestart = true;
 
+		//	rho for the next step, if computed together with the defect norm
+			bool bRhoKnown = false;
+			number rhoNext = 0.0;
+			std::vector<vector_type*> vW(2);
+
 			write_debugXR(x, r, convergence_check()->step(), 'i');
 
 		// 	Iteration loop
@@ -188,6 +194,9 @@ class BiCGStab
 				//	remember start norm
 					norm_r0 = convergence_check()->defect();
 
+				//	(r0,r) has been computed with the old r0
+					bRhoKnown = false;
+
 				//	remove restart flag
 					bRestart = false;
 				}
@@ -198,8 +207,11 @@ class BiCGStab
 			// 	Compute rho new
 				if (!r.size())
 					rho = 1.0;
+				else if (bRhoKnown)
+					rho = rhoNext;
 				else
 					rho = VecProd(r0, r);
+				bRhoKnown = false;
 
 			//	check for restart compare (r, r0) > m_minOrtho * ||r|| ||r0||
 				const number norm_r = convergence_check()->defect();
@@ -332,18 +344,19 @@ class BiCGStab
 					UG_THROW("BiCGStab: Cannot convert t to unique vector.");
 				#endif
 
-			// 	tt = (t,t)
+			// 	tt = (t,t), omega = (s,t) with one reduction
 				number tt;
 				if (!t.size())
-					tt = 1.0;
-				else
-					tt = VecProd(t, t);
-
-			// 	omega = (s,t)
-				if (!s.size())
-					omega = 1.0;
+				{
+					tt = 1.0; omega = 1.0;
+				}
 				else
-					omega = VecProd(s, t);
+				{
+					vW[0] = &t; vW[1] = &s;
+					std::vector<number> vProd;
+					MultiDotprod(t, vW, vProd);
+					tt = vProd[0]; omega = vProd[1];
+				}
 
 			//	check tt
 				if(tt == 0.0)
@@ -359,11 +372,32 @@ class BiCGStab
 			// 	add: x := x + omega * q
 				VecScaleAdd(x, 1.0, x, omega, q);
 
-			//  compute r = s - omega*t
-				VecScaleAdd(r, 1.0, s, -omega, t);
-
-			// 	check convergence
-				convergence_check()->update(r);
+			//  compute r = s - omega*t and check convergence, computing ||r||
+			//	and the next rho = (r0,r) with one reduction. Without parallel
+			//	layouts, both are computed in the same pass as r.
+				if (r.size() && convergence_check()->defect_is_norm())
+				{
+					#ifdef UG_PARALLEL
+					VecScaleAdd(r, 1.0, s, -omega, t);
+					FusedReduction<vector_type> red;
+					vW[0] = &r; vW[1] = &r0;
+					const size_t iFirst = red.add_dotprods(r, vW);
+					red.start();
+					red.finish();
+					convergence_check()->update_defect(sqrt(red.value(iFirst)));
+					rhoNext = red.value(iFirst + 1);
+					#else
+					number rr;
+					VecScaleAddProd(r, 1.0, s, -omega, t, r0, rr, rhoNext);
+					convergence_check()->update_defect(sqrt(rr));
+					#endif
+					bRhoKnown = true;
+				}
+				else
+				{
+					VecScaleAdd(r, 1.0, s, -omega, t);
+					convergence_check()->update(r);
+				}
 
 				write_debugXR(x, r, convergence_check()->step(), 'b');
 
@@ -38,6 +38,7 @@
 
 #include "lib_algebra/operator/interface/operator.h"
 #include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "lib_algebra/algebra_common/fused_reduction.h"
 #include "common/profiler/profiler.h"
 #include "lib_algebra/operator/interface/pprocess.h"
 #ifdef UG_PARALLEL
@@ -149,16 +150,29 @@ class CG
 		//	post-process the correction
 			m_corr_post_process.apply (z);
 
-		//	compute start defect
+		//	compute start defect and start rho = (z,r)
 			prepare_conv_check();
-			convergence_check()->start(r);
+			number rhoOld, rho;
+			if(convergence_check()->defect_is_norm())
+			{
+			//	both with one reduction
+				FusedReduction<vector_type> red;
+				std::vector<vector_type*> vW(2); vW[0] = &r; vW[1] = &z;
+				const size_t iFirst = red.add_dotprods(r, vW);
+				red.start();
+				red.finish();
+				convergence_check()->start_defect(sqrt(red.value(iFirst)));
+				rhoOld = red.value(iFirst + 1);
+			}
+			else
+			{
+				convergence_check()->start(r);
+				rhoOld = VecProd(z, r);
+			}
 
 		// 	start search direction
 			p = z;
 
-		// 	start rho
-			number rhoOld = VecProd(z, r), rho;
-
 		// 	Iteration loop
 			while(!convergence_check()->iteration_ended())
 			{
@@ -186,16 +200,25 @@ class CG
 			//	alpha = rho / (q,p)
 				const number alpha = rhoOld/lambda;
 
-			// 	Update x := x + alpha*p
-				VecScaleAdd(x, 1.0, x, alpha, p);
-
-			// 	Update r := r - alpha*t
-				VecScaleAdd(r, 1.0, r, -alpha, q);
+			// 	Update x := x + alpha*p and r := r - alpha*q in one pass. Without
+			//	parallel layouts, ||r|| is computed in the same pass.
+				bool bDefectKnown = false;
+				number defect = 0.0;
+				#ifndef UG_PARALLEL
+				if(convergence_check()->defect_is_norm())
+				{
+					defect = sqrt(VecScaleAddPairNormSquared(x, alpha, p, r, -alpha, q));
+					bDefectKnown = true;
+				}
+				else
+				#endif
+					VecScaleAddPair(x, alpha, p, r, -alpha, q);
 
 				write_debugXR(x, r, convergence_check()->step());
 
 			// 	Check convergence
-				convergence_check()->update(r);
+				if(bDefectKnown) convergence_check()->update_defect(defect);
+				else convergence_check()->update(r);
 				if(convergence_check()->iteration_ended()) break;
 
 			// 	Preconditioning
@@ -35,8 +35,11 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
+#include <cmath>
 
 #include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/algebra_common/fused_reduction.h"
 #include "common/profiler/profiler.h"
 #include "lib_algebra/operator/interface/pprocess.h"
 #ifdef UG_PARALLEL
@@ -50,6 +53,14 @@ namespace ug{
  * This class implements the GMRES - method for the solution of linear
  * operator problems like A*x = b, where the solution x = A^{-1} b is computed.
  *
+ * The Krylov basis is orthogonalized by classical Gram-Schmidt. All inner
+ * products of one pass (together with the norm of the new basis vector) are
+ * summed up in a single global reduction. If the norm of the orthogonalized
+ * vector drops below eta times its original norm, a second pass is performed
+ * (reorthogonalization, "twice is enough"). The basis vectors and the
+ * Hessenberg matrix are kept between calls and only reallocated if the size
+ * of the vectors changes.
+ *
  * For detailed description of the algorithm, please refer to:
  *
  * - Barrett, Berry, Chan, Demmel, Donatom Dongarra, Eijkhout, Pozo, Romine,
@@ -58,6 +69,10 @@ namespace ug{
  *
  * - Saad, "Iterative Methods For Sparse Linear Systems"
  *
+ * - Daniel, Gragg, Kaufman, Stewart, "Reorthogonalization and stable
+ *   algorithms for updating the Gram-Schmidt QR factorization", Math. Comp.
+ *   30 (1976)
+ *
  * \tparam 	TVector		vector type
  */
 template <typename TVector>
@@ -79,13 +94,14 @@ class GMRES
 
 	public:
 	///	default constructor
-		GMRES(size_t restart) : m_restart(restart) {};
+		GMRES(size_t restart) : m_restart(restart), m_reorthoEta(sqrt(0.5)) {};
 
 	///	constructor setting the preconditioner and the convergence check
 		GMRES( size_t restart,
 		       SmartPtr<ILinearIterator<vector_type> > spPrecond,
 		       SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
-			: base_type(spPrecond, spConvCheck), m_restart(restart)
+			: base_type(spPrecond, spConvCheck), m_restart(restart),
+			  m_reorthoEta(sqrt(0.5))
 		{};
 
 	///	name of solver
@@ -102,14 +118,20 @@ class GMRES
 	// 	Solve J(u)*x = b, such that x = J(u)^{-1} b
 		virtual bool apply_return_defect(vector_type& x, vector_type& b)
 		{
+			PROFILE_BEGIN_GROUP(GMRES_apply_return_defect, "algebra GMRES");
 		//	check correct storage type in parallel
 			#ifdef UG_PARALLEL
 			if(!b.has_storage_type(PST_ADDITIVE) || !x.has_storage_type(PST_CONSISTENT))
 				UG_THROW("GMRES: Inadequate storage format of Vectors.");
 			#endif
 
+		//	storage for basis, h, gamma (kept between calls)
+			init_storage();
+
 		//	copy rhs
-			SmartPtr<vector_type> spR = b.clone();
+			SmartPtr<vector_type>& spR = m_spR;
+			if(!reusable(spR, b)) spR = b.clone_without_values();
+			*spR = b;
 
 		// 	build defect:  b := b - A*x
 			linear_operator()->apply_sub(*spR, x);
@@ -120,13 +142,8 @@ class GMRES
 		//	compute start defect norm
 			convergence_check()->start(*spR);
 
-		//	storage for v, h, gamma
-			std::vector<SmartPtr<vector_type> > v(m_restart+1);
-			std::vector<std::vector<number> > h(m_restart+1);
-			for(size_t i = 0; i < h.size(); ++i) h[i].resize(m_restart+1);
-			std::vector<number> gamma(m_restart+1);
-			std::vector<number> c(m_restart+1);
-			std::vector<number> s(m_restart+1);
+			std::vector<SmartPtr<vector_type> >& v = m_vBasis;
+			std::vector<number>& gamma = m_vGamma;
 
 		//	old norm
 			number oldNorm;
@@ -135,7 +152,7 @@ class GMRES
 			while(!convergence_check()->iteration_ended())
 			{
 			//	get storage for first vector v[0]
-				if(v[0].invalid()) v[0] = x.clone_without_values();
+				if(!reusable(v[0], x)) v[0] = x.clone_without_values();
 
 			// 	apply v[0] = M^-1 * (b-A*x)
 				if(preconditioner().valid()){
@@ -171,7 +188,7 @@ class GMRES
 					numIter = j;
 
 				//	get storage for v[j+1]
-					if(v[j+1].invalid()) v[j+1] = x.clone_without_values();
+					if(!reusable(v[j+1], x)) v[j+1] = x.clone_without_values();
 
 #ifdef UG_PARALLEL
 					if(!v[j]->change_storage_type(PST_CONSISTENT))
@@ -204,40 +221,8 @@ class GMRES
 				//	post-process the correction
 					m_corr_post_process.apply (*v[j+1]);
 
-				//	loop previous steps
-					for(size_t i = 0; i <= j; ++i)
-					{
-					//	h_ij := (r, v[j])
-						h[i][j] = VecProd(*v[j+1], *v[i]);
-
-					//	v[j+1] -= h_ij * v[i]
-						VecScaleAppend(*v[j+1], *v[i], (-1)*h[i][j]);
-					}
-
-				//	compute h_{j+1,j}
-					h[j+1][j] = v[j+1]->norm();
-
-				//	update h
-					for(size_t i = 0; i < j; ++i)
-					{
-						const number hij = h[i][j];
-						const number hi1j = h[i+1][j];
-
-						h[i][j]   =  c[i+1]*hij + s[i+1]*hi1j;
-						h[i+1][j] =  s[i+1]*hij - c[i+1]*hi1j;
-					}
-
-				//	alpha := sqrt(h_jj ^2 + h_{j+1,j}^2)
-					const number alpha = sqrt(h[j][j]*h[j][j] + h[j+1][j]*h[j+1][j]);
-
-				//	update s, c
-					s[j+1] = h[j+1][j] / alpha;
-					c[j+1] = h[j][j]   / alpha;
-					h[j][j] = alpha;
-
-				//	compute new norm
-					gamma[j+1] = s[j+1]*gamma[j];
-					gamma[j] = c[j+1]*gamma[j];
+				//	orthonormalize v[j+1], update h and gamma
+					const bool bBreakdown = !arnoldi_step(j);
 
 					if(preconditioner().valid()) {
 						UG_LOG(std::string(convergence_check()->get_offset(),' '));
@@ -250,22 +235,12 @@ class GMRES
 						convergence_check()->update_defect(gamma[j+1]);
 					}
 
-				//	normalize v[j+1]
-					*v[j+1] *= 1./(h[j+1][j]);
+				//	Krylov space is invariant: solution found
+					if(bBreakdown) break;
 				}
 
 			//	compute current x
-				for(size_t i = numIter; ; --i){
-					for(size_t j = i+1; j <= numIter; ++j)
-						gamma[i] -= h[i][j] * gamma[j];
-
-					gamma[i] /= h[i][i];
-
-				//	x = x + gamma[i] * v[i]
-					VecScaleAppend(x, *v[i], gamma[i]);
-
-					if(i == 0) break;
-				}
+				update_solution(x, v, numIter);
 
 			//	compute fresh defect: b := b - A*x
 				*spR = b;
@@ -283,11 +258,19 @@ class GMRES
 		virtual std::string config_string() const
 		{
 			std::stringstream ss;
-			ss << "GMRes ( restart = " << m_restart << ")\n";
+			ss << name() << " ( restart = " << m_restart << ", reorthogonalization = " << m_reorthoEta << ")\n";
 			ss << base_type::config_string_preconditioner_convergence_check();
 			return ss.str();
 		}
-		
+
+	///	sets the threshold eta for reorthogonalization
+	/**
+	 * A second Gram-Schmidt pass is performed if the norm of the new basis
+	 * vector drops below eta times its norm before the orthogonalization.
+	 * eta = 0 never reorthogonalizes, eta >= 1 always (default: 1/sqrt(2)).
+	 */
+		void set_reorthogonalization(number eta) {m_reorthoEta = eta;}
+
 	///	adds a post-process for the iterates
 		void add_postprocess_corr (SmartPtr<IPProcessVector<vector_type> > p)
 		{
@@ -317,10 +300,129 @@ class GMRES
 			convergence_check()->set_info(s);
 		}
 
+	///	resizes the storage for the basis and the Hessenberg matrix
+		void init_storage()
+		{
+			m_vBasis.resize(m_restart+1);
+			m_vH.resize((m_restart+1)*(m_restart+1));
+			m_vGamma.resize(m_restart+1);
+			m_vC.resize(m_restart+1);
+			m_vS.resize(m_restart+1);
+		}
+
+	///	returns if a stored vector can be reused for vectors like v
+		bool reusable(const SmartPtr<vector_type>& sp, const vector_type& v) const
+		{
+			if(sp.invalid() || sp->size() != v.size()) return false;
+			#ifdef UG_PARALLEL
+			if(sp->layouts().get() != v.layouts().get()) return false;
+			#endif
+			return true;
+		}
+
+	///	entry (i,j) of the Hessenberg matrix
+		number& H(size_t i, size_t j) {return m_vH[i*(m_restart+1) + j];}
+
+	///	orthonormalizes m_vBasis[j+1] against m_vBasis[0..j]
+	/**
+	 * Performs classical Gram-Schmidt with one fused reduction per pass,
+	 * applies the Givens rotations to the new column of H and updates the
+	 * defect norms gamma. Returns false if the new vector vanishes.
+	 */
+		bool arnoldi_step(size_t j)
+		{
+			std::vector<SmartPtr<vector_type> >& v = m_vBasis;
+			vector_type& w = *v[j+1];
+			std::vector<number>& c = m_vC;
+			std::vector<number>& s = m_vS;
+			std::vector<number>& gamma = m_vGamma;
+
+		//	h_ij := (w, v[i]) and ||w||^2 in one pass and one reduction
+			m_vCoeff.resize(j+1);
+			std::vector<vector_type*> vW(j+2);
+			for(size_t i = 0; i <= j; ++i) vW[i] = v[i].get();
+			vW[j+1] = &w;
+			const size_t iNorm = j+1;
+
+			number norm2Before = 0.0, norm2 = 0.0;
+			for(int pass = 0; pass < 2; ++pass)
+			{
+				FusedReduction<vector_type> red;
+				red.add_dotprods(w, vW);
+				red.start();
+				red.finish();
+
+			//	w -= sum_i h_ij * v[i], norm of w by Pythagoras
+				norm2Before = norm2 = red.value(iNorm);
+				for(size_t i = 0; i <= j; ++i){
+					m_vCoeff[i] = red.value(i);
+					norm2 -= m_vCoeff[i]*m_vCoeff[i];
+					if(pass == 0) H(i,j) = m_vCoeff[i];
+					else H(i,j) += m_vCoeff[i];
+				}
+				VecScaleAppend(w, v, m_vCoeff, -1.0);
+
+			//	twice is enough, once if only little cancellation occurred
+				if(norm2 > m_reorthoEta*m_reorthoEta*norm2Before) break;
+			}
+
+		//	compute h_{j+1,j}
+			H(j+1,j) = (norm2 > 0.0) ? sqrt(norm2) : 0.0;
+
+		//	update h
+			for(size_t i = 0; i < j; ++i)
+			{
+				const number hij = H(i,j);
+				const number hi1j = H(i+1,j);
+
+				H(i,j)   =  c[i+1]*hij + s[i+1]*hi1j;
+				H(i+1,j) =  s[i+1]*hij - c[i+1]*hi1j;
+			}
+
+		//	alpha := sqrt(h_jj ^2 + h_{j+1,j}^2)
+			const number hj1j = H(j+1,j);
+			const number alpha = sqrt(H(j,j)*H(j,j) + hj1j*hj1j);
+
+		//	update s, c
+			s[j+1] = hj1j / alpha;
+			c[j+1] = H(j,j) / alpha;
+			H(j,j) = alpha;
+
+		//	compute new norm
+			gamma[j+1] = s[j+1]*gamma[j];
+			gamma[j] = c[j+1]*gamma[j];
+
+		//	normalize v[j+1]
+			if(hj1j == 0.0) return false;
+			w *= 1./hj1j;
+			return true;
+		}
+
+	///	x += sum_i y_i * z[i], with y solving the triangular system H y = gamma
+		void update_solution(vector_type& x, std::vector<SmartPtr<vector_type> >& z,
+		                     size_t numIter)
+		{
+			std::vector<number>& gamma = m_vGamma;
+			for(size_t i = numIter; ; --i){
+				for(size_t j = i+1; j <= numIter; ++j)
+					gamma[i] -= H(i,j) * gamma[j];
+
+				gamma[i] /= H(i,i);
+
+				if(i == 0) break;
+			}
+
+		//	x = x + gamma[i] * z[i]
+			VecScaleAppend(x, z, gamma, 1.0, numIter+1);
+		}
+
 	protected:
 	///	restart parameter
 		size_t m_restart;
 
+	///	threshold for reorthogonalization
+		number m_reorthoEta;
+
 	///	postprocessor for the correction in the iterations
 		/**
 		 * These postprocess operations are applied to the preconditioned
@@ -329,33 +431,208 @@ class GMRES
 		 */
 		PProcessChain<vector_type> m_corr_post_process;
 
-	///	adds a scaled vector to a second one
-		bool VecScaleAppend(vector_type& a, vector_type& b, number s)
+	///	Krylov basis (kept between calls)
+		std::vector<SmartPtr<vector_type> > m_vBasis;
+
+	///	defect / help vector
+		SmartPtr<vector_type> m_spR;
+
+	///	Hessenberg matrix (row-major, (restart+1)x(restart+1))
+		std::vector<number> m_vH;
+
+	///	defect norms and Givens rotations
+		std::vector<number> m_vGamma, m_vC, m_vS;
+
+	///	coefficients of one Gram-Schmidt pass
+		std::vector<number> m_vCoeff;
+
+	///	a += scale * sum_i s[i] * b[i] for i < n (all if n = 0), in one pass over a
+		void VecScaleAppend(vector_type& a, std::vector<SmartPtr<vector_type> >& b,
+		                    const std::vector<number>& s, number scale, size_t n = 0)
 		{
+			if(n == 0) n = s.size();
 			#ifdef UG_PARALLEL
-			if(a.has_storage_type(PST_UNIQUE) && b.has_storage_type(PST_UNIQUE));
-			else if(a.has_storage_type(PST_CONSISTENT) && b.has_storage_type(PST_CONSISTENT));
-			else if (a.has_storage_type(PST_ADDITIVE) && b.has_storage_type(PST_ADDITIVE));
-			else
+			for(size_t k = 0; k < n; ++k)
 			{
-				a.change_storage_type(PST_ADDITIVE);
-				b.change_storage_type(PST_ADDITIVE);
+				if(a.has_storage_type(PST_UNIQUE) && b[k]->has_storage_type(PST_UNIQUE));
+				else if(a.has_storage_type(PST_CONSISTENT) && b[k]->has_storage_type(PST_CONSISTENT));
+				else if (a.has_storage_type(PST_ADDITIVE) && b[k]->has_storage_type(PST_ADDITIVE));
+				else
+				{
+					a.change_storage_type(PST_ADDITIVE);
+					b[k]->change_storage_type(PST_ADDITIVE);
+				}
 			}
 			#endif
 
-            for(size_t i = 0; i < a.size(); ++i)
-            {
-            	// todo: move VecScaleAppend to ParallelVector
-            	VecScaleAdd(a[i], 1.0, a[i], s, b[i]);
-            }
-            return true;
+			for(size_t i = 0; i < a.size(); ++i)
+				for(size_t k = 0; k < n; ++k)
+				{
+				// 	todo: move VecScaleAppend to ParallelVector
+					VecScaleAdd(a[i], 1.0, a[i], scale*s[k], (*b[k])[i]);
+				}
 		}
+};
+
+///	the flexible GMRES method as a solver for linear operators
+/**
+ * This class implements the flexible (right preconditioned) GMRES method.
+ * In contrast to GMRES, the preconditioned basis vectors are stored, such
+ * that the preconditioner may change from step to step (e.g. an inner
+ * iterative solver). The convergence check monitors the true defect norm
+ * in every step.
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - Saad, "A flexible inner-outer preconditioned GMRES algorithm", SIAM J.
+ *   Sci. Comput. 14 (1993)
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class FGMRES
+	: public GMRES<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Base type
+		typedef GMRES<TVector> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+		using base_type::m_restart;
+		using base_type::m_corr_post_process;
 
-	///	computes the vector product
-		number VecProd(vector_type& a, vector_type& b)
+	public:
+	///	default constructor
+		FGMRES(size_t restart) : base_type(restart) {};
+
+	///	constructor setting the preconditioner and the convergence check
+		FGMRES( size_t restart,
+		        SmartPtr<ILinearIterator<vector_type> > spPrecond,
+		        SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type(restart, spPrecond, spConvCheck)
+		{};
+
+	///	name of solver
+		virtual const char* name() const {return "FGMRES";}
+
+	// 	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
 		{
-			return a.dotprod(b);
+			PROFILE_BEGIN_GROUP(FGMRES_apply_return_defect, "algebra GMRES");
+		//	check correct storage type in parallel
+			#ifdef UG_PARALLEL
+			if(!b.has_storage_type(PST_ADDITIVE) || !x.has_storage_type(PST_CONSISTENT))
+				UG_THROW("FGMRES: Inadequate storage format of Vectors.");
+			#endif
+
+		//	storage for basis, preconditioned basis, h, gamma
+			this->init_storage();
+			m_vZ.resize(m_restart);
+
+			std::vector<SmartPtr<vector_type> >& v = this->m_vBasis;
+			std::vector<number>& gamma = this->m_vGamma;
+
+		//	prepare convergence check
+			this->prepare_conv_check();
+
+		// 	build defect:  v[0] := b - A*x
+			if(!this->reusable(v[0], b)) v[0] = b.clone_without_values();
+			*v[0] = b;
+			linear_operator()->apply_sub(*v[0], x);
+
+		//	compute start defect norm
+			convergence_check()->start(*v[0]);
+
+		// 	Iteration loop
+			while(!convergence_check()->iteration_ended())
+			{
+			// 	make v[0] unique
+				#ifdef UG_PARALLEL
+				if(!v[0]->change_storage_type(PST_UNIQUE))
+					UG_THROW("FGMRES: Cannot convert v0 to unique vector.");
+				#endif
+
+			// 	Compute norm of inital residuum and normalize
+				gamma[0] = v[0]->norm();
+				*v[0] *= 1./gamma[0];
+
+			//	loop gmres iterations
+				size_t numIter = 0;
+				for(size_t j = 0; j < m_restart; ++j)
+				{
+					numIter = j;
+
+				//	get storage for z[j], v[j+1]
+					if(!this->reusable(m_vZ[j], x)) m_vZ[j] = x.clone_without_values();
+					if(!this->reusable(v[j+1], b)) v[j+1] = b.clone_without_values();
+
+				// 	apply z[j] = M_j^-1 * v[j] ...
+					if(preconditioner().valid()){
+						if(!preconditioner()->apply(*m_vZ[j], *v[j])){
+							UG_LOG("FGMRES: Cannot apply preconditioner to v["<<j<<"].\n");
+							return false;
+						}
+					}
+				//	... or copy z[j] = v[j]
+					else *m_vZ[j] = *v[j];
+
+				// 	make z[j] consistent
+					#ifdef UG_PARALLEL
+					if(!m_vZ[j]->change_storage_type(PST_CONSISTENT))
+						UG_THROW("FGMRES: Cannot convert z["<<j<<"] to consistent vector.");
+					#endif
+
+				//	post-process the correction
+					m_corr_post_process.apply (*m_vZ[j]);
+
+				//	compute v[j+1] = A*z[j]
+					linear_operator()->apply(*v[j+1], *m_vZ[j]);
+
+				// 	make v[j+1] unique
+					#ifdef UG_PARALLEL
+					if(!v[j+1]->change_storage_type(PST_UNIQUE))
+						UG_THROW("FGMRES: Cannot convert v["<<j+1<<"] to unique vector.");
+					#endif
+
+				//	orthonormalize v[j+1], update h and gamma
+					const bool bBreakdown = !this->arnoldi_step(j);
+
+				//	gamma is the Givens estimate of the defect norm
+					convergence_check()->update_defect(fabs(gamma[j+1]));
+
+					if(bBreakdown || convergence_check()->iteration_ended()) break;
+				}
+
+			//	compute current x
+				this->update_solution(x, m_vZ, numIter);
+
+			//	compute the true defect: v[0] := b - A*x. It is the start
+			//	defect of the next cycle
+				*v[0] = b;
+				linear_operator()->apply_sub(*v[0], x);
+
+			//	the estimate may differ from the true defect (rounding, a
+			//	varying preconditioner); thus, convergence is decided by the
+			//	true defect
+				convergence_check()->correct(*v[0]);
+			}
+
+		//	return the defect: b := b - A*x
+			b = *v[0];
+
+		//	print ending output
+			return convergence_check()->post();
 		}
+
+	protected:
+	///	preconditioned basis (kept between calls)
+		std::vector<SmartPtr<vector_type> > m_vZ;
 };
 
 } // end namespace ug
@@ -0,0 +1,513 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_ALGEBRA__GROUP_AGGLOMERATING_SOLVER__
+#define __H__LIB_ALGEBRA__GROUP_AGGLOMERATING_SOLVER__
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib_algebra/operator/interface/matrix_operator_inverse.h"
+#include "common/util/binary_buffer.h"
+#include "common/serialization.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/collect_matrix.h"
+	#include "lib_algebra/parallelization/parallelization.h"
+	#include "lib_algebra/parallelization/parallelization_util.h"
+#endif
+
+namespace ug{
+
+///	Agglomerating solver using groups of processes and redundant coarse solves
+/**
+ * In contrast to the AgglomeratingSolver, which gathers the whole matrix onto
+ * the first process of the communicator, this solver agglomerates in two
+ * stages:
+ *
+ * 1. The processes of the matrix are split into groups of consecutive
+ *    processes (pcl::ProcessCommunicator::split). Each group collects its
+ *    part of the matrix onto its first process (the group root).
+ * 2. The group roots exchange their parts on a communicator containing only
+ *    the group roots. If the global number of unknowns does not exceed
+ *    max_redundant_dofs, every group root assembles the full matrix and solves
+ *    redundantly, so that no broadcast of the solution among the roots is needed.
+ *    Otherwise only the first group root solves and broadcasts the solution
+ *    to the other group roots.
+ *
+ * Finally each group root distributes the solution to the processes of its
+ * group. If no group size is set, it is chosen from the global number of
+ * unknowns so that each group root collects about gather_dofs unknowns,
+ * limited by sqrt(#procs) processes per group.
+ *
+ * The solver may e.g. be used as base solver of the GMG on a distributed
+ * base level (set_gathered_base_solver_if_ambiguous(false)).
+ * Only algebras with a fixed block size are supported in parallel.
+ */
+template <typename TAlgebra>
+class GroupAgglomeratingSolver
+	: public IMatrixOperatorInverse<typename TAlgebra::matrix_type,
+									typename TAlgebra::vector_type>
+{
+	public:
+	// 	Algebra type
+		typedef TAlgebra algebra_type;
+
+	// 	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	// 	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	//	Value type
+		typedef typename vector_type::value_type value_type;
+
+	///	Base type
+		typedef IMatrixOperatorInverse<matrix_type,vector_type> base_type;
+
+	public:
+		GroupAgglomeratingSolver(SmartPtr<ILinearOperatorInverse<vector_type, vector_type> > linOpInverse)
+			: m_groupSize(0), m_gatherDoFs(10000), m_maxRedundantDoFs(100000),
+			  m_pMatrix(NULL), m_bGroupRoot(true), m_bHasFullMatrix(true),
+			  m_bRedundant(true), m_numFull(0)
+		{
+			UG_COND_THROW(linOpInverse.valid()==false, "linOpInverse has to be != NULL");
+			m_spLinOpInverse = linOpInverse;
+			m_name = std::string("GroupAgglomeratingSolver(") + linOpInverse->name() + ")";
+		};
+
+	// 	Destructor
+		virtual ~GroupAgglomeratingSolver() {};
+
+	///	sets the number of processes per group (0 = automatic, default)
+		void set_group_size(size_t groupSize) {m_groupSize = groupSize;}
+
+	///	sets the number of unknowns each group root should collect (automatic group size)
+		void set_gather_dofs(size_t n) {m_gatherDoFs = n;}
+
+	///	up to this global number of unknowns, the coarse problem is solved redundantly on all group roots
+		void set_max_redundant_dofs(size_t n) {m_maxRedundantDoFs = n;}
+
+		virtual const char* name() const
+		{
+			return m_name.c_str();
+		}
+
+		virtual bool supports_parallel() const { return true; }
+
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "GroupAgglomeratingSolver (group size = ";
+			if(m_groupSize == 0) ss << "auto, gather dofs = " << m_gatherDoFs;
+			else ss << m_groupSize;
+			ss << ", max redundant dofs = " << m_maxRedundantDoFs << "): "
+			   << m_spLinOpInverse->config_string();
+			return ss.str();
+		}
+
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > A)
+		{
+		//	cast operator
+			SmartPtr<MatrixOperator<matrix_type,vector_type> > op =
+									A.template cast_dynamic<MatrixOperator<matrix_type,vector_type> >();
+
+		//	check if correct types are present
+			if(op.invalid())
+				UG_THROW("GroupAgglomeratingSolver::init:"
+						" Passed operator is not matrix-based.");
+
+		//	forward request
+			return init(op);
+		}
+
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > A, const vector_type& u)
+		{
+			return init(A);
+		}
+
+		virtual bool init(SmartPtr<MatrixOperator<matrix_type, vector_type> > Op)
+		{
+			try{
+			PROFILE_FUNC();
+		//	get matrix of Operator
+			m_pMatrix = &Op->get_matrix();
+
+			if(is_serial())
+				return m_spLinOpInverse->init(Op);
+
+#ifdef UG_PARALLEL
+			UG_COND_THROW(!block_traits<value_type>::is_static,
+			              "GroupAgglomeratingSolver: only fixed block sizes supported.");
+
+			init_groups();
+
+			bool bSuccess = true;
+			if(m_bGroupRoot)
+				bSuccess = init_full_matrix();
+			return pcl::AllProcsTrue(bSuccess, m_pMatrix->layouts()->proc_comm());
+#else
+			return true;
+#endif
+			}UG_CATCH_THROW("GroupAgglomeratingSolver::" << __FUNCTION__ << " failed")
+		}
+
+		virtual bool apply(vector_type& x, const vector_type& b)
+		{
+			try{
+			PROFILE_FUNC();
+			if(is_serial())
+				return m_spLinOpInverse->apply(x, b);
+#ifdef UG_PARALLEL
+			pcl::InterfaceCommunicator<IndexLayout>& com = m_pMatrix->layouts()->comm();
+
+		//	the defect is gathered additively
+			SmartPtr<vector_type> spB;
+			const vector_type* pB = &b;
+			if(!b.has_storage_type(PST_ADDITIVE))
+			{
+				spB = b.clone();
+				spB->change_storage_type(PST_ADDITIVE);
+				pB = spB.get();
+			}
+
+		//	1. gather on group roots
+			GatherVectorOnOne(m_groupMaster, m_groupSlave, com, m_groupB, *pB,
+			                  PST_ADDITIVE, m_bGroupRoot);
+
+		//	2. sum up the group parts in the global numbering and solve
+			if(m_bGroupRoot)
+			{
+				const size_t bs = block_traits<value_type>::static_size;
+				std::vector<number> vGroupPart(m_numFull * bs, 0.0);
+				std::vector<number> vFull(m_numFull * bs, 0.0);
+				for(size_t i = 0; i < m_groupToFull.size(); ++i)
+					for(size_t k = 0; k < bs; ++k)
+						vGroupPart[m_groupToFull[i]*bs + k] += BlockRef(m_groupB[i], k);
+
+				if(m_bRedundant)
+					m_rootComm.allreduce(&vGroupPart[0], &vFull[0], vFull.size(), PCL_RO_SUM);
+				else
+					m_rootComm.reduce(&vGroupPart[0], &vFull[0], vFull.size(), PCL_RO_SUM, 0);
+
+				if(m_bHasFullMatrix)
+				{
+					for(size_t i = 0; i < m_numFull; ++i)
+						for(size_t k = 0; k < bs; ++k)
+							BlockRef(m_fullB[i], k) = vFull[i*bs + k];
+					m_fullB.set_storage_type(PST_ADDITIVE);
+					m_fullX.set(0.0);
+
+					if(!m_spLinOpInverse->apply(m_fullX, m_fullB))
+						UG_LOG("GroupAgglomeratingSolver: inner solver "
+								<< m_spLinOpInverse->name() << " did not converge.\n");
+
+					for(size_t i = 0; i < m_numFull; ++i)
+						for(size_t k = 0; k < bs; ++k)
+							vFull[i*bs + k] = BlockRef(m_fullX[i], k);
+				}
+
+				if(!m_bRedundant)
+					m_rootComm.broadcast(&vFull[0], vFull.size(), 0);
+
+				for(size_t i = 0; i < m_groupToFull.size(); ++i)
+					for(size_t k = 0; k < bs; ++k)
+						BlockRef(m_groupX[i], k) = vFull[m_groupToFull[i]*bs + k];
+				m_groupX.set_storage_type(PST_CONSISTENT);
+			}
+
+		//	3. distribute the solution in the groups
+			BroadcastVectorFromOne(m_groupMaster, m_groupSlave, com, x, m_groupX,
+			                       PST_CONSISTENT, m_bGroupRoot);
+#endif
+			}UG_CATCH_THROW("GroupAgglomeratingSolver::" << __FUNCTION__ << " failed")
+		//	we're done
+			return true;
+		}
+
+	// 	Compute u = L^{-1} * f AND return defect f := f - L*u
+		virtual bool apply_return_defect(vector_type& u, vector_type& f)
+		{
+			PROFILE_FUNC();
+		//	solve u
+			if(!apply(u, f)) return false;
+
+		//	calculate defect
+			f.set(0.0);
+			if(!m_pMatrix->matmul_minus(f, u))
+			{
+				UG_LOG("ERROR in 'GroupAgglomeratingSolver::apply_return_defect': Cannot apply matmul_minus.\n");
+				return false;
+			}
+
+		//	we're done
+			return true;
+		}
+
+		virtual bool apply_update_defect(vector_type& u, vector_type& f)
+		{
+			PROFILE_FUNC();
+		//	solve u
+			if(!apply(u, f)) return false;
+
+		//	update defect
+			if(!m_pMatrix->matmul_minus(f, u))
+			{
+				UG_LOG("ERROR in 'GroupAgglomeratingSolver::apply_update_defect': Cannot apply matmul_minus.\n");
+				return false;
+			}
+
+		//	we're done
+			return true;
+		}
+
+	protected:
+		bool is_serial()
+		{
+			UG_COND_THROW(m_pMatrix == NULL, "ERROR: No Matrix given.");
+#ifdef UG_PARALLEL
+			return m_pMatrix->layouts()->proc_comm().is_local() || m_pMatrix->layouts()->proc_comm().empty();
+#else
+			return true;
+#endif
+		}
+
+#ifdef UG_PARALLEL
+	///	chooses the groups, creates the communicators and collects the group matrices
+		void init_groups()
+		{
+			PROFILE_FUNC();
+			const matrix_type& A = *m_pMatrix;
+			const pcl::ProcessCommunicator& pc = A.layouts()->proc_comm();
+			const size_t numProcs = pc.size();
+			const size_t myIndex = pc.get_local_proc_id();
+
+		//	global number of unknowns (each unknown is counted on its master)
+			std::vector<bool> vIsSlave(A.num_rows(), false);
+			MarkAllFromLayout(vIsSlave, A.layouts()->slave());
+			size_t numOwned = 0;
+			for(size_t i = 0; i < vIsSlave.size(); ++i)
+				if(!vIsSlave[i]) numOwned++;
+			const size_t globalN = pc.allreduce(numOwned, PCL_RO_SUM);
+
+		//	choose group size
+			size_t groupSize = m_groupSize;
+			if(groupSize == 0)
+			{
+				const size_t dofsPerProc = std::max<size_t>(1, globalN / numProcs);
+				const size_t maxGroupSize = (size_t) std::ceil(std::sqrt((double) numProcs));
+				groupSize = (m_gatherDoFs + dofsPerProc - 1) / dofsPerProc;
+				groupSize = std::max<size_t>(1, std::min(groupSize, maxGroupSize));
+			}
+			groupSize = std::min(groupSize, numProcs);
+			m_bRedundant = (globalN <= m_maxRedundantDoFs);
+			m_bGroupRoot = (myIndex % groupSize == 0);
+
+			UG_DLOG(LIB_ALG_LINEAR_SOLVER, 1, "GroupAgglomeratingSolver: " << globalN
+					<< " unknowns on " << numProcs << " procs, group size " << groupSize
+					<< (m_bRedundant ? ", redundant solve.\n" : ", single solve.\n"));
+
+		//	create group and root communicators
+			m_groupComm = pc.split((int) (myIndex / groupSize));
+			m_rootComm = pc.split(m_bGroupRoot ? 0 : -1);
+
+		//	collect matrix on group roots
+			ParallelNodes PN(A.layouts(), A.num_rows());
+			m_groupA.set_layouts(SmartPtr<AlgebraLayouts>(new AlgebraLayouts));
+			CollectMatrixOnOneProc(A, m_groupA, m_groupMaster, m_groupSlave, m_groupComm, PN);
+
+			m_groupB.set_layouts(CreateLocalAlgebraLayouts());
+			m_groupX.set_layouts(CreateLocalAlgebraLayouts());
+			if(!m_bGroupRoot) return;
+
+			const size_t numGroupRows = m_groupA.num_rows();
+			m_groupB.resize(numGroupRows);
+			m_groupX.resize(numGroupRows);
+
+		//	agree on a numbering of all unknowns: each root contributes the
+		//	global ids of its rows, new ids are numbered in order of the roots
+			BinaryBuffer idBuf;
+			Serialize(idBuf, numGroupRows);
+			for(size_t i = 0; i < numGroupRows; ++i)
+				Serialize(idBuf, PN.local_to_global(i));
+
+			std::vector<char> vSendIDs(idBuf.buffer(), idBuf.buffer() + idBuf.write_pos());
+			std::vector<char> vRecvIDs;
+			m_rootComm.allgatherv(vRecvIDs, vSendIDs);
+
+			BinaryBuffer allIDs;
+			if(!vRecvIDs.empty())
+				allIDs.write(&vRecvIDs[0], vRecvIDs.size());
+
+			const size_t myRootIndex = m_rootComm.get_local_proc_id();
+			std::map<AlgebraID, size_t> fullIndex;
+			m_groupToFull.resize(numGroupRows);
+			for(size_t r = 0; r < m_rootComm.size(); ++r)
+			{
+				size_t numRows;
+				Deserialize(allIDs, numRows);
+				for(size_t i = 0; i < numRows; ++i)
+				{
+					AlgebraID id;
+					Deserialize(allIDs, id);
+					typename std::map<AlgebraID, size_t>::iterator it = fullIndex.find(id);
+					if(it == fullIndex.end())
+						it = fullIndex.insert(std::make_pair(id, fullIndex.size())).first;
+					if(r == myRootIndex)
+						m_groupToFull[i] = it->second;
+				}
+			}
+			m_numFull = fullIndex.size();
+			m_bHasFullMatrix = m_bRedundant || myRootIndex == 0;
+		}
+
+	///	assembles the full matrix from the group matrices and inits the inner solver
+		bool init_full_matrix()
+		{
+			PROFILE_FUNC();
+		//	serialize the rows of the group matrix in the full numbering
+			const matrix_type& groupA = m_groupA;
+			BinaryBuffer rowBuf;
+			Serialize(rowBuf, groupA.num_rows());
+			for(size_t i = 0; i < groupA.num_rows(); ++i)
+			{
+				Serialize(rowBuf, m_groupToFull[i]);
+				Serialize(rowBuf, groupA.num_connections(i));
+				for(typename matrix_type::const_row_iterator conn = groupA.begin_row(i);
+						conn != groupA.end_row(i); ++conn)
+				{
+					Serialize(rowBuf, m_groupToFull[conn.index()]);
+					Serialize(rowBuf, conn.value());
+				}
+			}
+
+			std::vector<char> vSendRows(rowBuf.buffer(), rowBuf.buffer() + rowBuf.write_pos());
+			std::vector<char> vRecvRows;
+			if(m_bRedundant) m_rootComm.allgatherv(vRecvRows, vSendRows);
+			else m_rootComm.gatherv(vRecvRows, vSendRows, 0);
+
+		//	the group matrix is not needed any more
+			m_groupA.resize_and_clear(0, 0);
+			if(!m_bHasFullMatrix) return true;
+
+		//	sum up the rows of all groups
+			m_spFullOp = make_sp(new MatrixOperator<matrix_type, vector_type>());
+			matrix_type& fullA = m_spFullOp->get_matrix();
+			fullA.resize_and_clear(m_numFull, m_numFull);
+
+			BinaryBuffer allRows;
+			if(!vRecvRows.empty())
+				allRows.write(&vRecvRows[0], vRecvRows.size());
+
+			std::vector<typename matrix_type::connection> cons;
+			for(size_t r = 0; r < m_rootComm.size(); ++r)
+			{
+				size_t numRows;
+				Deserialize(allRows, numRows);
+				for(size_t i = 0; i < numRows; ++i)
+				{
+					size_t row, numCons;
+					Deserialize(allRows, row);
+					Deserialize(allRows, numCons);
+					cons.resize(numCons);
+					for(size_t j = 0; j < numCons; ++j)
+					{
+						Deserialize(allRows, cons[j].iIndex);
+						Deserialize(allRows, cons[j].dValue);
+					}
+					if(numCons)
+						fullA.add_matrix_row(row, &cons[0], numCons);
+				}
+			}
+			fullA.set_layouts(CreateLocalAlgebraLayouts());
+
+			m_fullB.set_layouts(CreateLocalAlgebraLayouts());
+			m_fullX.set_layouts(CreateLocalAlgebraLayouts());
+			m_fullB.resize(m_numFull);
+			m_fullX.resize(m_numFull);
+
+			return m_spLinOpInverse->init(m_spFullOp);
+		}
+#endif
+
+	protected:
+	///	inner solver for the agglomerated matrix
+		SmartPtr<ILinearOperatorInverse<vector_type, vector_type> > m_spLinOpInverse;
+		std::string m_name;
+
+	///	number of processes per group (0 = automatic)
+		size_t m_groupSize;
+
+	///	number of unknowns per group root in automatic mode
+		size_t m_gatherDoFs;
+
+	///	maximal global number of unknowns for redundant solves
+		size_t m_maxRedundantDoFs;
+
+	///	matrix to invert
+		matrix_type* m_pMatrix;
+
+	///	flags of this process
+		bool m_bGroupRoot;
+		bool m_bHasFullMatrix;
+		bool m_bRedundant;
+
+	///	size of the full matrix
+		size_t m_numFull;
+
+	///	group index -> index in full matrix (only on group roots)
+		std::vector<size_t> m_groupToFull;
+
+#ifdef UG_PARALLEL
+	///	communicators of the group and of all group roots
+		pcl::ProcessCommunicator m_groupComm;
+		pcl::ProcessCommunicator m_rootComm;
+
+	///	agglomeration layouts inside the group
+		IndexLayout m_groupMaster, m_groupSlave;
+
+	///	collected group matrix and vectors (only on group roots)
+		matrix_type m_groupA;
+		vector_type m_groupB, m_groupX;
+
+	///	full matrix operator and vectors (only on solving group roots)
+		SmartPtr<MatrixOperator<matrix_type, vector_type> > m_spFullOp;
+		vector_type m_fullB, m_fullX;
+#endif
+};
+
+} // end namespace ug
+
+#endif /* __H__LIB_ALGEBRA__GROUP_AGGLOMERATING_SOLVER__ */
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_BICGSTAB__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_BICGSTAB__
+
+#include <iostream>
+#include <string>
+#include <sstream>
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "lib_algebra/operator/interface/pprocess.h"
+#include "lib_algebra/algebra_common/fused_reduction.h"
+#include "common/profiler/profiler.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	the pipelined BiCGStab method as a solver for linear operators
+/**
+ * This class implements a pipelined variant of the (right) preconditioned
+ * BiCGStab method for the solution of linear operator problems like A*x = b.
+ * The inner products of one iteration are summed up in two global
+ * reductions (instead of five in BiCGStab), one of them including the norm
+ * of the defect for the convergence check. Each reduction is started before
+ * an application of the preconditioner and the operator and finished
+ * afterwards, such that the reduction can be overlapped with this work.
+ *
+ * If the convergence check only needs the defect norm (defect_is_norm), the
+ * norm is computed within the fused reduction and passed by update_defect.
+ * Otherwise, or if set_fused_defect_norm(false) is used, the convergence
+ * check computes the defect norm itself with an additional reduction.
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - Cools, Vanroose, "The communication-hiding pipelined BiCGStab method
+ *   for the parallel solution of large unsymmetric linear systems",
+ *   Parallel Computing 65 (2017), Alg. 3
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class PipelinedBiCGStab
+	: public IPreconditionedLinearOperatorInverse<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Base type
+		typedef IPreconditionedLinearOperatorInverse<vector_type> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+		using base_type::write_debug;
+
+	public:
+	///	constructors
+		PipelinedBiCGStab() : base_type(), m_bFusedDefectNorm(true) {}
+
+		PipelinedBiCGStab(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond)
+			: base_type ( spPrecond ), m_bFusedDefectNorm(true) {}
+
+		PipelinedBiCGStab(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond, SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type ( spPrecond, spConvCheck), m_bFusedDefectNorm(true) {}
+
+	///	name of solver
+		virtual const char* name() const {return "PipelinedBiCGStab";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(preconditioner().valid())
+				return preconditioner()->supports_parallel();
+			return true;
+		}
+
+	// 	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
+		{
+			PROFILE_BEGIN_GROUP(PipelinedBiCGStab_apply_return_defect, "BiCGStab algebra");
+		//	check correct storage type in parallel
+			#ifdef UG_PARALLEL
+			if(!b.has_storage_type(PST_ADDITIVE) || !x.has_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedBiCGStab: Inadequate storage format of Vectors.");
+			#endif
+
+		// 	build defect:  r := b - A*x
+			linear_operator()->apply_sub(b, x);
+			vector_type& r = b;
+
+		// 	create vectors (additive: r, w, s, z, t, v, q, y; consistent: r0
+		//	and the preconditioned vectors rh, wh, ph, sh, zh, qh)
+			SmartPtr<vector_type> spR0 = r.clone_without_values(); vector_type& r0 = *spR0;
+			SmartPtr<vector_type> spW = r.clone_without_values(); vector_type& w = *spW;
+			SmartPtr<vector_type> spS = r.clone_without_values(); vector_type& s = *spS;
+			SmartPtr<vector_type> spZ = r.clone_without_values(); vector_type& z = *spZ;
+			SmartPtr<vector_type> spT = r.clone_without_values(); vector_type& t = *spT;
+			SmartPtr<vector_type> spV = r.clone_without_values(); vector_type& v = *spV;
+			SmartPtr<vector_type> spQ = r.clone_without_values(); vector_type& q = *spQ;
+			SmartPtr<vector_type> spY = r.clone_without_values(); vector_type& y = *spY;
+			SmartPtr<vector_type> spRh = x.clone_without_values(); vector_type& rh = *spRh;
+			SmartPtr<vector_type> spWh = x.clone_without_values(); vector_type& wh = *spWh;
+			SmartPtr<vector_type> spPh = x.clone_without_values(); vector_type& ph = *spPh;
+			SmartPtr<vector_type> spSh = x.clone_without_values(); vector_type& sh = *spSh;
+			SmartPtr<vector_type> spZh = x.clone_without_values(); vector_type& zh = *spZh;
+			SmartPtr<vector_type> spQh = x.clone_without_values(); vector_type& qh = *spQh;
+
+		//	directions start with zero (this gives ph = rh in the first step)
+			ph = 0.0; s = 0.0; sh = 0.0; z = 0.0; zh = 0.0; v = 0.0;
+
+			prepare_conv_check();
+
+			write_debugXR(x, r, convergence_check()->step(), 'i');
+
+		//	rh := M^-1 r, w := A*rh
+			if(!precondition(rh, r, 'i')) return false;
+			linear_operator()->apply(w, rh);
+
+		//	shadow defect (consistent, such that (r0,.) needs no communication)
+			r0 = r;
+			#ifdef UG_PARALLEL
+			if(!r0.change_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedBiCGStab: Cannot convert r0 to consistent vector.");
+			#endif
+
+		//	reduce (r0,r), (r0,w) and ||r||^2, overlapped with
+		//	wh := M^-1 w, t := A*wh
+			const bool bFusedNorm = m_bFusedDefectNorm && convergence_check()->defect_is_norm();
+			std::vector<vector_type*> vW(2);
+			vW[0] = &r; vW[1] = &w;
+			FusedReduction<vector_type> red;
+			size_t iR0R = red.add_dotprods(r0, vW);
+			size_t iR0W = iR0R + 1;
+			size_t iNorm = bFusedNorm ? red.add_norm2(r) : 0;
+			red.start();
+			if(!precondition(wh, w, 'i')) return false;
+			linear_operator()->apply(t, wh);
+			red.finish();
+
+			if(bFusedNorm)
+				convergence_check()->start_defect(sqrt(red.value(iNorm)));
+			else
+				convergence_check()->start(r);
+
+			number rho = red.value(iR0R);
+			number alpha = red.value(iR0W);
+			number beta = 0.0, omega = 1.0;
+
+			if(!convergence_check()->iteration_ended())
+			{
+				if(alpha == 0.0){
+					UG_LOG("PipelinedBiCGStab: Method breakdown: (r0,w) = "
+							<<alpha<<". Aborting iteration.\n");
+					return false;
+				}
+				alpha = rho / alpha;
+			}
+
+		// 	Iteration loop
+			while(!convergence_check()->iteration_ended())
+			{
+			//	update search directions
+				VecScaleAdd(ph, 1.0, rh, beta, ph, -beta*omega, sh);
+				VecScaleAdd(s, 1.0, w, beta, s, -beta*omega, z);
+				VecScaleAdd(sh, 1.0, wh, beta, sh, -beta*omega, zh);
+				VecScaleAdd(z, 1.0, t, beta, z, -beta*omega, v);
+
+			//	intermediate defect q = r - alpha*s, its preconditioned
+			//	version qh and y = A*qh
+				VecScaleAdd(q, 1.0, r, -alpha, s);
+				VecScaleAdd(qh, 1.0, rh, -alpha, sh);
+				VecScaleAdd(y, 1.0, w, -alpha, z);
+
+			//	make q and y unique for the inner products
+				#ifdef UG_PARALLEL
+				if(!q.change_storage_type(PST_UNIQUE) || !y.change_storage_type(PST_UNIQUE))
+					UG_THROW("PipelinedBiCGStab: Cannot convert q, y to unique vectors.");
+				#endif
+
+			//	reduce (q,y) and (y,y), overlapped with zh := M^-1 z, v := A*zh
+				red.clear();
+				vW.resize(2); vW[0] = &q; vW[1] = &y;
+				const size_t iQY = red.add_dotprods(y, vW);
+				const size_t iYY = iQY + 1;
+				red.start();
+				if(!precondition(zh, z, 'a')) return false;
+				linear_operator()->apply(v, zh);
+				red.finish();
+
+				const number yy = red.value(iYY);
+				if(yy == 0.0){
+					UG_LOG("PipelinedBiCGStab: Method breakdown (y,y) = "<<yy<<
+					       " is an invalid value. Aborting iteration.\n");
+					return false;
+				}
+				omega = red.value(iQY) / yy;
+
+			//	update solution and defects
+				VecScaleAdd(x, 1.0, x, alpha, ph, omega, qh);
+				VecScaleAdd(r, 1.0, q, -omega, y);
+				VecScaleAdd(rh, 1.0, qh, -omega, wh, omega*alpha, zh);
+				VecScaleAdd(w, 1.0, y, -omega, t, omega*alpha, v);
+
+			//	reduce (r0,r), (r0,w), (r0,s), (r0,z) and ||r||^2, overlapped
+			//	with wh := M^-1 w, t := A*wh
+				red.clear();
+				vW.resize(4); vW[0] = &r; vW[1] = &w; vW[2] = &s; vW[3] = &z;
+				iR0R = red.add_dotprods(r0, vW);
+				iR0W = iR0R + 1;
+				const size_t iR0S = iR0R + 2;
+				const size_t iR0Z = iR0R + 3;
+				iNorm = bFusedNorm ? red.add_norm2(r) : 0;
+				red.start();
+				if(!precondition(wh, w, 'b')) return false;
+				linear_operator()->apply(t, wh);
+				red.finish();
+
+			// 	check convergence
+				if(bFusedNorm)
+					convergence_check()->update_defect(sqrt(red.value(iNorm)));
+				else
+					convergence_check()->update(r);
+
+				write_debugXR(x, r, convergence_check()->step(), 'b');
+
+				if(convergence_check()->iteration_ended()) break;
+
+			//	check values
+				if(omega == 0.0 || rho == 0.0)
+				{
+					UG_LOG("PipelinedBiCGStab: Method breakdown with omega = "<<omega<<
+					       ", rho = "<<rho<<". Aborting iteration.\n");
+					return false;
+				}
+
+			//	compute new beta and alpha
+				const number rhoNew = red.value(iR0R);
+				beta = (alpha/omega) * (rhoNew/rho);
+				rho = rhoNew;
+
+				const number denom = red.value(iR0W) + beta * red.value(iR0S)
+									- beta * omega * red.value(iR0Z);
+				if(denom == 0.0){
+					UG_LOG("PipelinedBiCGStab: Method breakdown: alpha = "<<denom<<
+					       " is an invalid value. Aborting iteration.\n");
+					return false;
+				}
+				alpha = rho / denom;
+			}
+
+		//	print ending output
+			return convergence_check()->post();
+		}
+
+	///	sets if the defect norm is computed within the fused reduction
+		void set_fused_defect_norm(bool bFused) {m_bFusedDefectNorm = bFused;}
+
+	///	adds a post-process for the iterates
+		void add_postprocess_corr (SmartPtr<IPProcessVector<vector_type> > p)
+		{
+			m_corr_post_process.add (p);
+		}
+
+	///	removes a post-process for the iterates
+		void remove_postprocess_corr (SmartPtr<IPProcessVector<vector_type> > p)
+		{
+			m_corr_post_process.remove (p);
+		}
+
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "PipelinedBiCGStab( fused_defect_norm = " << m_bFusedDefectNorm << ")\n";
+			ss << base_type::config_string_preconditioner_convergence_check();
+			return ss.str();
+		}
+
+	protected:
+	///	computes c := M^-1 d as consistent vector
+		bool precondition(vector_type& c, vector_type& d, char phase)
+		{
+			if(preconditioner().valid())
+			{
+				enter_precond_debug_section(convergence_check()->step(), phase);
+				if(!preconditioner()->apply(c, d))
+				{
+					UG_LOG("PipelinedBiCGStab: Cannot apply preconditioner. Aborting.\n");
+					this->leave_vector_debug_writer_section();
+					return false;
+				}
+				this->leave_vector_debug_writer_section();
+			}
+			else c = d;
+
+			#ifdef UG_PARALLEL
+			if(!c.change_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedBiCGStab: Cannot convert vector to consistent vector.");
+			#endif
+
+		//	post-process the correction
+			m_corr_post_process.apply (c);
+			return true;
+		}
+
+	///	prepares the output of the convergence check
+		void prepare_conv_check()
+		{
+		//	set iteration symbol and name
+			convergence_check()->set_name(name());
+			convergence_check()->set_symbol('%');
+
+		//	set preconditioner string
+			std::string s;
+			if(preconditioner().valid())
+			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
+			else
+				s = " (No Preconditioner) ";
+			convergence_check()->set_info(s);
+		}
+
+	/// debugger output: solution and residual
+		void write_debugXR(vector_type &x, vector_type &r, int loopCnt, char phase)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "-%c_iter%03d", phase, loopCnt);
+			write_debug(r, std::string("PipelinedBiCGStab_Residual") + ext + ".vec");
+			write_debug(x, std::string("PipelinedBiCGStab_Solution") + ext + ".vec");
+		}
+
+	/// debugger section for the preconditioner
+		void enter_precond_debug_section(int loopCnt, char phase)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "-%c_iter%03d", phase, loopCnt);
+			this->enter_vector_debug_writer_section(std::string("PipelinedBiCGStab_Precond") + ext);
+		}
+
+	protected:
+	///	flag if the defect norm is part of the fused reduction
+		bool m_bFusedDefectNorm;
+
+	///	postprocessor for the correction in the iterations
+		PProcessChain<vector_type> m_corr_post_process;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_BICGSTAB__ */
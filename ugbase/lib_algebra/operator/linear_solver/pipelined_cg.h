@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__
+
+#include <iostream>
+#include <string>
+#include <sstream>
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "lib_algebra/operator/interface/pprocess.h"
+#include "lib_algebra/algebra_common/fused_reduction.h"
+#include "common/profiler/profiler.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	the pipelined CG method as a solver for linear operators
+/**
+ * This class implements a pipelined variant of the preconditioned CG method
+ * for the solution of linear operator problems like A*x = b. Mathematically,
+ * it computes the same iterates as CG, but all inner products of one
+ * iteration (and the defect norm used by the convergence check) are summed
+ * up in a single global reduction. This reduction is started before the
+ * preconditioner and the operator are applied and finished afterwards, such
+ * that the reduction can be overlapped with this work.
+ *
+ * The price are four additional auxiliary vectors and additional vector
+ * updates. In addition, the recursively updated defect may deviate from the
+ * true defect in finite precision. Therefore, the true defect can be
+ * recomputed every n steps (set_residual_replacement).
+ *
+ * If the convergence check only needs the defect norm (defect_is_norm), the
+ * norm is computed within the fused reduction and passed by update_defect.
+ * Otherwise, or if set_fused_defect_norm(false) is used, the convergence
+ * check computes the defect norm itself with an additional reduction.
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - Ghysels, Vanroose, "Hiding global synchronization latency in the
+ *   preconditioned Conjugate Gradient algorithm", Parallel Computing 40
+ *   (2014), Alg. 4
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class PipelinedCG
+	: public IPreconditionedLinearOperatorInverse<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Base type
+		typedef IPreconditionedLinearOperatorInverse<vector_type> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+		using base_type::write_debug;
+
+	public:
+	///	constructors
+		PipelinedCG() : base_type(), m_numReplace(0), m_bFusedDefectNorm(true) {}
+
+		PipelinedCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond)
+			: base_type ( spPrecond ), m_numReplace(0), m_bFusedDefectNorm(true) {}
+
+		PipelinedCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond, SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type ( spPrecond, spConvCheck), m_numReplace(0), m_bFusedDefectNorm(true) {}
+
+	///	name of solver
+		virtual const char* name() const {return "PipelinedCG";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(preconditioner().valid())
+				return preconditioner()->supports_parallel();
+			return true;
+		}
+
+	///	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
+		{
+			PROFILE_BEGIN_GROUP(PipelinedCG_apply_return_defect, "CG algebra");
+		//	check parallel storage types
+			#ifdef UG_PARALLEL
+			if(!b.has_storage_type(PST_ADDITIVE) || !x.has_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedCG::apply_return_defect:"
+								"Inadequate storage format of Vectors.");
+			#endif
+
+		//	remember rhs for residual replacement
+			SmartPtr<vector_type> spB;
+			if(m_numReplace > 0) spB = b.clone();
+
+		// 	rename r as b (for convenience)
+			vector_type& r = b;
+
+		// 	Build defect:  r := b - J(u)*x
+			linear_operator()->apply_sub(r, x);
+
+		// 	create help vectors (additive: w, n, s, z; consistent: u, m, p, q)
+			SmartPtr<vector_type> spU = x.clone_without_values(); vector_type& u = *spU;
+			SmartPtr<vector_type> spW = r.clone_without_values(); vector_type& w = *spW;
+			SmartPtr<vector_type> spM = x.clone_without_values(); vector_type& m = *spM;
+			SmartPtr<vector_type> spN = r.clone_without_values(); vector_type& n = *spN;
+			SmartPtr<vector_type> spP = x.clone_without_values(); vector_type& p = *spP;
+			SmartPtr<vector_type> spQ = x.clone_without_values(); vector_type& q = *spQ;
+			SmartPtr<vector_type> spS = r.clone_without_values(); vector_type& s = *spS;
+			SmartPtr<vector_type> spZ = r.clone_without_values(); vector_type& z = *spZ;
+
+		//	directions start with zero (this gives p = u in the first step)
+			p = 0.0; q = 0.0; s = 0.0; z = 0.0;
+
+			write_debugXR(x, r, convergence_check()->step());
+
+		//	u := M^-1 r, w := A*u
+			if(!precondition(u, r)) return false;
+			linear_operator()->apply(w, u);
+
+			prepare_conv_check();
+
+			number alpha = 0.0, gammaOld = 0.0;
+			bool bFirst = true;
+			const bool bFusedNorm = m_bFusedDefectNorm && convergence_check()->defect_is_norm();
+			std::vector<vector_type*> vW(2);
+			vW[0] = &r; vW[1] = &w;
+			FusedReduction<vector_type> red;
+
+		// 	Iteration loop
+			while(true)
+			{
+			//	start reduction of gamma = (r,u), delta = (w,u) and ||r||^2
+				red.clear();
+				const size_t iGamma = red.add_dotprods(u, vW);
+				const size_t iDelta = iGamma + 1;
+				const size_t iNorm = bFusedNorm ? red.add_norm2(r) : 0;
+				red.start();
+
+			//	m := M^-1 w, n := A*m (overlapped with the reduction)
+				if(!precondition(m, w)) return false;
+				linear_operator()->apply(n, m);
+
+				red.finish();
+				const number gamma = red.value(iGamma);
+				const number delta = red.value(iDelta);
+
+			// 	check convergence of current defect
+				if(bFirst){
+					if(bFusedNorm)
+						convergence_check()->start_defect(sqrt(red.value(iNorm)));
+					else
+						convergence_check()->start(r);
+				}
+				else{
+					write_debugXR(x, r, convergence_check()->step());
+					if(bFusedNorm)
+						convergence_check()->update_defect(sqrt(red.value(iNorm)));
+					else
+						convergence_check()->update(r);
+				}
+				if(convergence_check()->iteration_ended()) break;
+
+			//	compute alpha and beta
+				number beta = 0.0, lambda = delta;
+				if(!bFirst){
+					beta = gamma / gammaOld;
+					lambda = delta - beta * gamma / alpha;
+				}
+
+			//	check lambda
+				if(lambda == 0.0)
+				{
+					if (u.size())
+					{
+						UG_LOG("ERROR in 'PipelinedCG::apply_return_defect': lambda=" <<
+							lambda<< " is not admitted. Aborting solver.\n");
+						return false;
+					}
+				//	in cases where a proc has no geometry, we do not want to fail here
+					else
+						lambda = 1.0;
+				}
+				alpha = gamma / lambda;
+				gammaOld = gamma;
+				bFirst = false;
+
+			//	update directions
+				VecScaleAdd(z, 1.0, n, beta, z);
+				VecScaleAdd(q, 1.0, m, beta, q);
+				VecScaleAdd(s, 1.0, w, beta, s);
+				VecScaleAdd(p, 1.0, u, beta, p);
+
+			//	update solution and (preconditioned) defects
+				VecScaleAddPair(x, alpha, p, r, -alpha, s);
+				VecScaleAddPair(u, -alpha, q, w, -alpha, z);
+
+			//	replace recursively computed defects by true ones
+				if(m_numReplace > 0 &&
+					(convergence_check()->step() + 1) % m_numReplace == 0)
+				{
+					r = *spB;
+					linear_operator()->apply_sub(r, x);
+					if(!precondition(u, r)) return false;
+					linear_operator()->apply(w, u);
+					linear_operator()->apply(s, p);
+					if(!precondition(q, s)) return false;
+					linear_operator()->apply(z, q);
+				}
+			}
+
+		//	post output
+			return convergence_check()->post();
+		}
+
+	///	recomputes the true defect every numReplace steps (0 = never)
+		void set_residual_replacement(int numReplace) {m_numReplace = numReplace;}
+
+	///	sets if the defect norm is computed within the fused reduction
+		void set_fused_defect_norm(bool bFused) {m_bFusedDefectNorm = bFused;}
+
+	///	adds a post-process for the iterates
+		void add_postprocess_corr (SmartPtr<IPProcessVector<vector_type> > p)
+		{
+			m_corr_post_process.add (p);
+		}
+
+	///	removes a post-process for the iterates
+		void remove_postprocess_corr (SmartPtr<IPProcessVector<vector_type> > p)
+		{
+			m_corr_post_process.remove (p);
+		}
+
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "PipelinedCG( residual_replacement = " << m_numReplace
+			   << ", fused_defect_norm = " << m_bFusedDefectNorm << ")\n";
+			ss << base_type::config_string_preconditioner_convergence_check();
+			return ss.str();
+		}
+
+	protected:
+	///	computes c := M^-1 d as consistent vector
+		bool precondition(vector_type& c, vector_type& d)
+		{
+			if(preconditioner().valid())
+			{
+				enter_precond_debug_section(convergence_check()->step());
+				if(!preconditioner()->apply(c, d))
+				{
+					UG_LOG("ERROR in 'PipelinedCG::apply_return_defect': "
+							"Cannot apply preconditioner. Aborting.\n");
+					this->leave_vector_debug_writer_section();
+					return false;
+				}
+				this->leave_vector_debug_writer_section();
+			}
+			else c = d;
+
+			#ifdef UG_PARALLEL
+			if(!c.change_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedCG::apply_return_defect: "
+								"Cannot convert vector to consistent vector.");
+			#endif
+
+		//	post-process the correction
+			m_corr_post_process.apply (c);
+			return true;
+		}
+
+	///	adjust output of convergence check
+		void prepare_conv_check()
+		{
+		//	set iteration symbol and name
+			convergence_check()->set_name(name());
+			convergence_check()->set_symbol('%');
+
+		//	set preconditioner string
+			std::string s;
+			if(preconditioner().valid())
+			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
+			else
+				s = " (No Preconditioner) ";
+			convergence_check()->set_info(s);
+		}
+
+	/// debugger output: solution and residual
+		void write_debugXR(vector_type &x, vector_type &r, int loopCnt)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "_iter%03d", loopCnt);
+			write_debug(r, std::string("PipelinedCG_Residual") + ext + ".vec");
+			write_debug(x, std::string("PipelinedCG_Solution") + ext + ".vec");
+		}
+
+	/// debugger section for the preconditioner
+		void enter_precond_debug_section(int loopCnt)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; sprintf(ext, "_iter%03d", loopCnt);
+			this->enter_vector_debug_writer_section(std::string("PipelinedCG_Precond_") + ext);
+		}
+
+	protected:
+	///	recompute true defect every m_numReplace steps (0 = never)
+		int m_numReplace;
+
+	///	flag if the defect norm is part of the fused reduction
+		bool m_bFusedDefectNorm;
+
+	///	postprocessor for the correction in the iterations
+		PProcessChain<vector_type> m_corr_post_process;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__ */
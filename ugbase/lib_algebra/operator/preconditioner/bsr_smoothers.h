@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__BSR_SMOOTHERS__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__BSR_SMOOTHERS__
+
+#include <vector>
+#include "lib_algebra/operator/interface/preconditioner.h"
+#include "lib_algebra/cpu_algebra/block_sparse_matrix.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	copies the values of a vector into an array in the scalar numbering
+template <typename TVector>
+void CopyToScalarArray(std::vector<double>& vOut, const TVector& v)
+{
+	size_t k = 0;
+	for(size_t i = 0; i < v.size(); ++i)
+		k += GetSize(v[i]);
+	vOut.resize(k);
+
+	k = 0;
+	for(size_t i = 0; i < v.size(); ++i)
+		for(size_t j = 0; j < GetSize(v[i]); ++j)
+			vOut[k++] = BlockRef(v[i], j);
+}
+
+///	copies the values of an array in the scalar numbering into a vector
+template <typename TVector>
+void CopyFromScalarArray(TVector& v, const std::vector<double>& vIn)
+{
+	size_t k = 0;
+	for(size_t i = 0; i < v.size(); ++i)
+		for(size_t j = 0; j < GetSize(v[i]); ++j)
+			BlockRef(v[i], j) = vIn[k++];
+	UG_COND_THROW(k != vIn.size(), "CopyFromScalarArray: vector size " << k
+			<< " does not match the array size " << vIn.size());
+}
+
+///	base class for smoothers working on a block sparse row copy of the matrix
+/**
+ * In preprocess, the matrix is copied into a BlockSparseMatrix. The block rows
+ * are formed by set_block_size consecutive algebra indices or, by default, by
+ * grouping consecutive rows with identical sparsity pattern (e.g. the
+ * interleaved components of a node in a CPU1 algebra) up to
+ * set_max_block_size scalar rows. The derived classes then perform the numeric
+ * setup and the steps on the block storage.
+ *
+ * In parallel, the slave rows are added to the master rows and the smoother
+ * acts on the unique defect, like ILUTScalar.
+ *
+ * Note that the block copy is stored in addition to the matrix of the
+ * operator, which is still needed by the solver. The smoothers thus need more
+ * memory than their SparseMatrix counterparts (about the size of the matrix
+ * in blocked storage, which uses less memory than a SparseMatrix for
+ * matrices with dense node blocks). In serial, derived classes which keep the
+ * matrix values in the block copy (bsr_keeps_values) update the defect in
+ * apply_update_defect through the block storage.
+ */
+template <typename TAlgebra>
+class IBSRPreconditioner : public IPreconditioner<TAlgebra>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Base type
+		typedef IPreconditioner<TAlgebra> base_type;
+
+	public:
+	///	Constructor
+		IBSRPreconditioner() : m_blockSize(0), m_maxBlockSize(8), m_bInfo(false), m_patternRevision(0) {}
+
+	///	clone constructor
+		IBSRPreconditioner(const IBSRPreconditioner<TAlgebra> &parent)
+			: base_type(parent),
+			  m_blockSize(parent.m_blockSize),
+			  m_maxBlockSize(parent.m_maxBlockSize),
+			  m_bInfo(parent.m_bInfo),
+			  m_patternRevision(0)
+		{}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	sets the number of algebra indices per block (0: detect from sparsity pattern, default)
+		void set_block_size(size_t blockSize) {m_blockSize = blockSize; m_patternRevision = 0;}
+
+	///	sets the maximal number of scalar rows of a detected block (default 8)
+		void set_max_block_size(size_t maxBlockSize) {m_maxBlockSize = maxBlockSize; m_patternRevision = 0;}
+
+	///	prints statistics of the block storage in preprocess
+		void set_info(bool bInfo) {m_bInfo = bInfo;}
+
+	///	returns the block storage
+		const BlockSparseMatrix& bsr_matrix() const {return m_bsr;}
+
+	///	computes the correction and updates the defect
+	/**
+	 * In serial, if the block copy still holds the values of the matrix and
+	 * the defect operator is the approximation operator, d -= A*c is computed
+	 * on the block storage.
+	 */
+		virtual bool apply_update_defect(vector_type& c, vector_type& d)
+		{
+#ifndef UG_PARALLEL
+			if(bsr_keeps_values()
+				&& base_type::m_spDefectOperator.get() == base_type::m_spApproxOperator.get())
+			{
+				if(!base_type::compute_correction(c, d)) return false;
+				if(m_bsr.num_rows() == 0) return true;
+
+				PROFILE_BEGIN_GROUP(BSR_update_defect, "algebra BSR");
+				CopyToScalarArray(m_vC, c);
+				CopyToScalarArray(m_vD, d);
+				UG_COND_THROW(m_vD.size() != m_bsr.num_rows(), this->name()
+						<< ": vector size " << m_vD.size()
+						<< " does not match the block matrix size " << m_bsr.num_rows());
+				m_bsr.apply_sub(&m_vD[0], &m_vC[0]);
+				CopyFromScalarArray(d, m_vD);
+				return true;
+			}
+#endif
+			return base_type::apply_update_defect(c, d);
+		}
+
+	protected:
+	///	returns if the block matrix holds the values of the matrix after bsr_preprocess
+		virtual bool bsr_keeps_values() const {return false;}
+
+	///	numeric setup on the block matrix
+		virtual bool bsr_preprocess(BlockSparseMatrix& A) = 0;
+
+	///	computes c = B^{-1} d on the scalar arrays of the block matrix
+		virtual void bsr_step(const BlockSparseMatrix& A, double* c, const double* d) = 0;
+
+	//	Preprocess routine
+		virtual bool preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+		{
+			PROFILE_BEGIN_GROUP(BSR_preprocess, "algebra BSR");
+			const matrix_type& M = *pOp;
+#ifdef 	UG_PARALLEL
+			matrix_type A;
+			A = M;
+
+			MatAddSlaveRowsToMasterRowOverlap0(A);
+
+		//	set zero on slaves
+			std::vector<IndexLayout::Element> vIndex;
+			CollectUniqueElements(vIndex, M.layouts()->slave());
+			SetDirichletRow(A, vIndex);
+#else
+			const matrix_type& A = M;
+#endif
+
+		//	the partition only depends on the sparsity pattern, it is reused if
+		//	the pattern revision of the operator matrix is unchanged
+			if(!base_type::same_pattern(M, m_patternRevision) || m_vBlockOffset.empty()
+				|| m_vBlockOffset.back() != A.num_rows())
+			{
+				if(m_blockSize == 0)
+					BlockSparseMatrix::detect_block_partition(m_vBlockOffset, A, m_maxBlockSize);
+				else
+					BlockSparseMatrix::uniform_block_partition(m_vBlockOffset, A.num_rows(), m_blockSize);
+			}
+			m_patternRevision = base_type::pattern_revision_of(M);
+			m_bsr.init(A, m_vBlockOffset);
+
+			if(m_bInfo)
+			{
+				UG_LOG(this->name() << ": " << m_bsr.num_rows() << " rows in "
+						<< m_bsr.num_block_rows() << " block rows, "
+						<< m_bsr.num_blocks() << " blocks, "
+						<< m_bsr.num_values() << " values, "
+						<< m_bsr.memory() << " bytes.\n");
+			}
+
+			return bsr_preprocess(m_bsr);
+		}
+
+	//	Stepping routine
+		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
+		{
+#ifdef UG_PARALLEL
+			SmartPtr<vector_type> spDtmp = d.clone();
+			spDtmp->change_storage_type(PST_UNIQUE);
+			apply_bsr(c, *spDtmp);
+
+			c.set_storage_type(PST_ADDITIVE);
+			c.change_storage_type(PST_CONSISTENT);
+#else
+			apply_bsr(c, d);
+#endif
+			return true;
+		}
+
+	///	copies d to scalar storage, applies bsr_step and copies back to c
+		void apply_bsr(vector_type& c, const vector_type& d)
+		{
+			PROFILE_BEGIN_GROUP(BSR_step, "algebra BSR");
+			CopyToScalarArray(m_vD, d);
+			UG_COND_THROW(m_vD.size() != m_bsr.num_rows(), this->name()
+					<< ": vector size " << m_vD.size()
+					<< " does not match the block matrix size " << m_bsr.num_rows());
+			m_vC.resize(m_vD.size());
+			if(m_vD.empty()) return;
+
+			bsr_step(m_bsr, &m_vC[0], &m_vD[0]);
+
+			CopyFromScalarArray(c, m_vC);
+		}
+
+	//	Postprocess routine
+		virtual bool postprocess() {return true;}
+
+	protected:
+		BlockSparseMatrix m_bsr;
+		std::vector<size_t> m_vBlockOffset;
+		std::vector<double> m_vC, m_vD;
+
+		size_t m_blockSize;
+		size_t m_maxBlockSize;
+		bool m_bInfo;
+
+	///	pattern revision of the operator matrix the partition was computed for
+		size_t m_patternRevision;
+};
+
+///	Block Gauss-Seidel on block sparse row storage
+/**
+ * Forward, backward or symmetric Gauss-Seidel where the diagonal blocks of
+ * the BlockSparseMatrix are inverted exactly.
+ */
+template <typename TAlgebra>
+class BSRGaussSeidel : public IBSRPreconditioner<TAlgebra>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Base type
+		typedef IBSRPreconditioner<TAlgebra> base_type;
+
+	public:
+	///	Constructor
+		BSRGaussSeidel() : base_type(), m_bBackward(false), m_bSymmetric(false) {}
+
+	///	clone constructor
+		BSRGaussSeidel(const BSRGaussSeidel<TAlgebra> &parent)
+			: base_type(parent),
+			  m_bBackward(parent.m_bBackward),
+			  m_bSymmetric(parent.m_bSymmetric)
+		{}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new BSRGaussSeidel<algebra_type>(*this));
+		}
+
+	///	if true, the block rows are processed in reverse order (default false)
+		void set_backward(bool bBackward) {m_bBackward = bBackward;}
+
+	///	if true, a forward and a backward step are performed (default false)
+		void set_symmetric(bool bSymmetric) {m_bSymmetric = bSymmetric;}
+
+	protected:
+	//	Name of preconditioner
+		virtual const char* name() const {return "BSRGaussSeidel";}
+
+	//	the inverses of the diagonal blocks are stored separately
+		virtual bool bsr_keeps_values() const {return true;}
+
+		virtual bool bsr_preprocess(BlockSparseMatrix& A)
+		{
+			if(!A.invert_diagonal())
+				UG_THROW(name() << ": singular diagonal block.");
+			return true;
+		}
+
+		virtual void bsr_step(const BlockSparseMatrix& A, double* c, const double* d)
+		{
+			if(m_bSymmetric) A.sgs_step(c, d);
+			else if(m_bBackward) A.gs_step_UD(c, d);
+			else A.gs_step_LD(c, d);
+		}
+
+	protected:
+		bool m_bBackward;
+		bool m_bSymmetric;
+};
+
+///	Block ILU(0) on block sparse row storage
+/**
+ * Incomplete LU factorization without fill-in on the block pattern of the
+ * BlockSparseMatrix, the diagonal blocks are inverted exactly.
+ */
+template <typename TAlgebra>
+class BSRILU : public IBSRPreconditioner<TAlgebra>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Base type
+		typedef IBSRPreconditioner<TAlgebra> base_type;
+
+	public:
+	///	Constructor
+		BSRILU() : base_type() {}
+
+	///	clone constructor
+		BSRILU(const BSRILU<TAlgebra> &parent) : base_type(parent) {}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new BSRILU<algebra_type>(*this));
+		}
+
+	protected:
+	//	Name of preconditioner
+		virtual const char* name() const {return "BSRILU";}
+
+		virtual bool bsr_preprocess(BlockSparseMatrix& A)
+		{
+			if(!A.factorize_ilu0())
+				UG_THROW(name() << ": singular diagonal block in factorization.");
+			return true;
+		}
+
+		virtual void bsr_step(const BlockSparseMatrix& A, double* c, const double* d)
+		{
+			A.ilu_solve(c, d);
+		}
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__BSR_SMOOTHERS__ */
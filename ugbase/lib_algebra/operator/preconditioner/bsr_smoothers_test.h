@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__BSR_SMOOTHERS_TEST__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__BSR_SMOOTHERS_TEST__
+
+#include <vector>
+#include "common/error.h"
+#include "common/log.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+#include "bsr_smoothers.h"
+#include "gauss_seidel.h"
+#include "ilu.h"
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+#endif
+
+namespace ug{
+
+///	returns the (global) maximum of the blockwise distance of two vectors
+template <typename TVector>
+number BSRTestDistance(const TVector& a, const TVector& b)
+{
+	number dist = 0;
+	for(size_t i = 0; i < a.size(); ++i)
+	{
+		typename TVector::value_type t = a[i];
+		t -= b[i];
+		dist = std::max(dist, (number)BlockNorm(t));
+	}
+#ifdef UG_PARALLEL
+	const pcl::ProcessCommunicator& pc = a.layouts()->proc_comm();
+	if(!pc.empty()) dist = pc.allreduce(dist, PCL_RO_MAX);
+#endif
+	return dist;
+}
+
+///	applies two preconditioners to d and returns the distance of the corrections
+template <typename TAlgebra>
+number BSRTestCompare(IPreconditioner<TAlgebra>& B, IPreconditioner<TAlgebra>& Ref,
+                      SmartPtr<MatrixOperator<typename TAlgebra::matrix_type,
+                                              typename TAlgebra::vector_type> > spOp,
+                      const typename TAlgebra::vector_type& d)
+{
+	typedef typename TAlgebra::vector_type vector_type;
+
+	SmartPtr<vector_type> spC = d.clone_without_values();
+	SmartPtr<vector_type> spCRef = d.clone_without_values();
+	SmartPtr<vector_type> spD = d.clone();
+
+	if(!B.init(spOp) || !Ref.init(spOp))
+		UG_THROW("TestBSRSmoothers: cannot initialize the smoothers.");
+	if(!B.apply(*spC, *spD) || !Ref.apply(*spCRef, *spD))
+		UG_THROW("TestBSRSmoothers: cannot apply the smoothers.");
+
+	return BSRTestDistance(*spC, *spCRef);
+}
+
+///	compares the block sparse row kernels with their SparseMatrix counterparts
+/**
+ * Computes the product A*x on the block storage, for the detected partition
+ * and for one algebra index per block, and compares it to the product of the
+ * (local) matrix A. With one algebra index per block, the steps of
+ * BSRGaussSeidel (forward, backward and symmetric) and BSRILU are compared to
+ * GaussSeidel, BackwardGaussSeidel, SymmetricGaussSeidel and ILU. Finally,
+ * the defect update of BSRGaussSeidel (done on the block storage in serial)
+ * is compared to the one of GaussSeidel.
+ *
+ * Throws if a result differs by more than tol (relative to the norm of the
+ * reference result, if it is larger than 1).
+ *
+ * \param[in]	spOp	matrix operator (additive in parallel)
+ * \param[in]	d		vector used as x for the products and as defect for the smoothers
+ * \param[in]	tol		relative tolerance
+ */
+template <typename TAlgebra>
+void TestBSRSmoothers(SmartPtr<MatrixOperator<typename TAlgebra::matrix_type,
+                                              typename TAlgebra::vector_type> > spOp,
+                      const typename TAlgebra::vector_type& d, number tol)
+{
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef typename TAlgebra::vector_type vector_type;
+
+	const matrix_type& A = spOp->get_matrix();
+	UG_COND_THROW(A.num_rows() != d.size() || A.num_cols() != d.size(),
+	              "TestBSRSmoothers: sizes of the matrix and the vector do not match.");
+
+//	reference: local product A*x
+	SmartPtr<vector_type> spRef = d.clone_without_values();
+	for(size_t i = 0; i < A.num_rows(); ++i)
+	{
+		(*spRef)[i] = 0.0;
+		for(typename matrix_type::const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+			MatMultAdd((*spRef)[i], 1.0, (*spRef)[i], 1.0, it.value(), d[it.index()]);
+	}
+	SmartPtr<vector_type> spZero = d.clone_without_values();
+	spZero->set(0.0);
+	const number scale = std::max((number)1.0, BSRTestDistance(*spRef, *spZero));
+
+//	SpMV on the block storage, for both kinds of partitions
+	number errApply = 0;
+	number errApplySub = 0;
+	SmartPtr<vector_type> spR = d.clone_without_values();
+	std::vector<double> vX, vY;
+	CopyToScalarArray(vX, d);
+	for(int p = 0; p < 2; ++p)
+	{
+		std::vector<size_t> vBlockOffset;
+		if(p == 0) BlockSparseMatrix::detect_block_partition(vBlockOffset, A, 8);
+		else BlockSparseMatrix::uniform_block_partition(vBlockOffset, A.num_rows(), 1);
+
+		BlockSparseMatrix bsr;
+		bsr.init(A, vBlockOffset);
+		if(vX.empty()) continue;
+
+		vY.resize(vX.size());
+		bsr.apply(&vY[0], &vX[0]);
+		CopyFromScalarArray(*spR, vY);
+		errApply = std::max(errApply, BSRTestDistance(*spR, *spRef));
+
+		bsr.apply_sub(&vY[0], &vX[0]);
+		for(size_t i = 0; i < vY.size(); ++i)
+			errApplySub = std::max(errApplySub, (number)std::fabs(vY[i]));
+	}
+
+//	smoothers with one algebra index per block
+	number errGS, errBGS, errSGS, errILU;
+	{
+		BSRGaussSeidel<TAlgebra> B; B.set_block_size(1);
+		GaussSeidel<TAlgebra> Ref;
+		errGS = BSRTestCompare<TAlgebra>(B, Ref, spOp, d);
+	}
+	{
+		BSRGaussSeidel<TAlgebra> B; B.set_block_size(1); B.set_backward(true);
+		BackwardGaussSeidel<TAlgebra> Ref;
+		errBGS = BSRTestCompare<TAlgebra>(B, Ref, spOp, d);
+	}
+	{
+		BSRGaussSeidel<TAlgebra> B; B.set_block_size(1); B.set_symmetric(true);
+		SymmetricGaussSeidel<TAlgebra> Ref;
+		errSGS = BSRTestCompare<TAlgebra>(B, Ref, spOp, d);
+	}
+	{
+		BSRILU<TAlgebra> B; B.set_block_size(1);
+		ILU<TAlgebra> Ref;
+		errILU = BSRTestCompare<TAlgebra>(B, Ref, spOp, d);
+	}
+
+//	defect update
+	number errDefect;
+	{
+		BSRGaussSeidel<TAlgebra> B; B.set_block_size(1);
+		GaussSeidel<TAlgebra> Ref;
+		SmartPtr<vector_type> spC = d.clone_without_values();
+		SmartPtr<vector_type> spD = d.clone();
+		SmartPtr<vector_type> spDRef = d.clone();
+		if(!B.init(spOp) || !Ref.init(spOp)
+			|| !B.apply_update_defect(*spC, *spD) || !Ref.apply_update_defect(*spC, *spDRef))
+			UG_THROW("TestBSRSmoothers: cannot update the defect.");
+		errDefect = BSRTestDistance(*spD, *spDRef);
+	}
+
+	UG_LOG("TestBSRSmoothers: max. deviation apply: " << errApply
+	       << ", apply_sub: " << errApplySub << ", GS: " << errGS
+	       << ", backward GS: " << errBGS << ", symmetric GS: " << errSGS
+	       << ", ILU: " << errILU << ", defect update: " << errDefect << "\n");
+
+	const number errProduct = std::max(errApply, errApplySub);
+	const number errSmoother = std::max(std::max(errGS, errBGS), std::max(errSGS, errILU));
+	if(errProduct > tol * scale || errSmoother > tol * scale || errDefect > tol * scale)
+		UG_THROW("TestBSRSmoothers: block sparse row results differ by "
+		         << std::max(errProduct, std::max(errSmoother, errDefect))
+		         << " (tolerance " << tol << ").");
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__BSR_SMOOTHERS_TEST__ */
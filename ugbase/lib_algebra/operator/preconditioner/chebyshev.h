@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__
+
+#include "lib_algebra/operator/interface/preconditioner.h"
+#include "lib_algebra/operator/preconditioner/jacobi.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+///		Chebyshev-accelerated Jacobi iteration
+/**
+ * This preconditioner applies a Chebyshev polynomial of fixed degree in the
+ * Jacobi preconditioned operator \f$ D^{-1} A \f$ to the defect, i.e.
+ *
+ * 		\f$ c = p_k(D^{-1} A) D^{-1} d \f$,
+ *
+ * where the polynomial damps all eigenmodes with eigenvalues in the interval
+ * \f$ [\lambda_{max}/r, \lambda_{max}] \f$. The upper bound is estimated in the
+ * init phase by a few power iteration steps on \f$ D^{-1} A \f$ and enlarged
+ * by a safety factor, the smoothing range r is a parameter (default 30).
+ *
+ * Each degree needs one application of the operator and some vector updates
+ * only. Thus, the preconditioner has no sequential dependency and
+ * communicates only in the Jacobi step (as the damped Jacobi iteration). The
+ * operator is only applied via ILinearOperator::apply and the matrix is only
+ * used for its diagonal, so the preconditioner can be used for matrix-free
+ * operators as well.
+ *
+ *	References:
+ * <ul>
+ * <li> Y. Saad. Iterative Methods for Sparse Linear Systems, 2nd ed., Alg. 12.1
+ * <li> M. Adams, M. Brezina, J. Hu, R. Tuminaro. Parallel multigrid smoothing:
+ *      polynomial versus Gauss-Seidel. J. Comput. Phys. 188 (2003)
+ * </ul>
+ */
+template <typename TAlgebra>
+class Chebyshev : public IPreconditioner<TAlgebra>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Matrix Operator type
+		typedef typename IPreconditioner<TAlgebra>::matrix_operator_type matrix_operator_type;
+
+	///	Base type
+		typedef IPreconditioner<TAlgebra> base_type;
+
+	protected:
+		using base_type::set_debug;
+		using base_type::debug_writer;
+		using base_type::write_debug;
+		using base_type::approx_operator;
+
+	public:
+	///	default constructor
+		Chebyshev()
+			: m_degree(3), m_smoothingRange(30.0), m_eigSafety(1.1),
+			  m_numPowerIter(10), m_maxEig(0.0),
+			  m_spJacobi(new Jacobi<TAlgebra>())
+		{};
+
+	///	constructor setting the degree of the polynomial
+		Chebyshev(int degree)
+			: m_degree(degree), m_smoothingRange(30.0), m_eigSafety(1.1),
+			  m_numPowerIter(10), m_maxEig(0.0),
+			  m_spJacobi(new Jacobi<TAlgebra>())
+		{};
+
+	/// clone constructor
+		Chebyshev( const Chebyshev<TAlgebra> &parent )
+			: base_type(parent),
+			  m_degree(parent.m_degree), m_smoothingRange(parent.m_smoothingRange),
+			  m_eigSafety(parent.m_eigSafety), m_numPowerIter(parent.m_numPowerIter),
+			  m_maxEig(0.0), m_spJacobi(new Jacobi<TAlgebra>())
+		{}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new Chebyshev<algebra_type>(*this));
+		}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	Destructor
+		virtual ~Chebyshev()
+		{};
+
+	///	sets the degree of the polynomial (number of operator applications per step)
+		void set_degree(int degree)
+		{
+			UG_COND_THROW(degree < 1, "Chebyshev: degree must be at least 1.");
+			m_degree = degree;
+		}
+
+	///	sets the ratio of the largest to the smallest damped eigenvalue
+		void set_smoothing_range(number range)
+		{
+			UG_COND_THROW(range <= 1.0, "Chebyshev: smoothing range must be greater than 1.");
+			m_smoothingRange = range;
+		}
+
+	///	sets the factor the estimated largest eigenvalue is enlarged by
+		void set_eigenvalue_safety(number safety) {m_eigSafety = safety;}
+
+	///	sets the number of power iteration steps for the eigenvalue estimate
+		void set_num_power_iterations(int numIter) {m_numPowerIter = numIter;}
+
+	///	returns the (enlarged) estimate of the largest eigenvalue of D^{-1}A
+		number max_eigenvalue() const {return m_maxEig;}
+
+	protected:
+	///	Name of preconditioner
+		virtual const char* name() const {return "Chebyshev";}
+
+	///	Preprocess routine
+		virtual bool preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_preprocess, "algebra Chebyshev");
+
+		//	inverse diagonal
+			if(!m_spJacobi->init(pOp))
+			{
+				UG_LOG("ERROR in 'Chebyshev::preprocess': Cannot init Jacobi.\n");
+				return false;
+			}
+
+		//	temporaries are recreated in the first step
+			m_spR = SPNULL; m_spZ = SPNULL; m_spP = SPNULL;
+
+		//	estimate largest eigenvalue of D^{-1}A
+			m_maxEig = m_eigSafety * estimate_max_eigenvalue(pOp);
+			if(!(m_maxEig > 0.0))
+			{
+				UG_LOG("ERROR in 'Chebyshev::preprocess': Estimated largest "
+						"eigenvalue "<<m_maxEig<<" is not positive.\n");
+				return false;
+			}
+
+		//	done
+			return true;
+		}
+
+		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_step, "algebra Chebyshev");
+
+			if(m_spR.invalid()){
+				m_spR = d.clone_without_values();
+				m_spZ = d.clone_without_values();
+				m_spP = d.clone_without_values();
+			}
+			vector_type& r = *m_spR;
+			vector_type& z = *m_spZ;
+			vector_type& p = *m_spP;
+
+		//	interval [a, b] of damped eigenvalues
+			const number b = m_maxEig;
+			const number a = m_maxEig / m_smoothingRange;
+			const number theta = 0.5 * (b + a);
+			const number delta = 0.5 * (b - a);
+			const number sigma = theta / delta;
+			number rho = 1.0 / sigma;
+
+		//	first step: c = p = 1/theta * D^{-1} d
+			r = d;
+			if(!m_spJacobi->apply(z, r)) return false;
+			VecScaleAssign(p, 1.0 / theta, z);
+			VecScaleAssign(c, 1.0, p);
+
+			for(int k = 1; k < m_degree; ++k)
+			{
+			//	update residual r = r - A*p (r is additive, p consistent)
+				pOp->apply_sub(r, p);
+
+			//	z = D^{-1} r
+				if(!m_spJacobi->apply(z, r)) return false;
+
+			//	p = rho_new*rho * p + 2*rho_new/delta * z
+				const number rhoNew = 1.0 / (2.0 * sigma - rho);
+				VecScaleAdd(p, rhoNew * rho, p, 2.0 * rhoNew / delta, z);
+				rho = rhoNew;
+
+			//	c = c + p
+				VecScaleAdd(c, 1.0, c, 1.0, p);
+			}
+
+		//	done
+			return true;
+		}
+
+	///	Postprocess routine
+		virtual bool postprocess() {return true;}
+
+	protected:
+	///	a few power iteration steps on D^{-1}A
+		number estimate_max_eigenvalue(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+		{
+			PROFILE_BEGIN_GROUP(Chebyshev_estimate, "algebra Chebyshev");
+
+			matrix_type& mat = pOp->get_matrix();
+			const size_t size = mat.num_rows();
+
+			vector_type v, w, z;
+			v.resize(size); w.resize(size); z.resize(size);
+#ifdef UG_PARALLEL
+			v.set_layouts(mat.layouts());
+			w.set_layouts(mat.layouts());
+			z.set_layouts(mat.layouts());
+#endif
+
+		//	random start vector (consistent), to contain all eigenmodes
+			v.set_random(-1.0, 1.0);
+			number vNorm = v.norm();
+			if(vNorm == 0.0) return 0.0;
+			VecScaleAssign(v, 1.0 / vNorm, v);
+#ifdef UG_PARALLEL
+			v.change_storage_type(PST_CONSISTENT);
+#endif
+
+			number lambda = 0.0;
+			for(int k = 0; k < m_numPowerIter; ++k)
+			{
+			//	z = D^{-1} A v
+				pOp->apply(w, v);
+				if(!m_spJacobi->apply(z, w)) return 0.0;
+
+			//	|| D^{-1} A v || with ||v|| = 1
+				lambda = z.norm();
+				if(lambda == 0.0) return 0.0;
+
+			//	v = z / ||z||
+				VecScaleAssign(v, 1.0 / lambda, z);
+#ifdef UG_PARALLEL
+				v.change_storage_type(PST_CONSISTENT);
+#endif
+			}
+
+			return lambda;
+		}
+
+	protected:
+	///	degree of the polynomial
+		int m_degree;
+
+	///	ratio of largest to smallest damped eigenvalue
+		number m_smoothingRange;
+
+	///	safety factor for estimated largest eigenvalue
+		number m_eigSafety;
+
+	///	number of power iteration steps
+		int m_numPowerIter;
+
+	///	(enlarged) estimate of largest eigenvalue of D^{-1}A
+		number m_maxEig;
+
+	///	Jacobi iteration (undamped) providing D^{-1}
+		SmartPtr<IPreconditioner<TAlgebra> > m_spJacobi;
+
+	///	temporary vectors (residual, preconditioned residual, update)
+		SmartPtr<vector_type> m_spR, m_spZ, m_spP;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__CHEBYSHEV__ */
@@ -145,6 +145,15 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax) = 0;
 
+	public:
+	///	computes the correction and updates the defect, \sa IPreconditioner::apply_update_defect_overlapped
+		virtual bool apply_update_defect(vector_type& c, vector_type& d)
+		{
+			return this->apply_update_defect_overlapped(c, d);
+		}
+
+	protected:
+
 	//	Stepping routine
 		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
 		{
@@ -197,9 +206,7 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 					c.set_storage_type(PST_UNIQUE);
 				}
 
-				// make correction consistent
-				c.change_storage_type(PST_CONSISTENT);
-
+				// the correction is made consistent by the caller (\sa apply_update_defect)
 				return true;
 			}
 			else
@@ -356,6 +363,122 @@ public:
 		}
 };
 
+/// Multicolor Gauss-Seidel preconditioner
+/**
+ * This class implements a Gauss-Seidel preconditioner (and smoother) for a
+ * multicolor ordering of the dofs. In preprocess, the rows are colored such
+ * that no two rows of one color are coupled. A step then processes the colors
+ * one after another and all rows of one color concurrently, i.e. with OpenMP
+ * threads if ug is compiled with UG_OPENMP. This is the Gauss-Seidel method
+ * for the matrix permuted by colors, so the smoothing properties differ from
+ * the lexicographic GaussSeidel. Forward, backward and symmetric steps are
+ * available; a relaxation parameter gives the multicolor SOR-method.
+ *
+ * Between processes, the same coupling as for GaussSeidel is used (\sa
+ * GaussSeidelBase).
+ *
+ * \tparam	TAlgebra	Algebra type
+ */
+template <typename TAlgebra>
+class MulticolorGaussSeidel : public GaussSeidelBase<TAlgebra>
+{
+	typedef TAlgebra algebra_type;
+	typedef typename TAlgebra::vector_type vector_type;
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef GaussSeidelBase<TAlgebra> base_type;
+
+#ifdef UG_PARALLEL
+	using base_type::m_A;
+#endif
+
+public:
+	//	Name of preconditioner
+		virtual const char* name() const {return "Multicolor Gauss-Seidel";}
+
+	/// constructor
+		MulticolorGaussSeidel() : base_type(), m_bOwnA(false), m_patternRevision(0), m_bBackward(false), m_bSymmetric(false) {}
+
+	/// clone constructor
+		MulticolorGaussSeidel( const MulticolorGaussSeidel<TAlgebra> &parent )
+			: base_type(parent),
+			  m_bOwnA(false),
+			  m_patternRevision(0),
+			  m_bBackward(parent.m_bBackward),
+			  m_bSymmetric(parent.m_bSymmetric)
+		{	}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new MulticolorGaussSeidel<algebra_type>(*this));
+		}
+
+	///	if true, the colors are processed in reverse order (default false)
+		void set_backward(bool bBackward) {m_bBackward = bBackward;}
+
+	///	if true, a forward and a backward step are performed (default false)
+		void set_symmetric(bool bSymmetric) {m_bSymmetric = bSymmetric;}
+
+	///	returns the number of colors of the last preprocess
+		size_t num_colors() const {return m_colors.num_levels();}
+
+	protected:
+	//	Preprocess routine
+		virtual bool preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+		{
+			if(!base_type::preprocess(pOp)) return false;
+
+			PROFILE_BEGIN_GROUP(MulticolorGaussSeidel_preprocess, "algebra gaussseidel");
+			matrix_type *pA = &(*pOp);
+			m_bOwnA = false;
+#ifdef UG_PARALLEL
+		//	the overlap matrix is a private copy and can be finalized
+			if(pcl::NumProcs() > 1) {pA = &m_A; pA->finalize();}
+#endif
+		//	the threaded sweeps work on the CRS arrays. The matrix of the
+		//	operator is not finalized here, since this would change its
+		//	pattern revision; a finalized copy is used instead
+			if(pA == &(*pOp) && !pA->is_finalized())
+			{
+				m_ownA = *pA;
+				m_ownA.finalize();
+				pA = &m_ownA;
+				m_bOwnA = true;
+			}
+			else m_ownA.resize_and_clear(0, 0);
+
+		//	the coloring only depends on the sparsity pattern, it is reused if
+		//	the pattern revision of the operator matrix is unchanged
+			if(!base_type::same_pattern(*pOp, m_patternRevision)
+				|| m_colors.num_rows() != pA->num_rows())
+				m_colors.init_multicolor(*pA);
+			m_patternRevision = base_type::pattern_revision_of(*pOp);
+			return true;
+		}
+
+	//	Stepping routine
+		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			const matrix_type& S = m_bOwnA ? m_ownA : A;
+			if(m_bSymmetric) sgs_step_multicolor(S, m_colors, c, d, relax);
+			else gs_step_multicolor(S, m_colors, c, d, relax, m_bBackward);
+		}
+
+	protected:
+	///	coloring of the matrix
+		LevelSchedule m_colors;
+
+	///	finalized copy of a not finalized operator matrix
+		matrix_type m_ownA;
+		bool m_bOwnA;
+
+	///	pattern revision of the operator matrix the coloring was computed for
+		size_t m_patternRevision;
+
+		bool m_bBackward;
+		bool m_bSymmetric;
+};
+
 } // end namespace ug
 
 #endif // __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__GAUSS_SEIDEL__
@@ -46,9 +46,27 @@
 	#include "lib_algebra/parallelization/overlap_writer.h"
 #endif
 #include "lib_algebra/algebra_common/permutation_util.h"
+#include "lib_algebra/algebra_common/level_schedule.h"
 
 namespace ug{
 
+//	fallbacks for matrix types without a fast path for finalized matrices.
+//	For SparseMatrix, see cpu_algebra/sparsematrix_crs_kernels.h.
+inline bool FactorizeILUSorted_finalized(void *, const number) {return false;}
+template<typename Vector_type>
+inline bool invert_L_finalized(const void *, Vector_type &, const Vector_type &) {return false;}
+template<typename Vector_type>
+inline bool invert_U_finalized(const void *, Vector_type &, const Vector_type &, const number, bool &) {return false;}
+inline bool FactorizeILUSorted_levels(void *, const LevelSchedule &, const number) {return false;}
+template<typename Vector_type>
+inline bool invert_L_levels(const void *, const LevelSchedule &, Vector_type &, const Vector_type &) {return false;}
+template<typename Vector_type>
+inline bool invert_U_levels(const void *, const LevelSchedule &, Vector_type &, const Vector_type &, const number, bool &) {return false;}
+template<typename Vector_type>
+inline bool invert_L_jacobi(const void *, Vector_type &, const Vector_type &, size_t, Vector_type &) {return false;}
+template<typename Vector_type>
+inline bool invert_U_jacobi(const void *, Vector_type &, const Vector_type &, size_t, Vector_type &) {return false;}
+
 
 // ILU(0) solver, i.e. static pattern ILU w/ P=P(A)
 // (cf. Y Saad, Iterative methods for Sparse Linear Systems, p. 270)
@@ -172,6 +190,9 @@ bool FactorizeILUSorted(Matrix_type &A, const number eps = 1e-50)
 	typedef typename Matrix_type::row_iterator row_iterator;
 	typedef typename Matrix_type::value_type block_type;
 
+	// finalizes A if supported and factorizes on the CRS arrays
+	if(FactorizeILUSorted_finalized(&A, eps)) return true;
+
 	// for all rows
 	for(size_t i=1; i < A.num_rows(); i++)
 	{
@@ -231,6 +252,8 @@ bool invert_L(const Matrix_type &A, Vector_type &x, const Vector_type &b)
 	PROFILE_FUNC_GROUP("algebra ILU");
 	typedef typename Matrix_type::const_row_iterator const_row_iterator;
 
+	if(invert_L_finalized(&A, x, b)) return true;
+
 	typename Vector_type::value_type s;
 	for(size_t i=0; i < x.size(); i++)
 	{
@@ -256,9 +279,10 @@ bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
 	PROFILE_FUNC_GROUP("algebra ILU");
 	typedef typename Matrix_type::const_row_iterator const_row_iterator;
 
-	typename Vector_type::value_type s;
-	
 	bool result = true;
+	if(invert_U_finalized(&A, x, b, eps, result)) return result;
+
+	typename Vector_type::value_type s;
 	
 	// last row diagonal U entry might be close to zero with corresponding close to zero rhs
 	// when solving Navier Stokes system, therefore handle separately
@@ -385,7 +409,10 @@ class ILU : public IPreconditioner<TAlgebra>
 			m_bSort(false),
 			m_bDisablePreprocessing(false),
 			m_useConsistentInterfaces(false),
-			m_useOverlap(false) {};
+			m_useOverlap(false),
+			m_bLevelScheduling(false),
+			m_numJacobiSweeps(0),
+			m_patternRevision(0) {};
 
 	/// clone constructor
 		ILU( const ILU<TAlgebra> &parent )
@@ -396,7 +423,10 @@ class ILU : public IPreconditioner<TAlgebra>
 			  m_bSort(parent.m_bSort),
 			  m_bDisablePreprocessing(parent.m_bDisablePreprocessing),
 			  m_useConsistentInterfaces(parent.m_useConsistentInterfaces),
-			  m_useOverlap(parent.m_useOverlap)
+			  m_useOverlap(parent.m_useOverlap),
+			  m_bLevelScheduling(parent.m_bLevelScheduling),
+			  m_numJacobiSweeps(parent.m_numJacobiSweeps),
+			  m_patternRevision(0)
 		{	}
 
 	///	Clone
@@ -436,6 +466,18 @@ class ILU : public IPreconditioner<TAlgebra>
 
 		void enable_overlap (bool enable)				{m_useOverlap = enable;}
 
+	///	enables the level scheduled (multithreaded) factorization and triangular solves
+	/**	The rows are grouped into levels of the dependency graph of the
+	 * sparsity pattern once per preprocess. All rows of one level are then
+	 * processed concurrently. Only used for ILU(0) of matrices with sorted rows.*/
+		void set_level_scheduling(bool enable)			{m_bLevelScheduling = enable;}
+
+	///	approximates the triangular solves by a number of Jacobi sweeps (0: exact solves)
+	/**	Each sweep is fully parallel, but the result is only exact if the
+	 * number of sweeps is at least the depth of the level graph. Useful if
+	 * the level graph is too deep for level scheduling.*/
+		void set_triangular_jacobi_sweeps(size_t numSweeps)	{m_numJacobiSweeps = numSweeps;}
+
 	protected:
 	//	Name of preconditioner
 		virtual const char* name() const {return "ILU";}
@@ -447,7 +489,12 @@ class ILU : public IPreconditioner<TAlgebra>
 			PROFILE_BEGIN_GROUP(ILU_ReorderCuthillMcKey, "ilu algebra");
 			GetCuthillMcKeeOrder(m_ILU, m_newIndex);
 			m_bSortIsIdentity = GetInversePermutation(m_newIndex, m_oldIndex);
+			apply_ordering();
+		}
 
+		// reorders the matrix by the current ordering
+		void apply_ordering()
+		{
 			if(!m_bSortIsIdentity)
 			{
 				matrix_type mat;
@@ -466,6 +513,11 @@ class ILU : public IPreconditioner<TAlgebra>
 
 			matrix_type &mat = *pOp;
 			PROFILE_BEGIN_GROUP(ILU_preprocess, "algebra ILU");
+
+		//	the ordering and the schedules are only reused, if the pattern
+		//	revision of the operator matrix is unchanged
+			const bool bSamePattern = base_type::same_pattern(mat, m_patternRevision);
+			m_patternRevision = 0;
 		//	Debug output of matrices
 			#ifdef UG_PARALLEL
 			write_overlap_debug(mat, "ILU_prep_01_A_BeforeMakeUnique");
@@ -529,7 +581,13 @@ class ILU : public IPreconditioner<TAlgebra>
 
 		//	if using overlap we already sort in a different way
 			if(m_bSort && !(m_useOverlap && sortSlaveToEnd))
-				calc_cuthill_mckee();
+			{
+			//	the ordering only depends on the sparsity pattern
+				if(bSamePattern && m_newIndex.size() == m_ILU.num_rows())
+					apply_ordering();
+				else
+					calc_cuthill_mckee();
+			}
 
 		//	Debug output of matrices
 			#ifdef UG_PARALLEL
@@ -539,9 +597,28 @@ class ILU : public IPreconditioner<TAlgebra>
 			#endif
 
 
+		//	dependency levels of the triangular sweeps (pattern is not changed by ILU(0))
+			if(!m_bLevelScheduling)
+			{
+				m_lowerSchedule.clear();
+				m_upperSchedule.clear();
+			}
+			else if(!bSamePattern
+					|| m_lowerSchedule.num_rows() != m_ILU.num_rows())
+			{
+				m_lowerSchedule.init_lower(m_ILU);
+				m_upperSchedule.init_upper(m_ILU);
+			}
+			m_patternRevision = base_type::pattern_revision_of(mat);
+
 		// 	Compute ILU Factorization
 			if (m_beta!=0.0) FactorizeILUBeta(m_ILU, m_beta);
-			else if(matrix_type::rows_sorted) FactorizeILUSorted(m_ILU, m_sortEps);
+			else if(matrix_type::rows_sorted)
+			{
+				if(!m_bLevelScheduling
+					|| !FactorizeILUSorted_levels(&m_ILU, m_lowerSchedule, m_sortEps))
+					FactorizeILUSorted(m_ILU, m_sortEps);
+			}
 			else FactorizeILU(m_ILU);
 			m_ILU.defragment();
 
@@ -557,23 +634,53 @@ class ILU : public IPreconditioner<TAlgebra>
 		}
 
 
+	//	solves x = L^-1 b using the configured triangular solve
+		bool solve_L(vector_type &x, const vector_type &b)
+		{
+			if(m_numJacobiSweeps > 0)
+			{
+				if(m_hJacobi.size() != x.size()) m_hJacobi.resize(x.size());
+				if(invert_L_jacobi(&m_ILU, x, b, m_numJacobiSweeps, m_hJacobi))
+					return true;
+			}
+			if(m_bLevelScheduling && invert_L_levels(&m_ILU, m_lowerSchedule, x, b))
+				return true;
+			return invert_L(m_ILU, x, b);
+		}
+
+	//	solves x = U^-1 b using the configured triangular solve
+		bool solve_U(vector_type &x, const vector_type &b)
+		{
+			if(m_numJacobiSweeps > 0)
+			{
+				if(m_hJacobi.size() != x.size()) m_hJacobi.resize(x.size());
+				if(invert_U_jacobi(&m_ILU, x, b, m_numJacobiSweeps, m_hJacobi))
+					return true;
+			}
+			bool result = true;
+			if(m_bLevelScheduling
+				&& invert_U_levels(&m_ILU, m_upperSchedule, x, b, m_invEps, result))
+				return result;
+			return invert_U(m_ILU, x, b, m_invEps);
+		}
+
 		void applyLU(vector_type &c, const vector_type &d, vector_type &tmp)
 		{	
 			if(!m_bSort || m_bSortIsIdentity)
 			{
 				// 	apply iterator: c = LU^{-1}*d
-				if(! invert_L(m_ILU, tmp, d)) // h := L^-1 d
+				if(! solve_L(tmp, d)) // h := L^-1 d
 					print_debugger_message("ILU: There were issues at inverting L\n");
-				if(! invert_U(m_ILU, c, tmp, m_invEps)) // c := U^-1 h = (LU)^-1 d
+				if(! solve_U(c, tmp)) // c := U^-1 h = (LU)^-1 d
 					print_debugger_message("ILU: There were issues at inverting U\n");
 			}
 			else
 			{
 				// we save one vector here by renaming
 				SetVectorAsPermutation(tmp, d, m_newIndex);
-				if(! invert_L(m_ILU, c, tmp)) // c = L^{-1} d
+				if(! solve_L(c, tmp)) // c = L^{-1} d
 					print_debugger_message("ILU: There were issues at inverting L (after permutation)\n");
-				if(! invert_U(m_ILU, tmp, c, m_invEps)) // tmp = (LU)^{-1} d
+				if(! solve_U(tmp, c)) // tmp = (LU)^{-1} d
 					print_debugger_message("ILU: There were issues at inverting U (after permutation)\n");
 				SetVectorAsPermutation(c, tmp, m_oldIndex);
 			}
@@ -630,12 +737,9 @@ class ILU : public IPreconditioner<TAlgebra>
 				}
 
 			//	write debug
-				if(first) write_overlap_debug(c, "ILU_step_3_c");
+				if(first) {write_overlap_debug(c, "ILU_step_3_c"); first = false;}
 
-				c.change_storage_type(PST_CONSISTENT);
-
-			//	write debug
-				if(first) {write_overlap_debug(c, "ILU_step_4_c_consistent"); first = false;}
+			//	the correction is made consistent by the caller (\sa apply_update_defect)
 
 			#else
 				write_debug(d, "ILU_step_d");
@@ -650,6 +754,13 @@ class ILU : public IPreconditioner<TAlgebra>
 	///	Postprocess routine
 		virtual bool postprocess() {return true;}
 
+	public:
+	///	computes the correction and updates the defect, \sa IPreconditioner::apply_update_defect_overlapped
+		virtual bool apply_update_defect(vector_type& c, vector_type& d)
+		{
+			return this->apply_update_defect_overlapped(c, d);
+		}
+
 	private:
 	#ifdef UG_PARALLEL
 		template <class T> void write_overlap_debug(const T& t, std::string name)
@@ -670,6 +781,9 @@ class ILU : public IPreconditioner<TAlgebra>
 	///	help vector
 		vector_type m_h;
 
+	///	help vector for Jacobi sweeps
+		vector_type m_hJacobi;
+
 	///	for overlaps only
 		vector_type m_oD;
 		vector_type m_oC;
@@ -696,6 +810,16 @@ class ILU : public IPreconditioner<TAlgebra>
 
 		bool m_useConsistentInterfaces;
 		bool m_useOverlap;
+
+	///	dependency levels for the forward (L) and backward (U) sweeps
+		LevelSchedule m_lowerSchedule, m_upperSchedule;
+		bool m_bLevelScheduling;
+
+	///	number of Jacobi sweeps approximating the triangular solves (0: exact)
+		size_t m_numJacobiSweeps;
+
+	///	pattern revision of the operator matrix the ordering and schedules were computed for
+		size_t m_patternRevision;
 };
 
 } // end namespace ug
@@ -42,6 +42,12 @@
 namespace ug
 {
 
+void HorizontalAlgebraLayouts::layouts_changed()
+{
+	static size_t nextRevision = 0;
+	m_commPlans.clear();
+	m_revision = ++nextRevision;
+}
 
 std::ostream &operator << (std::ostream &out, const HorizontalAlgebraLayouts &layouts)
 {
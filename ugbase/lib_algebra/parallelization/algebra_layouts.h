@@ -36,6 +36,7 @@
 #ifdef UG_PARALLEL
 #include "pcl/pcl_base.h"
 #include "lib_algebra/parallelization/parallel_index_layout.h"
+#include "lib_algebra/parallelization/layout_comm_plan.h"
 #endif
 
 namespace ug{
@@ -47,12 +48,16 @@ namespace ug{
 class HorizontalAlgebraLayouts
 {
 	public:
-		HorizontalAlgebraLayouts() : m_overlapEnabled(false) 	{}
+		HorizontalAlgebraLayouts() : m_revision(0), m_overlapEnabled(false)
+		{
+			layouts_changed();
+		}
 
 	///	clears the struct
 		void clear()
 		{
 			masterLayout.clear();			slaveLayout.clear();
+			layouts_changed();
 		}
 
 	public:
@@ -77,6 +82,29 @@ class HorizontalAlgebraLayouts
 	 */
 		pcl::InterfaceCommunicator<IndexLayout>& comm() const  	{return const_cast<HorizontalAlgebraLayouts*>(this)->communicator;}
 
+	///	returns a persistent plan for sending values from source to target
+	/**
+	 * source and target must be layouts of this object. The plan is created
+	 * on first use and reused until layouts_changed is called. Since plans
+	 * are created on first use, the first use must be collective (see
+	 * LayoutCommPlanCache). Only one exchange per plan may be in progress
+	 * at a time.
+	 */
+		LayoutCommPlan& comm_plan(const IndexLayout& source, const IndexLayout& target,
+		                          size_t valueBytes) const
+		{
+			return m_commPlans.get(source, target, valueBytes);
+		}
+
+	///	returns a number identifying the current state of the layouts
+	/**
+	 * The number is unique among all HorizontalAlgebraLayouts and changes
+	 * whenever layouts_changed is called. Copies share the number of their
+	 * original, since they have the same layouts. Data computed from the
+	 * layouts can be cached together with this number.
+	 */
+		size_t revision() const	{return m_revision;}
+
 	/**	It is important to enable or disable overlap on all involved processes
 	 * at the same time. Otherwise communication issues may arise.*/
 		void enable_overlap(bool enable)	{m_overlapEnabled = enable;}
@@ -98,6 +126,12 @@ class HorizontalAlgebraLayouts
 		pcl::ProcessCommunicator& proc_comm()				{return processCommunicator;}
 	/// \}
 
+	///	removes the communication plans and assigns a new revision
+	/**	Must be called whenever the layouts have been modified through the
+	 * non-const accessors after communication plans or revision() have
+	 * been used.*/
+		void layouts_changed();
+
 	protected:
 		///	(horizontal) master index layout
 		IndexLayout masterLayout;
@@ -113,6 +147,12 @@ class HorizontalAlgebraLayouts
 		///	communicator
 		pcl::InterfaceCommunicator<IndexLayout> communicator;
 
+		///	persistent communication plans (created on demand)
+		mutable LayoutCommPlanCache m_commPlans;
+
+		///	see revision()
+		size_t m_revision;
+
 		bool m_overlapEnabled;
 };
 
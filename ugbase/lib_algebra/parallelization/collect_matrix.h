@@ -36,6 +36,7 @@
 #include "parallel_nodes.h"
 #include "serialize_interfaces.h"
 #include "common/debug_print.h"
+#include "lib_algebra/common/stl_debug.h"
 
 namespace ug{
 
@@ -227,23 +228,18 @@ void ReceiveMatrix(const matrix_type &A, matrix_type &M, IndexLayout &verticalMa
 }
 
 /**
- * 1. constructs global indices
- * 2. for pid != proc_id(0) :
- * 		a) send the whole matrix with global ids to proc_id(0)
- * 		b) create slaveLayout to proc_id(0)
- *
- * 3. for pid = proc_id(0) :
- * 		a) receives the matrices
- * 		b) builds up collectedA
- * 		c) creates masterLayout to all other pids.
+ * collects the matrix on pid = pc.get_proc_id(0) of the
+ * given process communicator, which may contain a subset of the processes
+ * of A (e.g. a group created by pcl::ProcessCommunicator::split).
+ * See CollectMatrixOnOneProc below for the steps.
  *
- * @param A				(input) the distributed parallel matrix A
- * @param collectedA	(output) the collected matrix A on pid = proc_id(0)
- * @param masterLayout	the agglomeration master layout (only defined on pid = proc_id(0))
- * @param slaveLayout	the agglomeration slave layout (only defined on pid != proc_id(0))
+ * @param pc			processes whose matrices are collected
+ * @param PN			(in/out) parallel nodes of A. On pid = pc.get_proc_id(0) it
+ * 						contains the global ids of all indices of collectedA afterwards
  */
 template<typename matrix_type>
-void CollectMatrixOnOneProc(const matrix_type &A, matrix_type &collectedA, IndexLayout &masterLayout, IndexLayout &slaveLayout)
+void CollectMatrixOnOneProc(const matrix_type &A, matrix_type &collectedA, IndexLayout &masterLayout, IndexLayout &slaveLayout,
+                            const pcl::ProcessCommunicator &pc, ParallelNodes &PN)
 {
 	try{
 	PROFILE_FUNC_GROUP("algebra parallelization");
@@ -252,9 +248,6 @@ void CollectMatrixOnOneProc(const matrix_type &A, matrix_type &collectedA, Index
 	masterLayout.clear();
 	slaveLayout.clear();
 
-	const pcl::ProcessCommunicator &pc = A.layouts()->proc_comm();
-	ParallelNodes PN(A.layouts(), A.num_rows());
-
 	if(pcl::ProcRank() == pc.get_proc_id(0))
 	{
 		srcprocs.resize(pc.size()-1);
@@ -267,6 +260,30 @@ void CollectMatrixOnOneProc(const matrix_type &A, matrix_type &collectedA, Index
 	}UG_CATCH_THROW(__FUNCTION__ << " failed");
 }
 
+/**
+ * 1. constructs global indices
+ * 2. for pid != proc_id(0) :
+ * 		a) send the whole matrix with global ids to proc_id(0)
+ * 		b) create slaveLayout to proc_id(0)
+ *
+ * 3. for pid = proc_id(0) :
+ * 		a) receives the matrices
+ * 		b) builds up collectedA
+ * 		c) creates masterLayout to all other pids.
+ *
+ * @param A				(input) the distributed parallel matrix A
+ * @param collectedA	(output) the collected matrix A on pid = proc_id(0)
+ * @param masterLayout	the agglomeration master layout (only defined on pid = proc_id(0))
+ * @param slaveLayout	the agglomeration slave layout (only defined on pid != proc_id(0))
+ */
+template<typename matrix_type>
+void CollectMatrixOnOneProc(const matrix_type &A, matrix_type &collectedA, IndexLayout &masterLayout, IndexLayout &slaveLayout)
+{
+	ParallelNodes PN(A.layouts(), A.num_rows());
+	CollectMatrixOnOneProc(A, collectedA, masterLayout, slaveLayout,
+	                       A.layouts()->proc_comm(), PN);
+}
+
 /**
  * gathers the vector vec to collectedVec on one processor
  * @param agglomeratedMaster	master agglomeration layout. only nonempty if Root=true
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "layout_comm_plan.h"
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+LayoutCommPlan::
+LayoutCommPlan(const IndexLayout& source, const IndexLayout& target,
+               size_t valueBytes, int tag)
+	: m_valueBytes(valueBytes)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+
+//	sends: one message per interface of the source layout
+	for(IndexLayout::const_iterator iter = source.begin(); iter != source.end(); ++iter)
+	{
+		const IndexLayout::Interface& interface = source.interface(iter);
+		for(IndexLayout::Interface::const_iterator iiter = interface.begin();
+				iiter != interface.end(); ++iiter)
+			m_vSendIndex.push_back(interface.get_element(iiter));
+		m_com.add_send(source.proc_id(iter), interface.size() * m_valueBytes);
+	}
+
+//	receives: one message per interface of the target layout
+	for(IndexLayout::const_iterator iter = target.begin(); iter != target.end(); ++iter)
+	{
+		const IndexLayout::Interface& interface = target.interface(iter);
+		for(IndexLayout::Interface::const_iterator iiter = interface.begin();
+				iiter != interface.end(); ++iiter)
+			m_vRecvIndex.push_back(interface.get_element(iiter));
+		m_com.add_receive(target.proc_id(iter), interface.size() * m_valueBytes);
+	}
+
+	m_com.setup(tag);
+}
+
+LayoutCommPlan& LayoutCommPlanCache::
+get(const IndexLayout& source, const IndexLayout& target, size_t valueBytes)
+{
+	const Key key(std::make_pair(&source, &target), valueBytes);
+	SmartPtr<LayoutCommPlan>& spPlan = m_mPlans[key];
+	if(spPlan.invalid())
+		spPlan = make_sp(new LayoutCommPlan(source, target, valueBytes,
+		                                     m_nextTag++));
+	return *spPlan;
+}
+
+} // end namespace ug
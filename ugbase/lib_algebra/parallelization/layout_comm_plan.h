@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_ALGEBRA__PARALLELIZATION__LAYOUT_COMM_PLAN__
+#define __H__LIB_ALGEBRA__PARALLELIZATION__LAYOUT_COMM_PLAN__
+
+#include <map>
+#include <vector>
+#include <cstring>
+#include "common/util/smart_pointer.h"
+#include "pcl/pcl_persistent_communicator.h"
+#include "parallel_index_layout.h"
+
+namespace ug{
+
+///\ingroup lib_algebra_parallelization
+
+///	Precomputed exchange of vector values from a source to a target layout.
+/**
+ * The plan collects the indices of all interfaces of both layouts once and
+ * sets up a pcl::PersistentCommunicator with buffers of fixed size. An
+ * exchange then packs the values of the source indices directly into the
+ * send buffer, starts the persistent requests, and copies or adds the
+ * received values to the target indices. No sizes are communicated and
+ * nothing is allocated per exchange.
+ *
+ * The values are copied bytewise, thus the plan can only be used for
+ * vectors with static block types (block_traits<value_type>::is_static)
+ * and valueBytes = sizeof(value_type).
+ *
+ * Usually, plans are not created directly but obtained from
+ * HorizontalAlgebraLayouts::comm_plan. Plans used at the same time must
+ * have different tags.
+ */
+class LayoutCommPlan
+{
+	public:
+	///	creates the plan sending values on source to values on target
+		LayoutCommPlan(const IndexLayout& source, const IndexLayout& target,
+		               size_t valueBytes, int tag = 749351);
+
+	///	size of one value in bytes
+		size_t value_bytes() const {return m_valueBytes;}
+
+	///	packs the values of the source indices and starts the exchange
+	/**	If bZeroSource is true, the source values are set to zero after
+	 * packing (e.g. for additive to unique).*/
+		template <typename TVector>
+		void start(TVector& vec, bool bZeroSource = false)
+		{
+			char* buf = m_com.num_sends() ? m_com.send_buffer(0) : NULL;
+			for(size_t k = 0; k < m_vSendIndex.size(); ++k, buf += m_valueBytes){
+				memcpy(buf, static_cast<const void*>(&vec[m_vSendIndex[k]]), m_valueBytes);
+				if(bZeroSource) vec[m_vSendIndex[k]] = 0.0;
+			}
+			m_com.start();
+		}
+
+	///	waits for the exchange and copies the received values to the target
+		template <typename TVector>
+		void finish_copy(TVector& vec)
+		{
+			m_com.wait();
+			const char* buf = m_com.num_receives() ? m_com.receive_buffer(0) : NULL;
+			for(size_t k = 0; k < m_vRecvIndex.size(); ++k, buf += m_valueBytes)
+				memcpy(static_cast<void*>(&vec[m_vRecvIndex[k]]), buf, m_valueBytes);
+		}
+
+	///	waits for the exchange and adds the received values to the target
+		template <typename TVector>
+		void finish_add(TVector& vec)
+		{
+			m_com.wait();
+			typename TVector::value_type val;
+			const char* buf = m_com.num_receives() ? m_com.receive_buffer(0) : NULL;
+			for(size_t k = 0; k < m_vRecvIndex.size(); ++k, buf += m_valueBytes){
+				memcpy(static_cast<void*>(&val), buf, m_valueBytes);
+				vec[m_vRecvIndex[k]] += val;
+			}
+		}
+
+	///	returns if an exchange is in progress
+		bool is_active() const {return m_com.is_active();}
+
+	protected:
+	///	source indices, ordered as the values in the send buffer
+		std::vector<size_t> m_vSendIndex;
+
+	///	target indices, ordered as the values in the receive buffer
+		std::vector<size_t> m_vRecvIndex;
+
+	///	size of one value
+		size_t m_valueBytes;
+
+	///	persistent requests and buffers
+		pcl::PersistentCommunicator m_com;
+};
+
+///	Cache of LayoutCommPlans, keyed by source and target layout and value size.
+/**
+ * Copies of the cache are empty, since the plans refer to the layouts of
+ * the object they have been created for.
+ *
+ * Each plan gets its own tag, counted from the base tag in the order of
+ * creation. Plans must therefore be created collectively, i.e. in the same
+ * order on all involved processes.
+ */
+class LayoutCommPlanCache
+{
+	public:
+		LayoutCommPlanCache() : m_nextTag(baseTag) {}
+		LayoutCommPlanCache(const LayoutCommPlanCache&) : m_nextTag(baseTag) {}
+		LayoutCommPlanCache& operator=(const LayoutCommPlanCache&)
+		{
+			clear(); return *this;
+		}
+
+	///	removes all plans
+		void clear() {m_mPlans.clear(); m_nextTag = baseTag;}
+
+	///	returns the plan for the given layouts (created if not present)
+		LayoutCommPlan& get(const IndexLayout& source, const IndexLayout& target,
+		                    size_t valueBytes);
+
+	protected:
+		typedef std::pair<std::pair<const IndexLayout*, const IndexLayout*>, size_t> Key;
+		std::map<Key, SmartPtr<LayoutCommPlan> > m_mPlans;
+
+	///	tag of the first plan
+		static const int baseTag = 749351;
+
+	///	tag of the next created plan
+		int m_nextTag;
+};
+
+} // end namespace ug
+
+#endif /* __H__LIB_ALGEBRA__PARALLELIZATION__LAYOUT_COMM_PLAN__ */
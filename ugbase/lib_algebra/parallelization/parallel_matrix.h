@@ -78,12 +78,14 @@ class ParallelMatrix : public TMatrix
 	public:
 	///	Default Constructor
 		ParallelMatrix()
-			: TMatrix(), m_type(PST_UNDEFINED), m_spAlgebraLayouts(new AlgebraLayouts)
+			: TMatrix(), m_type(PST_UNDEFINED), m_spAlgebraLayouts(new AlgebraLayouts),
+			  m_bRowSplitValid(false)
 		{}
 
 	///	Constructor setting the layouts
 		ParallelMatrix(SmartPtr<AlgebraLayouts> layouts)
-			: TMatrix(), m_type(PST_UNDEFINED), m_spAlgebraLayouts(layouts)
+			: TMatrix(), m_type(PST_UNDEFINED), m_spAlgebraLayouts(layouts),
+			  m_bRowSplitValid(false)
 		{}
 
 		/////////////////////////
@@ -125,6 +127,12 @@ class ParallelMatrix : public TMatrix
 		/////////////////////////
 
 	/// calculate res = A x
+	/**
+	 * If A is additive, x may also be additive or unique. x is then changed
+	 * to consistent storage. For finalized matrices, the rows not coupled to
+	 * the interfaces are computed while the interface values of x are
+	 * communicated.
+	 */
 		template<typename TPVector>
 		bool apply(TPVector &res, const TPVector &x) const;
 
@@ -133,18 +141,55 @@ class ParallelMatrix : public TMatrix
 		bool apply_transposed(TPVector &res, const TPVector &x) const;
 
 	/// calculate res -= A x
+	/**	As for apply, x may be additive or unique and is then changed to
+	 * consistent storage.*/
 		template<typename TPVector>
 		bool matmul_minus(TPVector &res, const TPVector &x) const;
 
 	///	assignment
 		this_type &operator =(const this_type &M);
 
+	private:
+	///	res = alpha*res + beta*A*x, where x is changed from additive or unique to consistent
+		template<typename TPVector>
+		void axpy_make_consistent(TPVector &res, const number &alpha,
+		                          const number &beta, const TPVector &x) const;
+
+	///	as above, overlapping the communication with the computation of rows
+	///	(static block types only)
+		template<typename TPVector>
+		void axpy_make_consistent(TPVector &res, const number &alpha,
+		                          const number &beta, const TPVector &x,
+		                          Int2Type<true>) const;
+
+	///	as above, changing the storage type first (block types without static size)
+		template<typename TPVector>
+		void axpy_make_consistent(TPVector &res, const number &alpha,
+		                          const number &beta, const TPVector &x,
+		                          Int2Type<false>) const;
+
+	///	sorts the rows by their coupling to the interfaces of the given layouts
+	/**	returns false if the matrix type does not support it or the matrix is
+	 * not finalized. The split is cached until the pattern or the layouts change.*/
+		bool update_row_split(const HorizontalAlgebraLayouts& layouts) const;
+
 	private:
 	/// type of storage  (i.e. consistent, additiv, additiv unique)
 		uint m_type;
 
 	/// algebra layouts and communicators
 		ConstSmartPtr<AlgebraLayouts> m_spAlgebraLayouts;
+
+	///	rows without columns in interfaces, followed by the rows with columns
+	///	only in master interfaces and the rows with columns in slave interfaces
+		mutable std::vector<size_t> m_vSplitRows;
+
+	///	end of the interior rows and of the master coupled rows in m_vSplitRows
+		mutable size_t m_numInteriorRows, m_numMasterRows;
+
+	///	pattern and layouts revision the split was computed for
+		mutable size_t m_rowSplitPattern, m_rowSplitLayouts;
+		mutable bool m_bRowSplitValid;
 };
 
 //	predaclaration.
@@ -38,6 +38,40 @@
 namespace ug
 {
 
+template <typename T> class SparseMatrix;
+
+///	returns true and the pattern revision if the rows of A can be split for overlapping
+template <typename TMatrix>
+inline bool RowSplitPatternRevision(const TMatrix& A, size_t& revision)
+{
+	return false;
+}
+
+template <typename T>
+inline bool RowSplitPatternRevision(const SparseMatrix<T>& A, size_t& revision)
+{
+	if(!A.is_finalized()) return false;
+	revision = A.pattern_revision();
+	return true;
+}
+
+///	dest = alpha*dest + beta*A*w for the given rows only
+template <typename TMatrix, typename TVector>
+inline void AxpyRowList(const TMatrix& A, TVector& dest, const number& alpha,
+                        const number& beta, const TVector& w,
+                        const size_t* rows, size_t numRows)
+{
+	UG_THROW("AxpyRowList: not implemented for this matrix type.");
+}
+
+template <typename T, typename TVector>
+inline void AxpyRowList(const SparseMatrix<T>& A, TVector& dest, const number& alpha,
+                        const number& beta, const TVector& w,
+                        const size_t* rows, size_t numRows)
+{
+	A.axpy_row_list(dest, alpha, dest, beta, w, rows, numRows);
+}
+
 template <typename TMatrix>
 typename ParallelMatrix<TMatrix>::this_type&
 ParallelMatrix<TMatrix>::operator =(const typename ParallelMatrix<TMatrix>::this_type &M)
@@ -48,6 +82,7 @@ ParallelMatrix<TMatrix>::operator =(const typename ParallelMatrix<TMatrix>::this
 //	copy storage type and layouts
 	this->set_storage_type(M.get_storage_mask());
 	this->set_layouts(M.layouts());
+	m_bRowSplitValid = false;
 
 //	we're done
 	return *this;
@@ -91,6 +126,8 @@ apply(TPVector &res, const TPVector &x) const
 			&& x.has_storage_type(PST_ADDITIVE)) type = 1;
 	if(has_storage_type(PST_CONSISTENT)
 			&& x.has_storage_type(PST_CONSISTENT)) type = 2;
+	if(type == -1 && has_storage_type(PST_ADDITIVE)
+			&& (x.has_storage_type(PST_ADDITIVE) || x.has_storage_type(PST_UNIQUE))) type = 3;
 
 //	if no admissible type is found, return error
 	if(type == -1)
@@ -99,11 +136,13 @@ apply(TPVector &res, const TPVector &x) const
 				"Wrong storage type of Matrix/Vector: Possibilities are:\n"
 				"    - A is PST_ADDITIVE and x is PST_CONSISTENT\n"
 				"    - A is PST_CONSISTENT and x is PST_ADDITIVE\n"
+				"    - A is PST_ADDITIVE and x is PST_ADDITIVE or PST_UNIQUE (x is made consistent)\n"
 				"    (storage type of A = " << get_storage_type() << ", x = " << x.get_storage_type() << ")");
 	}
 
 //	apply on single process vector
-	TMatrix::axpy(res, 0.0, res, 1.0, x);
+	if(type == 3) axpy_make_consistent(res, 0.0, 1.0, x);
+	else TMatrix::axpy(res, 0.0, res, 1.0, x);
 
 //	set outgoing vector to additive storage
 	switch(type)
@@ -111,6 +150,7 @@ apply(TPVector &res, const TPVector &x) const
 		case 0: res.set_storage_type(PST_ADDITIVE); break;
 		case 1: res.set_storage_type(PST_ADDITIVE); break;
 		case 2: res.set_storage_type(PST_CONSISTENT); break;
+		case 3: res.set_storage_type(PST_ADDITIVE); break;
 	}
 
 //	we're done.
@@ -172,6 +212,9 @@ matmul_minus(TPVector &res, const TPVector &x) const
 	if(this->has_storage_type(PST_ADDITIVE)
 			&& x.has_storage_type(PST_CONSISTENT)
 			&& res.has_storage_type(PST_ADDITIVE)) type = 0;
+	if(type == -1 && this->has_storage_type(PST_ADDITIVE)
+			&& (x.has_storage_type(PST_ADDITIVE) || x.has_storage_type(PST_UNIQUE))
+			&& res.has_storage_type(PST_ADDITIVE)) type = 1;
 
 //	if no admissible type is found, return error
 	if(type == -1)
@@ -179,23 +222,152 @@ matmul_minus(TPVector &res, const TPVector &x) const
 		UG_THROW("ParallelMatrix::matmul_minus (b -= A*x):"
 				" Wrong storage type of Matrix/Vector: Possibilities are:\n"
 				"    - A is PST_ADDITIVE and x is PST_CONSISTENT and b is PST_ADDITIVE\n"
+				"    - A is PST_ADDITIVE and x is PST_ADDITIVE or PST_UNIQUE and b is PST_ADDITIVE (x is made consistent)\n"
 				"    (storage type of A = " << this->get_storage_type() << ", x = " << x.get_storage_type() << ", b = " << res.get_storage_type() << ")");
 	}
 
 //	apply on single process vector
-	TMatrix::axpy(res, 1.0, res, -1.0, x);
+	if(type == 1) axpy_make_consistent(res, 1.0, -1.0, x);
+	else TMatrix::axpy(res, 1.0, res, -1.0, x);
 
 //	set outgoing vector to additive storage
 //	(it could have been PST_UNIQUE before)
-	switch(type)
+	res.set_storage_type(PST_ADDITIVE);
+
+//	we're done.
+	return true;
+}
+
+template <typename TMatrix>
+bool
+ParallelMatrix<TMatrix>::
+update_row_split(const HorizontalAlgebraLayouts& layouts) const
+{
+	size_t patternRev;
+	if(!RowSplitPatternRevision(static_cast<const TMatrix&>(*this), patternRev))
+		return false;
+
+	if(m_bRowSplitValid && m_rowSplitPattern == patternRev
+		&& m_rowSplitLayouts == layouts.revision())
+		return true;
+
+	PROFILE_FUNC_GROUP("algebra parallelization");
+
+//	mark interface indices: 1 = master, 2 = slave
+	std::vector<char> vMark(this->num_cols(), 0);
+	const IndexLayout* vLayout[2] = {&layouts.master(), &layouts.slave()};
+	for(char mark = 1; mark <= 2; ++mark)
 	{
-		case 0: res.set_storage_type(PST_ADDITIVE); break;
+		const IndexLayout& layout = *vLayout[mark-1];
+		for(IndexLayout::const_iterator iiter = layout.begin(); iiter != layout.end(); ++iiter)
+		{
+			const IndexLayout::Interface& interface = layout.interface(iiter);
+			for(IndexLayout::Interface::const_iterator iter = interface.begin();
+					iter != interface.end(); ++iter)
+				vMark[interface.get_element(iter)] = mark;
+		}
 	}
 
-//	we're done.
+//	classify each row by the strongest coupling of its columns
+	std::vector<size_t> vRows[3];
+	for(size_t r = 0; r < this->num_rows(); ++r)
+	{
+		char coupling = 0;
+		for(typename TMatrix::const_row_iterator it = this->begin_row(r);
+				it != this->end_row(r) && coupling < 2; ++it)
+			coupling = std::max(coupling, vMark[it.index()]);
+		vRows[(int)coupling].push_back(r);
+	}
+
+	m_vSplitRows.clear();
+	m_vSplitRows.reserve(this->num_rows());
+	for(int i = 0; i < 3; ++i)
+		m_vSplitRows.insert(m_vSplitRows.end(), vRows[i].begin(), vRows[i].end());
+	m_numInteriorRows = vRows[0].size();
+	m_numMasterRows = m_numInteriorRows + vRows[1].size();
+
+	m_rowSplitPattern = patternRev;
+	m_rowSplitLayouts = layouts.revision();
+	m_bRowSplitValid = true;
 	return true;
 }
 
+template <typename TMatrix>
+template<typename TPVector>
+void
+ParallelMatrix<TMatrix>::
+axpy_make_consistent(TPVector &res, const number &alpha, const number &beta,
+                     const TPVector &x) const
+{
+	typedef typename TPVector::value_type value_type;
+	axpy_make_consistent(res, alpha, beta, x,
+	                     Int2Type<block_traits<value_type>::is_static>());
+}
+
+template <typename TMatrix>
+template<typename TPVector>
+void
+ParallelMatrix<TMatrix>::
+axpy_make_consistent(TPVector &res, const number &alpha, const number &beta,
+                     const TPVector &x, Int2Type<false>) const
+{
+	TPVector& xNonConst = const_cast<TPVector&>(x);
+	if(!xNonConst.change_storage_type(PST_CONSISTENT))
+		UG_THROW("ParallelMatrix: Cannot change storage type of x to consistent.");
+	TMatrix::axpy(res, alpha, res, beta, x);
+}
+
+template <typename TMatrix>
+template<typename TPVector>
+void
+ParallelMatrix<TMatrix>::
+axpy_make_consistent(TPVector &res, const number &alpha, const number &beta,
+                     const TPVector &x, Int2Type<true>) const
+{
+	typedef typename TPVector::value_type value_type;
+	TPVector& xNonConst = const_cast<TPVector&>(x);
+	const HorizontalAlgebraLayouts& layouts = *x.layouts();
+
+//	without a row split, change the storage type first
+	if(layouts.overlap_enabled() || !update_row_split(layouts))
+	{
+		axpy_make_consistent(res, alpha, beta, x, Int2Type<false>());
+		return;
+	}
+
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	const TMatrix& A = static_cast<const TMatrix&>(*this);
+	const size_t* rows = m_vSplitRows.empty() ? NULL : &m_vSplitRows[0];
+	LayoutCommPlan& toSlave = layouts.comm_plan(layouts.master(), layouts.slave(),
+	                                            sizeof(value_type));
+
+	if(x.has_storage_type(PST_UNIQUE))
+	{
+	//	only the slave values change: compute all rows not coupled to slaves
+		toSlave.start(xNonConst);
+		AxpyRowList(A, res, alpha, beta, x, rows, m_numMasterRows);
+		toSlave.finish_copy(xNonConst);
+	}
+	else
+	{
+	//	the master values change in the first, the slave values in the second step
+		LayoutCommPlan& toMaster = layouts.comm_plan(layouts.slave(), layouts.master(),
+		                                             sizeof(value_type));
+		toMaster.start(xNonConst);
+		AxpyRowList(A, res, alpha, beta, x, rows, m_numInteriorRows);
+		toMaster.finish_add(xNonConst);
+
+		toSlave.start(xNonConst);
+		AxpyRowList(A, res, alpha, beta, x, rows + m_numInteriorRows,
+		            m_numMasterRows - m_numInteriorRows);
+		toSlave.finish_copy(xNonConst);
+	}
+	xNonConst.set_storage_type(PST_CONSISTENT);
+
+	AxpyRowList(A, res, alpha, beta, x, rows + m_numMasterRows,
+	            m_vSplitRows.size() - m_numMasterRows);
+}
+
 
 template<typename matrix_type, typename vector_type>
 ug::ParallelStorageType GetMultType(const ParallelMatrix<matrix_type> &A1, const ParallelVector<vector_type> &x)
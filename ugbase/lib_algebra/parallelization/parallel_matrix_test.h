@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_ALGEBRA__PARALLELIZATION__PARALLEL_MATRIX_TEST__
+#define __H__LIB_ALGEBRA__PARALLELIZATION__PARALLEL_MATRIX_TEST__
+
+#ifdef UG_PARALLEL
+
+#include "common/error.h"
+#include "common/log.h"
+#include "pcl/pcl.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+#include "parallelization_util.h"
+
+namespace ug{
+
+///	returns the global maximum of the blockwise distance of two vectors
+template <typename TVector>
+number ParallelMatrixTestDistance(const TVector& a, const TVector& b)
+{
+	number dist = 0;
+	for(size_t i = 0; i < a.size(); ++i)
+	{
+		typename TVector::value_type t = a[i];
+		t -= b[i];
+		dist = std::max(dist, (number)BlockNorm(t));
+	}
+	const pcl::ProcessCommunicator& pc = a.layouts()->proc_comm();
+	if(pc.empty()) return dist;
+	return pc.allreduce(dist, PCL_RO_MAX);
+}
+
+///	compares the overlapped parallel products with the products for a consistent vector
+/**
+ * ParallelMatrix::apply and ParallelMatrix::matmul_minus accept a unique or
+ * additive vector for an additive matrix and make it consistent while the
+ * rows not depending on the exchanged values are computed. This function
+ * computes A*x and d - A*x for the given x in consistent, unique and additive
+ * storage (for a finalized copy of A, since only those are split) and throws
+ * if the results differ from the products for the consistent x by more than
+ * tol (relative to the norm of A*x, if it is larger than 1).
+ *
+ * \param[in]	spOp	operator with an additive matrix
+ * \param[in]	x		vector (of any storage type)
+ * \param[in]	tol		relative tolerance
+ */
+template <typename TAlgebra>
+void TestParallelMatrixOverlap(SmartPtr<MatrixOperator<typename TAlgebra::matrix_type,
+                                                       typename TAlgebra::vector_type> > spOp,
+                               const typename TAlgebra::vector_type& x, number tol)
+{
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef typename TAlgebra::vector_type vector_type;
+
+	UG_COND_THROW(!spOp->get_matrix().has_storage_type(PST_ADDITIVE),
+	              "TestParallelMatrixOverlap: additive matrix expected.");
+
+//	finalized copy of the matrix
+	matrix_type A;
+	A = spOp->get_matrix();
+	A.finalize();
+
+//	reference: consistent x
+	SmartPtr<vector_type> spXc = x.clone();
+	if(!spXc->change_storage_type(PST_CONSISTENT))
+		UG_THROW("TestParallelMatrixOverlap: cannot make x consistent.");
+
+	SmartPtr<vector_type> spRef = x.clone_without_values();
+	A.apply(*spRef, *spXc);
+	const number scale = std::max((number)1.0, (number)spRef->clone()->norm());
+
+	SmartPtr<vector_type> spR = x.clone_without_values();
+
+//	unique x (as returned by the smoothers)
+	SmartPtr<vector_type> spXu = spXc->clone();
+	SetLayoutValues(spXu.get(), spXu->layouts()->slave(), 0);
+	spXu->set_storage_type(PST_UNIQUE);
+	A.apply(*spR, *spXu);
+	UG_COND_THROW(!spXu->has_storage_type(PST_CONSISTENT),
+	              "TestParallelMatrixOverlap: x not consistent after apply.");
+	const number errUniqueX = ParallelMatrixTestDistance(*spXu, *spXc);
+	const number errUnique = ParallelMatrixTestDistance(*spR, *spRef);
+
+//	additive x: split the value of each interface index equally among its copies
+	SmartPtr<vector_type> spCnt = x.clone_without_values();
+	spCnt->set(1.0);
+	spCnt->set_storage_type(PST_ADDITIVE);
+	spCnt->change_storage_type(PST_CONSISTENT);
+
+	SmartPtr<vector_type> spXa = spXc->clone();
+	for(size_t i = 0; i < spXa->size(); ++i)
+		(*spXa)[i] *= 1.0 / BlockRef((*spCnt)[i], 0);
+	spXa->set_storage_type(PST_ADDITIVE);
+	A.apply(*spR, *spXa);
+	const number errAdditiveX = ParallelMatrixTestDistance(*spXa, *spXc);
+	const number errAdditive = ParallelMatrixTestDistance(*spR, *spRef);
+
+//	defect update with unique x: d := A*x - A*x
+	SmartPtr<vector_type> spXm = spXu->clone();
+	SetLayoutValues(spXm.get(), spXm->layouts()->slave(), 0);
+	spXm->set_storage_type(PST_UNIQUE);
+	*spR = *spRef;
+	A.matmul_minus(*spR, *spXm);
+	spRef->set(0.0);
+	spRef->set_storage_type(PST_ADDITIVE);
+	const number errMinus = ParallelMatrixTestDistance(*spR, *spRef);
+
+	UG_LOG("TestParallelMatrixOverlap: max. deviation apply (unique x): " << errUnique
+	       << ", apply (additive x): " << errAdditive << ", matmul_minus: " << errMinus
+	       << ", x: " << std::max(errUniqueX, errAdditiveX) << "\n");
+
+	const number maxErr = std::max(std::max(errUnique, errAdditive),
+	                               std::max(errMinus, std::max(errUniqueX, errAdditiveX)));
+	if(maxErr > tol * scale)
+		UG_THROW("TestParallelMatrixOverlap: overlapped products differ by "
+		         << maxErr << " (tolerance " << tol << ").");
+}
+
+} // end namespace ug
+
+#endif /* UG_PARALLEL */
+
+#endif /* __H__LIB_ALGEBRA__PARALLELIZATION__PARALLEL_MATRIX_TEST__ */
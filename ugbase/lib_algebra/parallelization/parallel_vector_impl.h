@@ -138,15 +138,13 @@ change_storage_type(ParallelStorageType type)
 		case PST_CONSISTENT:
 			if(has_storage_type(PST_UNIQUE)){
 				PARVEC_PROFILE_BEGIN(ParVec_CSTUnique2Consistent);
-				UniqueToConsistent(this, layouts()->master(), layouts()->slave(),
-				                   &layouts()->comm());
+				UniqueToConsistent(this, *layouts());
 				set_storage_type(PST_CONSISTENT);
 				PARVEC_PROFILE_END(); //ParVec_CSTUnique2Consistent
 			}
 			else if(has_storage_type(PST_ADDITIVE)){
 				PARVEC_PROFILE_BEGIN(ParVec_CSTAdditive2Consistent);
-				AdditiveToConsistent(this, layouts()->master(), layouts()->slave(),
-				                     &layouts()->comm());
+				AdditiveToConsistent(this, *layouts());
 				set_storage_type(PST_CONSISTENT);
 				PARVEC_PROFILE_END(); //ParVec_CSTAdditive2Consistent
 			}
@@ -154,8 +152,8 @@ change_storage_type(ParallelStorageType type)
 
 			if(layouts()->overlap_enabled()){
 				PARVEC_PROFILE_BEGIN(ParVec_CSTAdditive2Consistent_CopyOverlap);
-				CopyValues(this, layouts()->slave_overlap(),
-				           layouts()->master_overlap(), &layouts()->comm());
+				CopyValues(this, *layouts(), layouts()->slave_overlap(),
+				           layouts()->master_overlap());
 			}
 
 			break;
@@ -182,15 +180,13 @@ change_storage_type(ParallelStorageType type)
 			if(has_storage_type(PST_ADDITIVE)){
 				PARVEC_PROFILE_BEGIN(ParVec_CSTAdditive2Unique);
 				if(layouts()->overlap_enabled()){
-					AdditiveToConsistent(this, layouts()->master(), layouts()->slave(),
-				                     	 &layouts()->comm());
-					CopyValues(this, layouts()->slave_overlap(),
-				           	   layouts()->master_overlap(), &layouts()->comm());
+					AdditiveToConsistent(this, *layouts());
+					CopyValues(this, *layouts(), layouts()->slave_overlap(),
+				           	   layouts()->master_overlap());
 					ConsistentToUnique(this, layouts()->slave());
 				}
 				else{
-					AdditiveToUnique(this, layouts()->master(), layouts()->slave(),
-					                 &layouts()->comm());
+					AdditiveToUnique(this, *layouts());
 				}
 				add_storage_type(PST_UNIQUE);
 				PARVEC_PROFILE_END(); //ParVec_CSTAdditive2Unique
@@ -198,8 +194,8 @@ change_storage_type(ParallelStorageType type)
 			else if(has_storage_type(PST_CONSISTENT)){
 				PARVEC_PROFILE_BEGIN(ParVec_CSTConsistent2Unique);
 				if(layouts()->overlap_enabled()){
-					CopyValues(this, layouts()->slave_overlap(),
-				           	   layouts()->master_overlap(), &layouts()->comm());
+					CopyValues(this, *layouts(), layouts()->slave_overlap(),
+				           	   layouts()->master_overlap());
 				}
 				ConsistentToUnique(this, layouts()->slave());
 				set_storage_type(PST_ADDITIVE);
@@ -351,9 +347,9 @@ number ParallelVector<TVector>::dotprod(const this_type& v)
 	//			such a change and do it outside of this function
 	if(!check)
 	{
-		// unique <-> additive => consistent <-> additive
-		if(this->has_storage_type(PST_UNIQUE)
-				&& v.has_storage_type(PST_ADDITIVE))
+		// unique or additive <-> additive => consistent <-> additive
+		if(v.has_storage_type(PST_ADDITIVE)
+				&& !v.has_storage_type(PST_UNIQUE))
 		{this->change_storage_type(PST_CONSISTENT);}
 		// additive <-> unique => unique <-> unique
 		else if(this->has_storage_type(PST_ADDITIVE)
@@ -415,8 +411,8 @@ void ParallelVector<TVector>::check_storage_type() const
 
 //	c) for consistent: slave values must be equal to master values
 	if(this->has_storage_type(PST_CONSISTENT)){
-	//	create a new communicator if required.
-		pcl::InterfaceCommunicator<IndexLayout> com;
+	//	use the (reused) communicator of the layouts
+		pcl::InterfaceCommunicator<IndexLayout>& com = layouts()->comm();
 
 	//	step 1: copy master values to slaves
 	//	create the required communication policies
@@ -503,6 +499,21 @@ inline void VecScaleAdd(ParallelVector<T> &dest,
 	VecScaleAdd((T&)dest, alpha1, (const T&)v1, alpha2, (const T&)v2, alpha3, (const T&)v3);
 }
 
+// x = x + alpha*p, r = r + beta*q
+template<typename T>
+inline void VecScaleAddPair(ParallelVector<T> &x, double alpha, const ParallelVector<T> &p,
+                            ParallelVector<T> &r, double beta, const ParallelVector<T> &q)
+{
+	PROFILE_FUNC_GROUP("algebra");
+	uint maskX = x.get_storage_mask() & p.get_storage_mask();
+	uint maskR = r.get_storage_mask() & q.get_storage_mask();
+	UG_COND_THROW(maskX == 0 || maskR == 0, "VecScaleAddPair: cannot add vectors");
+	x.set_storage_type(maskX);
+	r.set_storage_type(maskR);
+
+	VecScaleAddPair((T&)x, alpha, (const T&)p, (T&)r, beta, (const T&)q);
+}
+
 // returns scal<a, b>
 template<typename T>
 inline double VecProd(const ParallelVector<T> &a, const ParallelVector<T> &b)
@@ -37,6 +37,7 @@
 #include <vector>
 #include <map>
 #include "common/assert.h"
+#include "common/util/metaprogramming_util.h"
 #include "algebra_id.h"
 #include "communication_policies.h"
 #include "algebra_layouts.h"
@@ -279,6 +280,113 @@ void AdditiveToUnique(	TVector* pVec,
 		com.communicate();
 }
 
+/// copies values from the source to the target layout (block types without static size)
+template <typename TVector>
+void CopyValues(	TVector* pVec, const HorizontalAlgebraLayouts& layouts,
+					const IndexLayout& sourceLayout, const IndexLayout& targetLayout,
+					Int2Type<false>)
+{
+	CopyValues(pVec, sourceLayout, targetLayout, &layouts.comm());
+}
+
+/// copies values from the source to the target layout using a persistent plan
+template <typename TVector>
+void CopyValues(	TVector* pVec, const HorizontalAlgebraLayouts& layouts,
+					const IndexLayout& sourceLayout, const IndexLayout& targetLayout,
+					Int2Type<true>)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	typedef typename TVector::value_type value_type;
+	LayoutCommPlan& plan = layouts.comm_plan(sourceLayout, targetLayout, sizeof(value_type));
+	plan.start(*pVec);
+	plan.finish_copy(*pVec);
+}
+
+/// copies values from the source to the target layout using a persistent plan
+/**
+ * Uses the persistent communication plan of the layouts for vectors with
+ * static block types and falls back to CopyValues with the communicator of
+ * the layouts otherwise. source and target must be layouts of layouts.
+ */
+template <typename TVector>
+void CopyValues(	TVector* pVec, const HorizontalAlgebraLayouts& layouts,
+					const IndexLayout& sourceLayout, const IndexLayout& targetLayout)
+{
+	typedef typename TVector::value_type value_type;
+	CopyValues(pVec, layouts, sourceLayout, targetLayout,
+	           Int2Type<block_traits<value_type>::is_static>());
+}
+
+/// changes parallel storage type from unique to consistent using a persistent plan
+template <typename TVector>
+void UniqueToConsistent(TVector* pVec, const HorizontalAlgebraLayouts& layouts)
+{
+	CopyValues(pVec, layouts, layouts.master(), layouts.slave());
+}
+
+/// changes parallel storage type from additive to unique (block types without static size)
+template <typename TVector>
+void AdditiveToUnique(TVector* pVec, const HorizontalAlgebraLayouts& layouts, Int2Type<false>)
+{
+	AdditiveToUnique(pVec, layouts.master(), layouts.slave(), &layouts.comm());
+}
+
+/// changes parallel storage type from additive to unique using a persistent plan
+template <typename TVector>
+void AdditiveToUnique(TVector* pVec, const HorizontalAlgebraLayouts& layouts, Int2Type<true>)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	typedef typename TVector::value_type value_type;
+	LayoutCommPlan& plan = layouts.comm_plan(layouts.slave(), layouts.master(), sizeof(value_type));
+	plan.start(*pVec, true);
+	plan.finish_add(*pVec);
+}
+
+/// changes parallel storage type from additive to unique using a persistent plan
+/**
+ * Uses the persistent communication plan of the layouts for vectors with
+ * static block types and falls back to AdditiveToUnique with the
+ * communicator of the layouts otherwise.
+ */
+template <typename TVector>
+void AdditiveToUnique(TVector* pVec, const HorizontalAlgebraLayouts& layouts)
+{
+	typedef typename TVector::value_type value_type;
+	AdditiveToUnique(pVec, layouts, Int2Type<block_traits<value_type>::is_static>());
+}
+
+/// changes parallel storage type from additive to consistent (block types without static size)
+template <typename TVector>
+void AdditiveToConsistent(TVector* pVec, const HorizontalAlgebraLayouts& layouts, Int2Type<false>)
+{
+	AdditiveToConsistent(pVec, layouts.master(), layouts.slave(), &layouts.comm());
+}
+
+/// changes parallel storage type from additive to consistent using persistent plans
+template <typename TVector>
+void AdditiveToConsistent(TVector* pVec, const HorizontalAlgebraLayouts& layouts, Int2Type<true>)
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	typedef typename TVector::value_type value_type;
+	LayoutCommPlan& plan = layouts.comm_plan(layouts.slave(), layouts.master(), sizeof(value_type));
+	plan.start(*pVec);
+	plan.finish_add(*pVec);
+	CopyValues(pVec, layouts, layouts.master(), layouts.slave(), Int2Type<true>());
+}
+
+/// changes parallel storage type from additive to consistent using persistent plans
+/**
+ * Uses the persistent communication plans of the layouts for vectors with
+ * static block types and falls back to AdditiveToConsistent with the
+ * communicator of the layouts otherwise.
+ */
+template <typename TVector>
+void AdditiveToConsistent(TVector* pVec, const HorizontalAlgebraLayouts& layouts)
+{
+	typedef typename TVector::value_type value_type;
+	AdditiveToConsistent(pVec, layouts, Int2Type<block_traits<value_type>::is_static>());
+}
+
 /// sets the values of a vector to a given number only on the interface indices
 /**
  * \param[in,out]		pVec			Vector
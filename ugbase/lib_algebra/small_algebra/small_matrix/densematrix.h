@@ -257,5 +257,6 @@ inline double MatrixTranspose(const double &b)
 
 #include "densematrix_impl.h"
 #include "densematrix_operations.h"
+#include "densematrix_fixed_kernels.h"
 
 #endif // __H__UG__COMMON__DENSEMATRIX_H__
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__SMALL_ALGEBRA__DENSEMATRIX_FIXED_KERNELS_H__
+#define __H__UG__SMALL_ALGEBRA__DENSEMATRIX_FIXED_KERNELS_H__
+
+#include "densematrix.h"
+#include "densevector.h"
+#include "../storage/fixed_array.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ug{
+
+/// \addtogroup small_algebra
+/// \{
+
+/**
+ * Kernels for square blocks of compile-time size N stored in FixedArray2.
+ *
+ * The generic DenseMatrix operations loop over the entries via operator()
+ * and forward each entry to the scalar MatMultAdd, the inverse kernels set
+ * up a DenseMatrixInverse (or call lapack) for every block. For the block
+ * algebras (CPUBlockAlgebra<N>) the block size is known at compile time, so
+ * the kernels below work directly on the contiguous storage with loops of
+ * fixed trip count, which the compiler fully unrolls and vectorizes for the
+ * small sizes in use (2..6). All temporaries are kept on the stack.
+ *
+ * The ordering dependent parts (storage index, matrix-vector product) are
+ * collected in FixedBlockKernels<N, TOrdering>.
+ */
+template<size_t N, eMatrixOrdering TOrdering>
+struct FixedBlockKernels;
+
+template<size_t N>
+struct FixedBlockKernels<N, ColMajor>
+{
+	static inline size_t index(size_t r, size_t c) {return r + c*N;}
+
+	///	s = A*w, computed column-wise (axpy of contiguous columns)
+	static inline void mat_vec(double *s, const double *A, const double *w)
+	{
+		for(size_t r = 0; r < N; ++r)
+			s[r] = A[r]*w[0];
+		for(size_t c = 1; c < N; ++c)
+		{
+			const double *Ac = A + c*N;
+			const double wc = w[c];
+			for(size_t r = 0; r < N; ++r)
+				s[r] += Ac[r]*wc;
+		}
+	}
+
+	///	s = A^T*w, computed with dot products of contiguous columns
+	static inline void mat_vec_transposed(double *s, const double *A, const double *w)
+	{
+		for(size_t c = 0; c < N; ++c)
+		{
+			const double *Ac = A + c*N;
+			double sum = Ac[0]*w[0];
+			for(size_t r = 1; r < N; ++r)
+				sum += Ac[r]*w[r];
+			s[c] = sum;
+		}
+	}
+};
+
+template<size_t N>
+struct FixedBlockKernels<N, RowMajor>
+{
+	static inline size_t index(size_t r, size_t c) {return c + r*N;}
+
+	///	s = A*w, computed with dot products of contiguous rows
+	static inline void mat_vec(double *s, const double *A, const double *w)
+	{
+	//	A^T in column major storage is A in row major storage
+		FixedBlockKernels<N, ColMajor>::mat_vec_transposed(s, A, w);
+	}
+
+	///	s = A^T*w, computed row-wise (axpy of contiguous rows)
+	static inline void mat_vec_transposed(double *s, const double *A, const double *w)
+	{
+		FixedBlockKernels<N, ColMajor>::mat_vec(s, A, w);
+	}
+};
+
+/**
+ * LU decomposition with partial pivoting of the NxN matrix LU (stored with
+ * ordering TOrdering), done in place. The row permutation is written to piv.
+ * \return false if a zero pivot is encountered
+ */
+template<size_t N, eMatrixOrdering TOrdering>
+inline bool FixedBlockLUDecomp(double *LU, size_t *piv)
+{
+	typedef FixedBlockKernels<N, TOrdering> K;
+
+	for(size_t k = 0; k < N; ++k)
+	{
+	//	find pivot
+		size_t p = k;
+		double maxVal = fabs(LU[K::index(k,k)]);
+		for(size_t r = k+1; r < N; ++r)
+		{
+			const double val = fabs(LU[K::index(r,k)]);
+			if(val > maxVal) {maxVal = val; p = r;}
+		}
+		if(maxVal == 0.0) return false;
+
+		piv[k] = p;
+		if(p != k)
+			for(size_t c = 0; c < N; ++c)
+				std::swap(LU[K::index(k,c)], LU[K::index(p,c)]);
+
+	//	eliminate below diagonal
+		const double invPivot = 1.0 / LU[K::index(k,k)];
+		for(size_t r = k+1; r < N; ++r)
+		{
+			const double l = (LU[K::index(r,k)] *= invPivot);
+			for(size_t c = k+1; c < N; ++c)
+				LU[K::index(r,c)] -= l * LU[K::index(k,c)];
+		}
+	}
+	return true;
+}
+
+/**
+ * Solves LU x = P b for a decomposition computed by FixedBlockLUDecomp.
+ * x is overwritten with the solution, on entry it holds b.
+ */
+template<size_t N, eMatrixOrdering TOrdering>
+inline void FixedBlockLUSolve(const double *LU, const size_t *piv, double *x)
+{
+	typedef FixedBlockKernels<N, TOrdering> K;
+
+	for(size_t k = 0; k < N; ++k)
+		if(piv[k] != k) std::swap(x[k], x[piv[k]]);
+
+	for(size_t r = 1; r < N; ++r)
+		for(size_t c = 0; c < r; ++c)
+			x[r] -= LU[K::index(r,c)] * x[c];
+
+	for(size_t r = N; r-- > 0; )
+	{
+		for(size_t c = r+1; c < N; ++c)
+			x[r] -= LU[K::index(r,c)] * x[c];
+		x[r] /= LU[K::index(r,r)];
+	}
+}
+
+/**
+ * Inverts the NxN matrix A in place.
+ * \return false if A is singular
+ */
+template<size_t N, eMatrixOrdering TOrdering>
+inline bool FixedBlockInvert(double *A)
+{
+	typedef FixedBlockKernels<N, TOrdering> K;
+
+	double LU[N*N];
+	size_t piv[N];
+	for(size_t i = 0; i < N*N; ++i) LU[i] = A[i];
+	if(!FixedBlockLUDecomp<N, TOrdering>(LU, piv)) return false;
+
+	double x[N];
+	for(size_t c = 0; c < N; ++c)
+	{
+		for(size_t r = 0; r < N; ++r) x[r] = 0.0;
+		x[c] = 1.0;
+		FixedBlockLUSolve<N, TOrdering>(LU, piv, x);
+		for(size_t r = 0; r < N; ++r) A[K::index(r,c)] = x[r];
+	}
+	return true;
+}
+
+
+//! calculates dest = beta1 * A1 * w1;
+template<size_t N, eMatrixOrdering TOrdering>
+inline void MatMult(DenseVector<FixedArray1<double, N> > &dest,
+		const number &beta1, const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &A1,
+		const DenseVector<FixedArray1<double, N> > &w1)
+{
+	double s[N];
+	FixedBlockKernels<N, TOrdering>::mat_vec(s, &A1(0,0), &w1[0]);
+
+	double *d = &dest[0];
+	for(size_t r = 0; r < N; ++r)
+		d[r] = beta1 * s[r];
+}
+
+//! calculates dest = alpha1*v1 + beta1 * A1 *w1;
+template<size_t N, eMatrixOrdering TOrdering>
+inline void MatMultAdd(DenseVector<FixedArray1<double, N> > &dest,
+		const number &alpha1, const DenseVector<FixedArray1<double, N> > &v1,
+		const number &beta1, const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &A1,
+		const DenseVector<FixedArray1<double, N> > &w1)
+{
+	double s[N];
+	FixedBlockKernels<N, TOrdering>::mat_vec(s, &A1(0,0), &w1[0]);
+
+	double *d = &dest[0];
+	const double *v = &v1[0];
+	for(size_t r = 0; r < N; ++r)
+		d[r] = alpha1 * v[r] + beta1 * s[r];
+}
+
+//! calculates dest = alpha1*v1 + beta1 * A1^T *w1;
+template<size_t N, eMatrixOrdering TOrdering>
+inline void MatMultTransposedAdd(DenseVector<FixedArray1<double, N> > &dest,
+		const number &alpha1, const DenseVector<FixedArray1<double, N> > &v1,
+		const number &beta1, const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &A1,
+		const DenseVector<FixedArray1<double, N> > &w1)
+{
+	double s[N];
+	FixedBlockKernels<N, TOrdering>::mat_vec_transposed(s, &A1(0,0), &w1[0]);
+
+	double *d = &dest[0];
+	const double *v = &v1[0];
+	for(size_t r = 0; r < N; ++r)
+		d[r] = alpha1 * v[r] + beta1 * s[r];
+}
+
+/**
+ * calculates dest = beta * mat^{-1} vec for fixed block sizes without
+ * setting up a DenseMatrixInverse. Called by InverseMatMult for N > 3, the
+ * sizes 1..3 use the closed form inverses.
+ */
+template<size_t N, eMatrixOrdering TOrdering>
+inline bool InverseMatMultN(DenseVector<FixedArray1<double, N> > &dest, double beta,
+		const DenseMatrix<FixedArray2<double, N, N, TOrdering> > &mat,
+		const DenseVector<FixedArray1<double, N> > &vec)
+{
+	double LU[N*N];
+	size_t piv[N];
+	const double *A = &mat(0,0);
+	for(size_t i = 0; i < N*N; ++i) LU[i] = A[i];
+	if(!FixedBlockLUDecomp<N, TOrdering>(LU, piv)) return false;
+
+	double x[N];
+	const double *b = &vec[0];
+	for(size_t r = 0; r < N; ++r) x[r] = b[r];
+	FixedBlockLUSolve<N, TOrdering>(LU, piv, x);
+
+	double *d = &dest[0];
+	for(size_t r = 0; r < N; ++r)
+		d[r] = beta * x[r];
+	return true;
+}
+
+//! inverts a fixed size block in place (used e.g. by DenseMatrix::operator/=)
+template<size_t N>
+inline bool Invert(DenseMatrix<FixedArray2<double, N, N, ColMajor> > &mat)
+{
+	return FixedBlockInvert<N, ColMajor>(&mat(0,0));
+}
+
+template<size_t N>
+inline bool Invert(DenseMatrix<FixedArray2<double, N, N, RowMajor> > &mat)
+{
+	return FixedBlockInvert<N, RowMajor>(&mat(0,0));
+}
+
+// end group small_algebra
+/// \}
+
+}
+
+#endif // __H__UG__SMALL_ALGEBRA__DENSEMATRIX_FIXED_KERNELS_H__
@@ -271,7 +271,7 @@ inline void MatMult(DenseVector<vector_t> &dest,
 		DenseVector<vector_t> tmp;
 		tmp = w1;
 		A1.apply(tmp);
-		VecScaleAssign(dest, beta1, dest);
+		VecScaleAssign(dest, beta1, tmp);
 	}
 }
 
@@ -46,6 +46,15 @@
 namespace ug{
 
 
+/**
+ * Local indices of an element.
+ *
+ * The DoFIndices of all functions are stored in one contiguous array; the
+ * indices of function fct are found in the range [offset(fct), offset(fct+1)).
+ * The storage keeps its capacity when the object is refilled, so that reusing
+ * one LocalIndices object for all elements of a loop does not allocate memory
+ * once the largest element has been seen.
+ */
 class LocalIndices
 {
 	public:
@@ -57,12 +66,13 @@ class LocalIndices
 
 	public:
 	///	Default Constructor
-		LocalIndices() {};
+		LocalIndices() : m_vOffset(1, 0) {};
 
 	///	sets the number of functions
 		void resize_fct(size_t numFct)
 		{
-			m_vvIndex.resize(numFct);
+			if(numFct < num_fct()) m_vIndex.resize(m_vOffset[numFct]);
+			m_vOffset.resize(numFct + 1, m_vIndex.size());
 			m_vLFEID.resize(numFct);
 		}
 
@@ -84,7 +94,17 @@ class LocalIndices
 		void resize_dof(size_t fct, size_t numDoF)
 		{
 			check_fct(fct);
-			m_vvIndex[fct].resize(numDoF);
+			const size_t oldNumDoF = num_dof(fct);
+			if(numDoF > oldNumDoF)
+				m_vIndex.insert(m_vIndex.begin() + m_vOffset[fct+1],
+				                numDoF - oldNumDoF, DoFIndex(0,0));
+			else if(numDoF < oldNumDoF)
+				m_vIndex.erase(m_vIndex.begin() + m_vOffset[fct] + numDoF,
+				               m_vIndex.begin() + m_vOffset[fct+1]);
+			else return;
+
+			for(size_t f = fct + 1; f < m_vOffset.size(); ++f)
+				m_vOffset[f] = m_vOffset[f] + numDoF - oldNumDoF;
 		}
 
 	///	clears the dofs of a function
@@ -94,73 +114,95 @@ class LocalIndices
 		void reserve_dof(size_t fct, size_t numDoF)
 		{
 			check_fct(fct);
-			m_vvIndex[fct].reserve(numDoF);
+			m_vIndex.reserve(m_vIndex.size() - num_dof(fct) + numDoF);
 		}
 
 	///	adds an index (increases size)
 		void push_back_index(size_t fct, size_t index) {push_back_multi_index(fct,index,0);}
 
 	///	adds an index (increases size)
+	/**
+	 * The index is inserted behind the last dof of the function. If the
+	 * functions are filled one after the other (i.e. all following functions
+	 * are still empty), this is an append to the flat storage.
+	 */
 		void push_back_multi_index(size_t fct, size_t index, size_t comp)
 		{
 			check_fct(fct);
-			m_vvIndex[fct].push_back(DoFIndex(index,comp));
+			m_vIndex.insert(m_vIndex.begin() + m_vOffset[fct+1], DoFIndex(index,comp));
+			for(size_t f = fct + 1; f < m_vOffset.size(); ++f) ++m_vOffset[f];
 		}
 
 	///	clears all fct
-		void clear() {m_vvIndex.clear();}
+		void clear() {m_vIndex.clear(); m_vOffset.resize(1);}
+
+	///	sets the dofs of all functions from flattened storage
+	/**
+	 * The dofs of function fct are given by pIndex[pOffset[fct]], ...,
+	 * pIndex[pOffset[fct+1]-1]. The number of functions is not changed, i.e.
+	 * pOffset must contain num_fct()+1 entries.
+	 */
+		void assign_dofs(const size_t* pOffset, const DoFIndex* pIndex)
+		{
+			const size_t first = pOffset[0];
+			m_vIndex.assign(pIndex + first, pIndex + pOffset[num_fct()]);
+			for(size_t f = 0; f < m_vOffset.size(); ++f)
+				m_vOffset[f] = pOffset[f] - first;
+		}
 
 	///	number of functions
-		size_t num_fct() const {return m_vvIndex.size();}
+		size_t num_fct() const {return m_vOffset.size() - 1;}
 
 	/// number of dofs for accessible function
 		size_t num_dof(size_t fct) const
 		{
 			check_fct(fct);
-			return m_vvIndex[fct].size();
+			return m_vOffset[fct+1] - m_vOffset[fct];
 		}
 
 	/// number of dofs of all accessible (sum)
-		size_t num_dof() const
+		size_t num_dof() const {return m_vIndex.size();}
+
+	///	position of the first dof of a function in the flat dof numbering
+		size_t offset(size_t fct) const
 		{
-			size_t num = 0;
-			for(size_t fct = 0; fct < num_fct(); ++fct) num += num_dof(fct);
-			return num;
+			UG_LOCALALGEBRA_ASSERT(fct <= num_fct(), "Wrong index.");
+			return m_vOffset[fct];
 		}
 
 	/// global algebra multi-index for (fct, dof)
 		const DoFIndex& multi_index(size_t fct, size_t dof) const
 		{
 			check_dof(fct, dof);
-			return m_vvIndex[fct][dof];
+			return m_vIndex[m_vOffset[fct] + dof];
 		}
 
 	/// global algebra index for (fct, dof)
 		index_type index(size_t fct, size_t dof) const
 		{
 			check_dof(fct, dof);
-			return m_vvIndex[fct][dof][0];
+			return m_vIndex[m_vOffset[fct] + dof][0];
 		}
 
 	/// global algebra index for (fct, dof)
 		index_type& index(size_t fct, size_t dof)
 		{
 			check_dof(fct, dof);
-			return m_vvIndex[fct][dof][0];
+			return m_vIndex[m_vOffset[fct] + dof][0];
 		}
 
 	/// algebra comp for (fct, dof)
 		comp_type comp(size_t fct, size_t dof) const
 		{
 			check_dof(fct, dof);
-			return m_vvIndex[fct][dof][1];
+			return m_vIndex[m_vOffset[fct] + dof][1];
 		}
 
 	/// algebra comp for (fct, dof)
 		comp_type& comp(size_t fct, size_t dof)
 		{
 			check_dof(fct, dof);
-			return m_vvIndex[fct][dof][1];
+			return m_vIndex[m_vOffset[fct] + dof][1];
 		}
 
 	protected:
@@ -177,13 +219,24 @@ class LocalIndices
 		}
 
 	protected:
-	// 	Mapping (fct, dof) -> local index
-		std::vector<std::vector<DoFIndex> > m_vvIndex;
+	// 	Mapping (offset(fct) + dof) -> local index
+		std::vector<DoFIndex> m_vIndex;
+
+	//	Offset of first dof of a function (size num_fct() + 1)
+		std::vector<size_t> m_vOffset;
 
 	//	Local finite element ids
 		std::vector<LFEID> m_vLFEID;
 };
 
+/**
+ * Local vector of an element.
+ *
+ * The values are stored in one contiguous array using the function offsets of
+ * the associated LocalIndices. Restricted access via a FunctionIndexMapping
+ * only stores the offsets of the accessible functions. Resizing keeps the
+ * capacity, i.e. a LocalVector reused in an element loop does not allocate.
+ */
 class LocalVector
 {
 	public:
@@ -195,19 +248,19 @@ class LocalVector
 
 	public:
 	///	default Constructor
-		LocalVector() : m_pIndex(NULL) {m_vvValue.clear();}
+		LocalVector() : m_pIndex(NULL), m_pFuncMap(NULL), m_vOffset(1, 0) {}
 
 	///	Constructor
-		LocalVector(const LocalIndices& ind) {resize(ind);}
+		LocalVector(const LocalIndices& ind) : m_pFuncMap(NULL) {resize(ind);}
 
 	///	resize for current local indices
 		void resize(const LocalIndices& ind)
 		{
 			m_pIndex = &ind;
-			m_vvValue.resize(ind.num_fct());
-			m_vvValueAcc.resize(m_vvValue.size());
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				m_vvValue[fct].resize(ind.num_dof(fct));
+			m_vOffset.resize(ind.num_fct() + 1);
+			for(size_t fct = 0; fct < m_vOffset.size(); ++fct)
+				m_vOffset[fct] = ind.offset(fct);
+			m_vValue.resize(ind.num_dof());
 			access_all();
 		}
 
@@ -221,9 +274,8 @@ class LocalVector
 	/// set all components of the vector
 		this_type& operator=(number val)
 		{
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] = val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] = val;
 			return *this;
 		}
 
@@ -236,9 +288,8 @@ class LocalVector
 	/// multiply all components of the vector
 		this_type& operator*=(number val)
 		{
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] *= val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] *= val;
 			return *this;
 		}
 
@@ -246,9 +297,8 @@ class LocalVector
 		this_type& operator+=(const this_type& rhs)
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pIndex==rhs.m_pIndex, "Not same indices.");
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] += rhs.m_vvValue[fct][dof];
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -256,9 +306,8 @@ class LocalVector
 		this_type& operator-=(const this_type& rhs)
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pIndex==rhs.m_pIndex, "Not same indices.");
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] -= rhs.m_vvValue[fct][dof];
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] -= rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -266,9 +315,8 @@ class LocalVector
 		this_type& scale_append(number s, const this_type& rhs)
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pIndex==rhs.m_pIndex, "Not same indices.");
-			for(size_t fct = 0; fct < m_vvValue.size(); ++fct)
-				for(size_t dof = 0; dof < m_vvValue[fct].size(); ++dof)
-					m_vvValue[fct][dof] += s * rhs.m_vvValue[fct][dof];
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += s * rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -280,28 +328,24 @@ class LocalVector
 		void access_by_map(const FunctionIndexMapping& funcMap)
 		{
 			m_pFuncMap = &funcMap;
+			m_vAccOffset.resize(funcMap.num_fct());
 			for(size_t i = 0; i < funcMap.num_fct(); ++i)
-			{
-				const size_t mapFct = funcMap[i];
-				m_vvValueAcc[i] = &(m_vvValue[mapFct][0]);
-			}
+				m_vAccOffset[i] = m_vOffset[funcMap[i]];
 		}
 
 	///	access all functions
 		void access_all()
 		{
 			m_pFuncMap = NULL;
-
-			if(m_pIndex==NULL) {m_vvValueAcc.clear(); return;}
-
-			for(size_t i = 0; i < m_pIndex->num_fct(); ++i)
-				m_vvValueAcc[i] = &(m_vvValue[i][0]);
+			m_vAccOffset.resize(num_all_fct());
+			for(size_t i = 0; i < m_vAccOffset.size(); ++i)
+				m_vAccOffset[i] = m_vOffset[i];
 		}
 
 	///	returns the number of currently accessible functions
 		size_t num_fct() const
 		{
-			if(m_pFuncMap == NULL) return m_vvValue.size();
+			if(m_pFuncMap == NULL) return num_all_fct();
 			return m_pFuncMap->num_fct();
 		}
 
@@ -318,22 +362,22 @@ class LocalVector
 		size_t num_dof(size_t fct) const
 		{
 			check_fct(fct);
-			if(m_pFuncMap == NULL) return m_vvValue[fct].size();
-			else return m_vvValue[ (*m_pFuncMap)[fct] ].size();
+			if(m_pFuncMap == NULL) return num_all_dof(fct);
+			else return num_all_dof( (*m_pFuncMap)[fct] );
 		}
 
 	/// access to dof of currently accessible function fct
 		number& operator()(size_t fct, size_t dof)
 		{
 			check_dof(fct,dof);
-			return m_vvValueAcc[fct][dof];
+			return m_vValue[m_vAccOffset[fct] + dof];
 		}
 
 	/// const access to dof of currently accessible function fct
 		number operator()(size_t fct, size_t dof) const
 		{
 			check_dof(fct,dof);
-			return m_vvValueAcc[fct][dof];
+			return m_vValue[m_vAccOffset[fct] + dof];
 		}
 
 		///////////////////////////
@@ -341,16 +385,20 @@ class LocalVector
 		///////////////////////////
 
 	///	returns the number of all functions
-		size_t num_all_fct() const {return m_vvValue.size();}
+		size_t num_all_fct() const {return m_vOffset.size() - 1;}
 
 	///	returns the number of dofs for a function (unrestricted functions)
-		size_t num_all_dof(size_t fct) const {check_all_fct(fct); return m_vvValue[fct].size();}
+		size_t num_all_dof(size_t fct) const
+		{
+			check_all_fct(fct);
+			return m_vOffset[fct+1] - m_vOffset[fct];
+		}
 
 	/// access to dof of a fct (unrestricted functions)
-		number& value(size_t fct, size_t dof){check_all_dof(fct,dof);return m_vvValue[fct][dof];}
+		number& value(size_t fct, size_t dof){check_all_dof(fct,dof);return m_vValue[m_vOffset[fct] + dof];}
 
 	/// const access to dof of a fct (unrestricted functions)
-		const number& value(size_t fct, size_t dof) const{check_all_dof(fct,dof);return m_vvValue[fct][dof];}
+		const number& value(size_t fct, size_t dof) const{check_all_dof(fct,dof);return m_vValue[m_vOffset[fct] + dof];}
 
 	protected:
 	///	checks correct fct index in debug mode
@@ -385,13 +433,25 @@ class LocalVector
 	/// Access Mapping
 		const FunctionIndexMapping* m_pFuncMap;
 
-	/// Entries (fct, dof)
-		std::vector<value_type*> m_vvValueAcc;
+	///	Offset of first dof of a function (size num_all_fct() + 1)
+		std::vector<size_t> m_vOffset;
+
+	/// Offset of first dof of an accessible function
+		std::vector<size_t> m_vAccOffset;
 
-	/// Entries (fct, dof)
-		std::vector<std::vector<value_type> > m_vvValue;
+	/// Entries (offset(fct) + dof)
+		std::vector<value_type> m_vValue;
 };
 
+/**
+ * Local matrix of an element.
+ *
+ * The couplings are stored in one contiguous, row-major array of size
+ * (number of row dofs) x (number of col dofs), where the rows and columns
+ * of a function start at the offsets given by the associated LocalIndices.
+ * Resizing keeps the capacity, i.e. a LocalMatrix reused in an element loop
+ * does not allocate.
+ */
 class LocalMatrix
 {
 	public:
@@ -405,7 +465,8 @@ class LocalMatrix
 	///	Constructor
 		LocalMatrix() :
 			m_pRowIndex(NULL), m_pColIndex(NULL) ,
-			m_pRowFuncMap(NULL), m_pColFuncMap(NULL)
+			m_pRowFuncMap(NULL), m_pColFuncMap(NULL),
+			m_vRowOffset(1, 0), m_vColOffset(1, 0)
 		{}
 
 	///	Constructor
@@ -424,15 +485,15 @@ class LocalMatrix
 			m_pRowIndex = &rowInd;
 			m_pColIndex = &colInd;
 
-			m_CplMat.resize(rowInd.num_fct(), colInd.num_fct());
-			m_CplMatAcc.resize(rowInd.num_fct(), colInd.num_fct());
+			m_vRowOffset.resize(rowInd.num_fct() + 1);
+			for(size_t fct = 0; fct < m_vRowOffset.size(); ++fct)
+				m_vRowOffset[fct] = rowInd.offset(fct);
 
-			for(size_t fct1 = 0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2 = 0; fct2 < m_CplMat.num_cols(); ++fct2)
-				{
-					m_CplMat(fct1, fct2).resize(colInd.num_dof(fct1),
-												rowInd.num_dof(fct2));
-				}
+			m_vColOffset.resize(colInd.num_fct() + 1);
+			for(size_t fct = 0; fct < m_vColOffset.size(); ++fct)
+				m_vColOffset[fct] = colInd.offset(fct);
+
+			m_vValue.resize(num_rows() * num_cols());
 
 			access_all();
 		}
@@ -450,9 +511,8 @@ class LocalMatrix
 	/// set all entries
 		this_type& operator=(number val)
 		{
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) = val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] = val;
 			return *this;
 		}
 
@@ -465,9 +525,8 @@ class LocalMatrix
 	/// multiply matrix
 		this_type& operator*=(number val)
 		{
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) *= val;
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] *= val;
 			return *this;
 		}
 
@@ -476,9 +535,8 @@ class LocalMatrix
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pRowIndex==rhs.m_pRowIndex &&
 			          m_pColIndex==rhs.m_pColIndex, "Not same indices.");
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) += rhs.m_CplMat(fct1,fct2);
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -487,9 +545,8 @@ class LocalMatrix
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pRowIndex==rhs.m_pRowIndex &&
 			          m_pColIndex==rhs.m_pColIndex, "Not same indices.");
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					m_CplMat(fct1,fct2) -= rhs.m_CplMat(fct1,fct2);
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] -= rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -498,9 +555,8 @@ class LocalMatrix
 		{
 			UG_LOCALALGEBRA_ASSERT(m_pRowIndex==rhs.m_pRowIndex &&
 					  m_pColIndex==rhs.m_pColIndex, "Not same indices.");
-			for(size_t fct1=0; fct1 < m_CplMat.num_rows(); ++fct1)
-				for(size_t fct2=0; fct2 < m_CplMat.num_cols(); ++fct2)
-					MatScaleAppend(m_CplMat(fct1,fct2), s, rhs.m_CplMat(fct1,fct2));
+			for(size_t i = 0; i < m_vValue.size(); ++i)
+				m_vValue[i] += s * rhs.m_vValue[i];
 			return *this;
 		}
 
@@ -521,14 +577,13 @@ class LocalMatrix
 			m_pRowFuncMap = &rowFuncMap;
 			m_pColFuncMap = &colFuncMap;
 
-			for(size_t i = 0; i < m_pRowFuncMap->num_fct(); ++i)
-				for(size_t j = 0; j < m_pColFuncMap->num_fct(); ++j)
-				{
-					const size_t rowMapFct = rowFuncMap[i];
-					const size_t colMapFct = colFuncMap[j];
+			m_vRowAccOffset.resize(rowFuncMap.num_fct());
+			for(size_t i = 0; i < m_vRowAccOffset.size(); ++i)
+				m_vRowAccOffset[i] = m_vRowOffset[rowFuncMap[i]];
 
-					m_CplMatAcc(i,j) = &(m_CplMat(rowMapFct, colMapFct));
-				}
+			m_vColAccOffset.resize(colFuncMap.num_fct());
+			for(size_t j = 0; j < m_vColAccOffset.size(); ++j)
+				m_vColAccOffset[j] = m_vColOffset[colFuncMap[j]];
 		}
 
 	///	access all functions
@@ -537,41 +592,41 @@ class LocalMatrix
 			m_pRowFuncMap = NULL;
 			m_pColFuncMap = NULL;
 
-			if(m_pRowIndex==NULL) {m_CplMatAcc.resize(0,0); return;}
+			m_vRowAccOffset.resize(num_all_row_fct());
+			for(size_t i = 0; i < m_vRowAccOffset.size(); ++i)
+				m_vRowAccOffset[i] = m_vRowOffset[i];
 
-			for(size_t i = 0; i < m_pRowIndex->num_fct(); ++i)
-				for(size_t j = 0; j < m_pColIndex->num_fct(); ++j)
-					m_CplMatAcc(i,j) = &(m_CplMat(i,j));
+			m_vColAccOffset.resize(num_all_col_fct());
+			for(size_t j = 0; j < m_vColAccOffset.size(); ++j)
+				m_vColAccOffset[j] = m_vColOffset[j];
 		}
 
 	///	returns the number of currently accessible (restricted) functions
 		size_t num_row_fct() const
 		{
 			if(m_pRowFuncMap != NULL) return m_pRowFuncMap->num_fct();
-			return m_CplMatAcc.num_rows();
+			return num_all_row_fct();
 		}
 
 	///	returns the number of currently accessible (restricted) functions
 		size_t num_col_fct() const
 		{
 			if(m_pColFuncMap != NULL) return m_pColFuncMap->num_fct();
-			return m_CplMatAcc.num_cols();
+			return num_all_col_fct();
 		}
 
 	///	returns the number of dofs for the currently accessible (restricted) function
 		size_t num_row_dof(size_t fct) const
 		{
-			if(m_CplMat.num_rows()==0) return 0;
-			if(m_pRowFuncMap == NULL) return m_CplMat(fct, 0).num_rows();
-			else return m_CplMat( (*m_pRowFuncMap)[fct], 0).num_rows();
+			if(m_pRowFuncMap == NULL) return num_all_row_dof(fct);
+			else return num_all_row_dof( (*m_pRowFuncMap)[fct] );
 		}
 
 	///	returns the number of dofs for the currently accessible (restricted) function
 		size_t num_col_dof(size_t fct) const
 		{
-			if(m_CplMat.num_cols()==0) return 0;
-			if(m_pRowFuncMap == NULL) return m_CplMat(0, fct).num_cols();
-			else return m_CplMat( 0, (*m_pColFuncMap)[fct]).num_cols();
+			if(m_pColFuncMap == NULL) return num_all_col_dof(fct);
+			else return num_all_col_dof( (*m_pColFuncMap)[fct] );
 		}
 
 	/// access to (restricted) coupling (rowFct, rowDoF) x (colFct, colDoF)
@@ -579,7 +634,8 @@ class LocalMatrix
 		                   size_t colFct, size_t colDoF)
 		{
 			check_dof(rowFct, rowDoF, colFct, colDoF);
-			return (*m_CplMatAcc(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowAccOffset[rowFct] + rowDoF) * num_cols()
+			                + m_vColAccOffset[colFct] + colDoF];
 		}
 
 	/// const access to (restricted) coupling (rowFct, rowDoF) x (colFct, colDoF)
@@ -587,7 +643,8 @@ class LocalMatrix
 		                        size_t colFct, size_t colDoF) const
 		{
 			check_dof(rowFct, rowDoF, colFct, colDoF);
-			return (*m_CplMatAcc(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowAccOffset[rowFct] + rowDoF) * num_cols()
+			                + m_vColAccOffset[colFct] + colDoF];
 		}
 
 		///////////////////////////
@@ -595,23 +652,24 @@ class LocalMatrix
 		///////////////////////////
 
 	///	returns the number of all functions
-		size_t num_all_row_fct() const{	return m_CplMat.num_rows();}
+		size_t num_all_row_fct() const{	return m_vRowOffset.size() - 1;}
 
 	///	returns the number of all functions
-		size_t num_all_col_fct() const{return m_CplMat.num_cols();}
+		size_t num_all_col_fct() const{return m_vColOffset.size() - 1;}
 
 	///	returns the number of dofs for a function
-		size_t num_all_row_dof(size_t fct) const {return m_CplMat(fct, 0).num_rows();}
+		size_t num_all_row_dof(size_t fct) const {return m_vRowOffset[fct+1] - m_vRowOffset[fct];}
 
 	///	returns the number of dofs for a function
-		size_t num_all_col_dof(size_t fct) const {return m_CplMat(0, fct).num_cols();}
+		size_t num_all_col_dof(size_t fct) const {return m_vColOffset[fct+1] - m_vColOffset[fct];}
 
 	/// access to coupling (rowFct, rowDoF) x (colFct, colDoF)
 		number& value(size_t rowFct, size_t rowDoF,
 		              size_t colFct, size_t colDoF)
 		{
 			check_all_dof(rowFct, rowDoF, colFct, colDoF);
-			return (m_CplMat(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowOffset[rowFct] + rowDoF) * num_cols()
+			                + m_vColOffset[colFct] + colDoF];
 		}
 
 	/// const access to coupling (rowFct, rowDoF) x (colFct, colDoF)
@@ -619,10 +677,17 @@ class LocalMatrix
 		                   size_t colFct, size_t colDoF) const
 		{
 			check_all_dof(rowFct, rowDoF, colFct, colDoF);
-			return (m_CplMat(rowFct,colFct))(rowDoF, colDoF);
+			return m_vValue[(m_vRowOffset[rowFct] + rowDoF) * num_cols()
+			                + m_vColOffset[colFct] + colDoF];
 		}
 
 	protected:
+	///	number of all row dofs
+		size_t num_rows() const {return m_vRowOffset.back();}
+
+	///	number of all column dofs
+		size_t num_cols() const {return m_vColOffset.back();}
+
 	///	checks correct (fct1,fct2) index in debug mode
 		inline void check_fct(size_t rowFct, size_t colFct) const
 		{
@@ -665,22 +730,20 @@ class LocalMatrix
 	/// Column Access Mapping
 		const FunctionIndexMapping* m_pColFuncMap;
 
-	//	\todo: Think of a better (faster) storage (one plain array?)
+	///	Offset of first row of a function (size num_all_row_fct() + 1)
+		std::vector<size_t> m_vRowOffset;
 
-	//	type of cpl matrices between two functions
-		typedef DenseMatrix<VariableArray2<value_type> > LocalCplMatrix;
+	///	Offset of first column of a function (size num_all_col_fct() + 1)
+		std::vector<size_t> m_vColOffset;
 
-	//	type of Func-Coupling matrices
-		typedef DenseMatrix<VariableArray2<LocalCplMatrix> > FctCplMatrix;
+	///	Offset of first row of an accessible function
+		std::vector<size_t> m_vRowAccOffset;
 
-	//	type of Func-Coupling pointer matrices
-		typedef DenseMatrix<VariableArray2<LocalCplMatrix*> > FctCplAccMatrix;
+	///	Offset of first column of an accessible function
+		std::vector<size_t> m_vColAccOffset;
 
-	// 	Entries (fct1, fct2, dof1, dof2)
-		FctCplMatrix m_CplMat;
-
-	// 	Entries (fct1, fct2, dof1, dof2)
-		FctCplAccMatrix m_CplMatAcc;
+	// 	Entries ((rowOffset(fct1) + dof1) * num_cols() + colOffset(fct2) + dof2)
+		std::vector<value_type> m_vValue;
 };
 
 inline
@@ -762,6 +825,54 @@ void AddLocalMatrixToGlobal(TMatrix& mat, const LocalMatrix& lmat)
 		}
 }
 
+template <typename TVector>
+void AddLocalMatVecToGlobal(TVector& y, const LocalMatrix& lmat, const TVector& x)
+{
+	const LocalIndices& rowInd = lmat.get_row_indices();
+	const LocalIndices& colInd = lmat.get_col_indices();
+
+	for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+		for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+		{
+			number sum = 0.0;
+			for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+				for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+				{
+					const size_t colIndex = colInd.index(fct2,dof2);
+					const size_t colComp = colInd.comp(fct2,dof2);
+
+					sum += lmat.value(fct1,dof1,fct2,dof2)
+							* BlockRef(x[colIndex], colComp);
+				}
+
+			BlockRef(y[rowInd.index(fct1,dof1)], rowInd.comp(fct1,dof1)) += sum;
+		}
+}
+
+template <typename TMatrix>
+void AddLocalMatrixDiagonalToGlobal(TMatrix& mat, const LocalMatrix& lmat)
+{
+	const LocalIndices& rowInd = lmat.get_row_indices();
+	const LocalIndices& colInd = lmat.get_col_indices();
+
+	for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+		for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+		{
+			const size_t rowIndex = rowInd.index(fct1,dof1);
+			const size_t rowComp = rowInd.comp(fct1,dof1);
+
+			for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+				for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+				{
+					if(colInd.index(fct2,dof2) != rowIndex) continue;
+					const size_t colComp = colInd.comp(fct2,dof2);
+
+					BlockRef(mat(rowIndex, rowIndex), rowComp, colComp)
+								+= lmat.value(fct1,dof1,fct2,dof2);
+				}
+		}
+}
+
 } // end namespace ug
 
 #endif /* __H__UG__LIB_DISC__COMMON__LOCAL_ALGEBRA__ */
@@ -71,7 +71,8 @@ DoFDistribution(SmartPtr<MultiGrid> spMG,
 	  m_spSurfView(spSurfView),
 	  m_gridLevel(level),
 	  m_spDoFIndexStorage(spDoFIndexStorage),
-	  m_numIndex(0)
+	  m_numIndex(0),
+	  m_revision(this)
 {
 	if(m_spDoFIndexStorage.invalid())
 		m_spDoFIndexStorage = SmartPtr<DoFIndexStorage>(new DoFIndexStorage(spMG, spDDInfo));
@@ -304,6 +305,27 @@ size_t DoFDistribution::_algebra_indices(TBaseElem* elem,
 //	clear indices
 	if(bClear) ind.clear();
 
+//	use cached indices if present
+	if(m_spIndexCache.invalid()){
+		extract_algebra_indices<TBaseElem>(elem, ind);
+		return ind.size();
+	}
+
+	if(!m_spIndexCache->get_algebra_indices(elem, ind)){
+		const size_t first = ind.size();
+		extract_algebra_indices<TBaseElem>(elem, ind);
+		m_spIndexCache->add_algebra_indices(elem, first < ind.size() ? &ind[first] : NULL,
+		                                    ind.size() - first);
+	}
+
+//	return number of indices
+	return ind.size();
+}
+
+template<typename TBaseElem>
+void DoFDistribution::extract_algebra_indices(TBaseElem* elem,
+                                              std::vector<size_t>& ind) const
+{
 //	reference dimension
 	static const int dim = TBaseElem::dim;
 
@@ -332,9 +354,6 @@ size_t DoFDistribution::_algebra_indices(TBaseElem* elem,
 		m_pMG->associated_elements(vVol, elem);
 		extract_inner_algebra_indices<Volume>(vVol, ind);
 	}
-
-//	return number of indices
-	return ind.size();
 }
 
 template<typename TBaseElem, typename TSubBaseElem>
@@ -730,7 +749,7 @@ size_t DoFDistribution::_dof_indices(TBaseElem* elem, size_t fct,
 
 template<typename TBaseElem>
 void DoFDistribution::indices_on_vertex(TBaseElem* elem, const ReferenceObjectID roid,
-                                          LocalIndices& ind,
+                                          size_t fct, LocalIndices& ind,
                                           const Grid::SecureVertexContainer& vElem) const
 {
 //	get reference object id for subelement
@@ -742,43 +761,39 @@ void DoFDistribution::indices_on_vertex(TBaseElem* elem, const ReferenceObjectID
 	//	get subset index
 		const int si = m_spMGSH->get_subset_index(vElem[i]);
 
-	//	loop all functions
-		for(size_t fct = 0; fct < num_fct(); ++fct)
-		{
-		//	check if function is defined on the subset
-			if(!is_def_in_subset(fct, si)) continue;
+	//	check if function is defined on the subset
+		if(!is_def_in_subset(fct, si)) continue;
 
-		//	get number of DoFs in this sub-geometric object
-			const size_t numDoFsOnSub = num_fct_dofs(fct,subRoid,si);
+	//	get number of DoFs in this sub-geometric object
+		const size_t numDoFsOnSub = num_fct_dofs(fct,subRoid,si);
 
-		//	Always no orientation needed
-			if(!m_bGrouped)
-			{
-			//	compute index
-				const size_t index = obj_index(vElem[i]) + offset(subRoid,si,fct);
+	//	Always no orientation needed
+		if(!m_bGrouped)
+		{
+		//	compute index
+			const size_t index = obj_index(vElem[i]) + offset(subRoid,si,fct);
 
-			//	add dof to local indices
-				for(size_t j = 0; j < numDoFsOnSub; ++j)
-					ind.push_back_index(fct, index+j);
-			}
-			else
-			{
-			//	compute index
-				const size_t index = obj_index(vElem[i]);
-				const size_t comp = offset(subRoid,si,fct);
+		//	add dof to local indices
+			for(size_t j = 0; j < numDoFsOnSub; ++j)
+				ind.push_back_index(fct, index+j);
+		}
+		else
+		{
+		//	compute index
+			const size_t index = obj_index(vElem[i]);
+			const size_t comp = offset(subRoid,si,fct);
 
-			//	add dof to local indices
-				for(size_t j = 0; j < numDoFsOnSub; ++j)
-					ind.push_back_multi_index(fct, index, comp+j);
-			}
-		} // end loop functions
+		//	add dof to local indices
+			for(size_t j = 0; j < numDoFsOnSub; ++j)
+				ind.push_back_multi_index(fct, index, comp+j);
+		}
 	} // end loop subelement
 
 }
 
 template<typename TBaseElem, typename TSubBaseElem>
 void DoFDistribution::indices(TBaseElem* elem, const ReferenceObjectID roid,
-                                LocalIndices& ind,
+                                size_t fct, LocalIndices& ind,
                                 const typename Grid::traits<TSubBaseElem>::secure_container& vElem) const
 {
 //	storage for offsets
@@ -796,64 +811,60 @@ void DoFDistribution::indices(TBaseElem* elem, const ReferenceObjectID roid,
 	//	get reference object id for subselement
 		const ReferenceObjectID subRoid = subElem->reference_object_id();
 
-	//	loop all functions
-		for(size_t fct = 0; fct < num_fct(); ++fct)
-		{
-		//	check if function is defined on the subset
-			if(!is_def_in_subset(fct, si)) continue;
+	//	check if function is defined on the subset
+		if(!is_def_in_subset(fct, si)) continue;
 
-		//	get number of DoFs in this sub-geometric object
-			const size_t numDoFsOnSub = num_fct_dofs(fct,subRoid,si);
-
-		//	Orientation is required: Thus, we compute the offsets, that are
-		//	no longer in the usual order [0, 1, 2, ...]. Orientation is
-		//	required if there are more than 1 dof on a subelement of a
-		//	finite element and thus, when gluing two elements together,
-		//	also the dofs on the subelements have to fit in order to
-		//	guarantee continuity. This is not needed for Vertices, since there
-		//	no distinction can be made when all dofs are at the same position.
-		//	This is also not needed for the highest dimension of a finite
-		//	element, since the dofs on this geometric object must not be
-		//	identified with other dofs.
-			ComputeOrientationOffset(vOrientOffset, elem, subElem, i, lfeid(fct));
-
-			UG_ASSERT(vOrientOffset.size() == numDoFsOnSub ||
-			          vOrientOffset.empty(), "Something wrong with orientation");
+	//	get number of DoFs in this sub-geometric object
+		const size_t numDoFsOnSub = num_fct_dofs(fct,subRoid,si);
+
+	//	Orientation is required: Thus, we compute the offsets, that are
+	//	no longer in the usual order [0, 1, 2, ...]. Orientation is
+	//	required if there are more than 1 dof on a subelement of a
+	//	finite element and thus, when gluing two elements together,
+	//	also the dofs on the subelements have to fit in order to
+	//	guarantee continuity. This is not needed for Vertices, since there
+	//	no distinction can be made when all dofs are at the same position.
+	//	This is also not needed for the highest dimension of a finite
+	//	element, since the dofs on this geometric object must not be
+	//	identified with other dofs.
+		ComputeOrientationOffset(vOrientOffset, elem, subElem, i, lfeid(fct));
 
-			if(!m_bGrouped)
-			{
-				const size_t index = obj_index(subElem) + offset(subRoid,si,fct);
+		UG_ASSERT(vOrientOffset.size() == numDoFsOnSub ||
+		          vOrientOffset.empty(), "Something wrong with orientation");
 
-				if(vOrientOffset.empty()){
-					for(size_t j = 0; j < numDoFsOnSub; ++j)
-						ind.push_back_index(fct, index + j);
-				}else {
-					for(size_t j = 0; j < numDoFsOnSub; ++j)
-						ind.push_back_index(fct, index + vOrientOffset[j]);
-				}
+		if(!m_bGrouped)
+		{
+			const size_t index = obj_index(subElem) + offset(subRoid,si,fct);
+
+			if(vOrientOffset.empty()){
+				for(size_t j = 0; j < numDoFsOnSub; ++j)
+					ind.push_back_index(fct, index + j);
+			}else {
+				for(size_t j = 0; j < numDoFsOnSub; ++j)
+					ind.push_back_index(fct, index + vOrientOffset[j]);
 			}
-			else
-			{
-			//	compute index
-				const size_t index = obj_index(subElem);
-				const size_t comp = offset(subRoid,si,fct);
+		}
+		else
+		{
+		//	compute index
+			const size_t index = obj_index(subElem);
+			const size_t comp = offset(subRoid,si,fct);
 
-				if(vOrientOffset.empty()){
-					for(size_t j = 0; j < numDoFsOnSub; ++j)
-						ind.push_back_multi_index(fct, index, comp + j);
-				}else{
-					for(size_t j = 0; j < numDoFsOnSub; ++j)
-						ind.push_back_multi_index(fct, index, comp + vOrientOffset[j]);
-				}
+			if(vOrientOffset.empty()){
+				for(size_t j = 0; j < numDoFsOnSub; ++j)
+					ind.push_back_multi_index(fct, index, comp + j);
+			}else{
+				for(size_t j = 0; j < numDoFsOnSub; ++j)
+					ind.push_back_multi_index(fct, index, comp + vOrientOffset[j]);
 			}
-		} // end loop functions
+		}
 	} // end loop subelement
 
 }
 
 template <typename TConstraining, typename TConstrained, typename TBaseElem>
 void DoFDistribution::
-constrained_vertex_indices(LocalIndices& ind,
+constrained_vertex_indices(size_t fct, LocalIndices& ind,
                     const typename Grid::traits<TBaseElem>::secure_container& vSubElem) const
 {
 //	loop all edges
@@ -875,29 +886,25 @@ constrained_vertex_indices(LocalIndices& ind,
 		//	get subset index
 			int si = m_spMGSH->get_subset_index(vrt);
 
-		//	loop functions
-			for(size_t fct = 0; fct < num_fct(); ++fct)
-			{
-			//	check that function is defined on subset
-				if(!is_def_in_subset(fct, si)) continue;
+		//	check that function is defined on subset
+			if(!is_def_in_subset(fct, si)) continue;
 
-				if(!m_bGrouped)
-				{
-				//	compute index
-					const size_t index = obj_index(vrt) + offset(subRoid,si,fct);
+			if(!m_bGrouped)
+			{
+			//	compute index
+				const size_t index = obj_index(vrt) + offset(subRoid,si,fct);
 
-				//	add dof to local indices
-					ind.push_back_index(fct, index);
-				}
-				else
-				{
-				//	compute index
-					const size_t index = obj_index(vrt);
-					const size_t comp = offset(subRoid,si,fct);
+			//	add dof to local indices
+				ind.push_back_index(fct, index);
+			}
+			else
+			{
+			//	compute index
+				const size_t index = obj_index(vrt);
+				const size_t comp = offset(subRoid,si,fct);
 
-				//	add dof to local indices
-					ind.push_back_multi_index(fct, index, comp);
-				}
+			//	add dof to local indices
+				ind.push_back_multi_index(fct, index, comp);
 			}
 		}
 	}
@@ -1008,7 +1015,7 @@ sort_constrained_faces(std::vector<size_t>& sortedInd,TBaseElem* elem,TConstrain
 
 template <typename TBaseElem,typename TConstraining, typename TConstrained, typename TSubElem>
 void DoFDistribution::
-constrained_edge_indices(TBaseElem* elem,LocalIndices& ind,
+constrained_edge_indices(TBaseElem* elem,size_t fct,LocalIndices& ind,
                     const typename Grid::traits<TSubElem>::secure_container& vSubElem) const
 {
 	//	loop all edges
@@ -1033,29 +1040,25 @@ constrained_edge_indices(TBaseElem* elem,LocalIndices& ind,
 			//	get subset index
 			int si = m_spMGSH->get_subset_index(edg);
 
-			//	loop functions
-			for(size_t fct = 0; fct < num_fct(); ++fct)
-			{
-			//	check that function is defined on subset
-				if(!is_def_in_subset(fct, si)) continue;
+		//	check that function is defined on subset
+			if(!is_def_in_subset(fct, si)) continue;
 
-				if(!m_bGrouped)
-				{
-				//	compute index
-					const size_t index = obj_index(edg) + offset(subRoid,si,fct);
+			if(!m_bGrouped)
+			{
+			//	compute index
+				const size_t index = obj_index(edg) + offset(subRoid,si,fct);
 
-				//	add dof to local indices
-					ind.push_back_index(fct, index);
-				}
-				else
-				{
-				//	compute index
-					const size_t index = obj_index(edg);
-					const size_t comp = offset(subRoid,si,fct);
+			//	add dof to local indices
+				ind.push_back_index(fct, index);
+			}
+			else
+			{
+			//	compute index
+				const size_t index = obj_index(edg);
+				const size_t comp = offset(subRoid,si,fct);
 
-				//	add dof to local indices
-					ind.push_back_multi_index(fct, index, comp);
-				}
+			//	add dof to local indices
+				ind.push_back_multi_index(fct, index, comp);
 			}
 		}
 	}
@@ -1063,7 +1066,7 @@ constrained_edge_indices(TBaseElem* elem,LocalIndices& ind,
 
 template <typename TBaseElem,typename TConstraining, typename TConstrained, typename TSubElem>
 void DoFDistribution::
-constrained_face_indices(TBaseElem* elem,LocalIndices& ind,
+constrained_face_indices(TBaseElem* elem,size_t fct,LocalIndices& ind,
                     const typename Grid::traits<TSubElem>::secure_container& vSubElem) const
 {
 	//	loop all faces
@@ -1089,29 +1092,25 @@ constrained_face_indices(TBaseElem* elem,LocalIndices& ind,
 			//	get subset index
 			int si = m_spMGSH->get_subset_index(face);
 
-			//	loop functions
-			for(size_t fct = 0; fct < num_fct(); ++fct)
-			{
-			//	check that function is defined on subset
-				if(!is_def_in_subset(fct, si)) continue;
+		//	check that function is defined on subset
+			if(!is_def_in_subset(fct, si)) continue;
 
-				if(!m_bGrouped)
-				{
-				//	compute index
-					const size_t index = obj_index(face) + offset(subRoid,si,fct);
+			if(!m_bGrouped)
+			{
+			//	compute index
+				const size_t index = obj_index(face) + offset(subRoid,si,fct);
 
-				//	add dof to local indices
-					ind.push_back_index(fct, index);
-				}
-				else
-				{
-				//	compute index
-					const size_t index = obj_index(face);
-					const size_t comp = offset(subRoid,si,fct);
+			//	add dof to local indices
+				ind.push_back_index(fct, index);
+			}
+			else
+			{
+			//	compute index
+				const size_t index = obj_index(face);
+				const size_t comp = offset(subRoid,si,fct);
 
-				//	add dof to local indices
-					ind.push_back_multi_index(fct, index, comp);
-				}
+			//	add dof to local indices
+				ind.push_back_multi_index(fct, index, comp);
 			}
 		}
 	}
@@ -1119,13 +1118,29 @@ constrained_face_indices(TBaseElem* elem,LocalIndices& ind,
 
 template<typename TBaseElem>
 void DoFDistribution::_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const
+{
+	if(m_spIndexCache.invalid()){
+		extract_indices<TBaseElem>(elem, ind, bHang);
+		return;
+	}
+
+//	use cached indices if present
+	ind.resize_fct(num_fct());
+	if(m_spIndexCache->get_indices(elem, bHang, ind)) return;
+
+	extract_indices<TBaseElem>(elem, ind, bHang);
+	m_spIndexCache->add_indices(elem, bHang, ind);
+}
+
+template<typename TBaseElem>
+void DoFDistribution::extract_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const
 {
 //	reference dimension
 	static const int dim = TBaseElem::dim;
 
 //	resize the number of functions
+	ind.clear();
 	ind.resize_fct(num_fct());
-	for(size_t fct = 0; fct < num_fct(); ++fct) ind.clear_dof(fct);
 
 //	storage for (maybe needed) subelements
 	Grid::SecureVertexContainer vCorner;
@@ -1146,34 +1161,39 @@ void DoFDistribution::_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) c
 //	get reference object id
 	const ReferenceObjectID roid = elem->reference_object_id();
 
-//	get regular dofs on all subelements and the element itself
-//	use specialized function for vertices (since only one position and one reference object)
-	if(dim >= VERTEX && max_dofs(VERTEX) > 0) indices_on_vertex<TBaseElem>(elem, roid, ind, vCorner);
-	if(dim >= EDGE && max_dofs(EDGE) > 0) 	  indices<TBaseElem, Edge>(elem, roid, ind, vEdge);
-	if(dim >= FACE && max_dofs(FACE) > 0) 	  indices<TBaseElem, Face>(elem, roid, ind, vFace);
-	if(dim >= VOLUME && max_dofs(VOLUME) > 0) indices<TBaseElem, Volume>(elem, roid, ind, vVol);
+//	The indices are collected function by function, so that every index is
+//	appended to the end of the flat storage of the LocalIndices
+	for(size_t fct = 0; fct < num_fct(); ++fct)
+	{
+	//	get regular dofs on all subelements and the element itself
+	//	use specialized function for vertices (since only one position and one reference object)
+		if(dim >= VERTEX && max_dofs(VERTEX) > 0) indices_on_vertex<TBaseElem>(elem, roid, fct, ind, vCorner);
+		if(dim >= EDGE && max_dofs(EDGE) > 0) 	  indices<TBaseElem, Edge>(elem, roid, fct, ind, vEdge);
+		if(dim >= FACE && max_dofs(FACE) > 0) 	  indices<TBaseElem, Face>(elem, roid, fct, ind, vFace);
+		if(dim >= VOLUME && max_dofs(VOLUME) > 0) indices<TBaseElem, Volume>(elem, roid, fct, ind, vVol);
 
-//	If no hanging dofs are required, we're done
-	if(!bHang) return;
+	//	If no hanging dofs are required, we're done with this function
+		if(!bHang) continue;
 
-//	get dofs on hanging vertices
-	if (max_dofs(VERTEX) > 0)
-	{
-		if(dim >= EDGE) constrained_vertex_indices<ConstrainingEdge, Vertex, Edge>(ind, vEdge);
-		if(dim >= FACE) constrained_vertex_indices<ConstrainingQuadrilateral, Vertex, Face>(ind, vFace);
-	}
+	//	get dofs on hanging vertices
+		if (max_dofs(VERTEX) > 0)
+		{
+			if(dim >= EDGE) constrained_vertex_indices<ConstrainingEdge, Vertex, Edge>(fct, ind, vEdge);
+			if(dim >= FACE) constrained_vertex_indices<ConstrainingQuadrilateral, Vertex, Face>(fct, ind, vFace);
+		}
 
-//	get dofs on hanging edges
-	if (max_dofs(EDGE) > 0){
-		if(dim >= EDGE) constrained_edge_indices<TBaseElem,ConstrainingEdge, Edge, Edge>(elem,ind, vEdge);
-		if(dim >= FACE) constrained_edge_indices<TBaseElem,ConstrainingTriangle, Edge, Face>(elem,ind, vFace);
-		if(dim >= FACE) constrained_edge_indices<TBaseElem,ConstrainingQuadrilateral, Edge, Face>(elem,ind, vFace);
-	}
+	//	get dofs on hanging edges
+		if (max_dofs(EDGE) > 0){
+			if(dim >= EDGE) constrained_edge_indices<TBaseElem,ConstrainingEdge, Edge, Edge>(elem,fct,ind, vEdge);
+			if(dim >= FACE) constrained_edge_indices<TBaseElem,ConstrainingTriangle, Edge, Face>(elem,fct,ind, vFace);
+			if(dim >= FACE) constrained_edge_indices<TBaseElem,ConstrainingQuadrilateral, Edge, Face>(elem,fct,ind, vFace);
+		}
 
-//  get dofs on hanging faces
-	if (max_dofs(FACE) > 0){
-		if(dim >= FACE) constrained_face_indices<TBaseElem,ConstrainingTriangle, Face, Face>(elem,ind, vFace);
-		if(dim >= FACE) constrained_face_indices<TBaseElem,ConstrainingQuadrilateral, Face, Face>(elem,ind, vFace);
+	//  get dofs on hanging faces
+		if (max_dofs(FACE) > 0){
+			if(dim >= FACE) constrained_face_indices<TBaseElem,ConstrainingTriangle, Face, Face>(elem,fct,ind, vFace);
+			if(dim >= FACE) constrained_face_indices<TBaseElem,ConstrainingQuadrilateral, Face, Face>(elem,fct,ind, vFace);
+		}
 	}
 
 //	we're done
@@ -1444,6 +1464,16 @@ void DoFDistribution::reinit()
 #ifdef UG_PARALLEL
 	reinit_layouts_and_communicator();
 #endif
+
+//	indices have changed
+	if(m_spIndexCache.valid()) m_spIndexCache->clear();
+	++m_revision;
+}
+
+void DoFDistribution::set_index_cache(size_t maxMemory)
+{
+	if(maxMemory == 0) m_spIndexCache = SPNULL;
+	else m_spIndexCache = SmartPtr<DoFIndexCache>(new DoFIndexCache(*m_pMG, maxMemory));
 }
 
 
@@ -1473,6 +1503,7 @@ void DoFDistribution::reinit_layouts_and_communicator()
 
 	reinit_index_layout(layouts()->master(), INT_H_MASTER);
 	reinit_index_layout(layouts()->slave(), INT_H_SLAVE);
+	layouts()->layouts_changed();
 	reinit_index_layout(layouts()->vertical_slave(), INT_V_SLAVE);
 
 //	vertical layouts for ghosts
@@ -1765,6 +1796,10 @@ void DoFDistribution::permute_indices(const std::vector<size_t>& vNewInd)
 	reinit_layouts_and_communicator();
 #endif
 
+//	indices have changed
+	if(m_spIndexCache.valid()) m_spIndexCache->clear();
+	++m_revision;
+
 //	permute indices in associated vectors
 	permute_values(vNewInd);
 }
@@ -37,7 +37,9 @@
 #include "lib_disc/domain_traits.h"
 #include "lib_disc/common/local_algebra.h"
 #include "dof_index_storage.h"
+#include "dof_index_cache.h"
 #include "dof_count.h"
+#include "lib_disc/common/revision_counter.h"
 
 #ifdef UG_PARALLEL
 #include "lib_algebra/parallelization/algebra_layouts.h"
@@ -220,6 +222,29 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		/// return the number of dofs distributed on subset si
 		size_t num_indices(int si) const {return m_vNumIndexOnSubset[si];}
 
+	///	returns the revision of the index distribution
+	/**
+	 * The revision is increased whenever the indices are renumbered or
+	 * redistributed (reinit, permute_indices). Structures depending on the
+	 * indices (e.g. cached matrix sparsity patterns) can compare against
+	 * this state to detect if they are outdated.
+	 */
+		const RevisionCounter& revision() const {return m_revision;}
+
+	///	enables caching of the index lists of elements
+	/**
+	 * The index lists extracted by indices() and algebra_indices() are
+	 * stored per element up to the given number of bytes and reused on
+	 * subsequent calls. The cache is cleared whenever the indices are
+	 * redistributed or the grid is changed.
+	 *
+	 * \param[in]	maxMemory	memory budget in bytes (0 disables the cache)
+	 */
+		void set_index_cache(size_t maxMemory);
+
+	///	returns the index cache (invalid if caching is disabled)
+		ConstSmartPtr<DoFIndexCache> index_cache() const {return m_spIndexCache;}
+
 	public:
 		/// extracts all indices of the element (sorted)
 		/**
@@ -354,6 +379,9 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		template <typename TBaseElem>
 		void _indices(TBaseElem* elem, LocalIndices& ind, bool bHang = false) const;
 
+		template <typename TBaseElem>
+		void extract_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const;
+
 		template<typename TBaseElem>
 		size_t _dof_indices(TBaseElem* elem, size_t fct,
 		                     std::vector<DoFIndex>& ind,
@@ -368,6 +396,9 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		size_t _algebra_indices(TBaseElem* elem,	std::vector<size_t>& ind,
 		                       bool bClear = true) const;
 
+		template<typename TBaseElem>
+		void extract_algebra_indices(TBaseElem* elem, std::vector<size_t>& ind) const;
+
 		template<typename TBaseElem>
 		size_t _inner_algebra_indices(TBaseElem* elem, std::vector<size_t>& ind,
 		                             bool bClear = true) const;
@@ -380,20 +411,20 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		///	extracts the indices of the vertices
 		template<typename TBaseElem>
 		void indices_on_vertex(TBaseElem* elem, const ReferenceObjectID roid,
-		                       LocalIndices& ind,
+		                       size_t fct, LocalIndices& ind,
 		                       const Grid::SecureVertexContainer& vElem) const;
 
 		///	extract dofs on constrained objects
 		template <typename TConstraining, typename TConstrained, typename TBaseElem>
-		void constrained_vertex_indices(LocalIndices& ind,
+		void constrained_vertex_indices(size_t fct, LocalIndices& ind,
 		                         const typename Grid::traits<TBaseElem>::secure_container& vSubElem) const;
 
 		template <typename TBaseElem,typename TConstraining, typename TConstrained, typename TSubElem>
-		void constrained_edge_indices(TBaseElem* elem,LocalIndices& ind,
+		void constrained_edge_indices(TBaseElem* elem,size_t fct,LocalIndices& ind,
 		                         const typename Grid::traits<TSubElem>::secure_container& vSubElem) const;
 
 		template <typename TBaseElem,typename TConstraining, typename TConstrained, typename TSubElem>
-		void constrained_face_indices(TBaseElem* elem,LocalIndices& ind,
+		void constrained_face_indices(TBaseElem* elem,size_t fct,LocalIndices& ind,
 		                         const typename Grid::traits<TSubElem>::secure_container& vSubElem) const;
 
 		// sorts indices on constrained edges
@@ -407,7 +438,7 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		/// extracts the indices of the subelement of an element
 		template<typename TBaseElem, typename TSubBaseElem>
 		void indices(TBaseElem* elem, const ReferenceObjectID roid,
-		             LocalIndices& ind,
+		             size_t fct, LocalIndices& ind,
 		             const typename Grid::traits<TSubBaseElem>::secure_container& vElem) const;
 
 		/// extracts the indices of a subelement of an element
@@ -485,6 +516,12 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		/// number of distributed indices on each subset
 		std::vector<size_t> m_vNumIndexOnSubset;
 
+	///	revision of the index distribution
+		RevisionCounter m_revision;
+
+	///	cache for element index lists (filled on demand, thus mutable)
+		mutable SmartPtr<DoFIndexCache> m_spIndexCache;
+
 	public:
 		/// returns the connections
 		void get_connections(std::vector<std::vector<size_t> >& vvConnection) const;
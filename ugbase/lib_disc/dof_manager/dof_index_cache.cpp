@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "dof_index_cache.h"
+
+namespace ug{
+
+const size_t DoFIndexCache::NOT_CACHED;
+
+DoFIndexCache::
+DoFIndexCache(MultiGrid& mg, size_t maxMemory)
+:	m_pMG(&mg),
+ 	m_maxMemory(maxMemory)
+{
+	mg.register_observer(this, OT_GRID_OBSERVER | OT_VERTEX_OBSERVER | OT_EDGE_OBSERVER |
+							   OT_FACE_OBSERVER | OT_VOLUME_OBSERVER);
+	mg.attach_to_all_dv(m_aSlot, NOT_CACHED);
+	m_aaSlot.access(mg, m_aSlot);
+}
+
+DoFIndexCache::
+~DoFIndexCache()
+{
+	release();
+}
+
+void DoFIndexCache::release()
+{
+	clear();
+	if(m_pMG){
+		m_pMG->detach_from_all(m_aSlot);
+		m_pMG->unregister_observer(this);
+		m_aaSlot.invalidate();
+		m_pMG = NULL;
+	}
+}
+
+void DoFIndexCache::clear()
+{
+	m_vSlotElem.clear();
+	for(size_t i = 0; i < NUM_LISTS; ++i){
+		m_vFirst[i].clear();
+		m_vOffset[i].clear();
+	}
+	m_vDoFIndex[0].clear();
+	m_vDoFIndex[1].clear();
+	m_vAlgebraIndex.clear();
+}
+
+size_t DoFIndexCache::memory() const
+{
+	size_t mem = m_vSlotElem.size() * sizeof(GridObject*);
+	for(size_t i = 0; i < NUM_LISTS; ++i){
+		mem += m_vFirst[i].size() * sizeof(size_t);
+		mem += m_vOffset[i].size() * sizeof(size_t);
+	}
+	mem += (m_vDoFIndex[0].size() + m_vDoFIndex[1].size()) * sizeof(DoFIndex);
+	mem += m_vAlgebraIndex.size() * sizeof(size_t);
+	return mem;
+}
+
+size_t DoFIndexCache::slot(GridObject* elem) const
+{
+	if(!m_pMG) return NOT_CACHED;
+	const size_t s = m_aaSlot[elem];
+	if(s < m_vSlotElem.size() && m_vSlotElem[s] == elem)
+		return s;
+	return NOT_CACHED;
+}
+
+size_t DoFIndexCache::acquire_slot(GridObject* elem)
+{
+	size_t s = slot(elem);
+	if(s != NOT_CACHED) return s;
+
+	s = m_vSlotElem.size();
+	m_vSlotElem.push_back(elem);
+	for(size_t i = 0; i < NUM_LISTS; ++i)
+		m_vFirst[i].push_back(NOT_CACHED);
+	m_aaSlot[elem] = s;
+	return s;
+}
+
+bool DoFIndexCache::
+get_indices(GridObject* elem, bool bHang, LocalIndices& ind) const
+{
+	const size_t s = slot(elem);
+	if(s == NOT_CACHED) return false;
+
+	const int list = bHang ? LIST_INDICES_HANGING : LIST_INDICES;
+	const size_t first = m_vFirst[list][s];
+	if(first == NOT_CACHED) return false;
+
+	UG_ASSERT(first + ind.num_fct() < m_vOffset[list].size(),
+			  "Number of functions does not match cached indices.");
+	const std::vector<DoFIndex>& vDoFIndex = m_vDoFIndex[list];
+	ind.assign_dofs(&m_vOffset[list][first], vDoFIndex.empty() ? NULL : &vDoFIndex.front());
+	return true;
+}
+
+void DoFIndexCache::
+add_indices(GridObject* elem, bool bHang, const LocalIndices& ind)
+{
+	if(!m_pMG) return;
+
+//	check the memory budget (a new slot needs an element pointer and one entry per list)
+	const size_t numFct = ind.num_fct();
+	const size_t required = ind.num_dof() * sizeof(DoFIndex)
+							+ (numFct + 1) * sizeof(size_t)
+							+ sizeof(GridObject*) + NUM_LISTS * sizeof(size_t);
+	if(memory() + required > m_maxMemory) return;
+
+	const int list = bHang ? LIST_INDICES_HANGING : LIST_INDICES;
+	const size_t s = acquire_slot(elem);
+	if(m_vFirst[list][s] != NOT_CACHED) return;
+
+	std::vector<size_t>& vOffset = m_vOffset[list];
+	std::vector<DoFIndex>& vDoFIndex = m_vDoFIndex[list];
+
+	m_vFirst[list][s] = vOffset.size();
+	for(size_t fct = 0; fct < numFct; ++fct){
+		vOffset.push_back(vDoFIndex.size());
+		for(size_t dof = 0; dof < ind.num_dof(fct); ++dof)
+			vDoFIndex.push_back(ind.multi_index(fct, dof));
+	}
+	vOffset.push_back(vDoFIndex.size());
+}
+
+bool DoFIndexCache::
+get_algebra_indices(GridObject* elem, std::vector<size_t>& ind) const
+{
+	const size_t s = slot(elem);
+	if(s == NOT_CACHED) return false;
+
+	const size_t first = m_vFirst[LIST_ALGEBRA][s];
+	if(first == NOT_CACHED) return false;
+
+	const std::vector<size_t>& vOffset = m_vOffset[LIST_ALGEBRA];
+	ind.insert(ind.end(), m_vAlgebraIndex.begin() + vOffset[first],
+			   m_vAlgebraIndex.begin() + vOffset[first + 1]);
+	return true;
+}
+
+void DoFIndexCache::
+add_algebra_indices(GridObject* elem, const size_t* pInd, size_t num)
+{
+	if(!m_pMG) return;
+
+	const size_t required = (num + 2) * sizeof(size_t)
+							+ sizeof(GridObject*) + NUM_LISTS * sizeof(size_t);
+	if(memory() + required > m_maxMemory) return;
+
+	const size_t s = acquire_slot(elem);
+	if(m_vFirst[LIST_ALGEBRA][s] != NOT_CACHED) return;
+
+	std::vector<size_t>& vOffset = m_vOffset[LIST_ALGEBRA];
+	m_vFirst[LIST_ALGEBRA][s] = vOffset.size();
+	vOffset.push_back(m_vAlgebraIndex.size());
+	m_vAlgebraIndex.insert(m_vAlgebraIndex.end(), pInd, pInd + num);
+	vOffset.push_back(m_vAlgebraIndex.size());
+}
+
+void DoFIndexCache::grid_to_be_destroyed(Grid* grid)
+{
+	release();
+}
+
+void DoFIndexCache::elements_to_be_cleared(Grid* grid)
+{
+	clear();
+}
+
+void DoFIndexCache::
+vertex_created(Grid* grid, Vertex* vrt, GridObject* pParent, bool replacesParent)
+{
+	clear();
+}
+
+void DoFIndexCache::
+edge_created(Grid* grid, Edge* e, GridObject* pParent, bool replacesParent)
+{
+	clear();
+}
+
+void DoFIndexCache::
+face_created(Grid* grid, Face* f, GridObject* pParent, bool replacesParent)
+{
+	clear();
+}
+
+void DoFIndexCache::
+volume_created(Grid* grid, Volume* vol, GridObject* pParent, bool replacesParent)
+{
+	clear();
+}
+
+void DoFIndexCache::
+vertex_to_be_erased(Grid* grid, Vertex* vrt, Vertex* replacedBy)
+{
+	clear();
+}
+
+void DoFIndexCache::
+edge_to_be_erased(Grid* grid, Edge* e, Edge* replacedBy)
+{
+	clear();
+}
+
+void DoFIndexCache::
+face_to_be_erased(Grid* grid, Face* f, Face* replacedBy)
+{
+	clear();
+}
+
+void DoFIndexCache::
+volume_to_be_erased(Grid* grid, Volume* vol, Volume* replacedBy)
+{
+	clear();
+}
+
+} // end namespace ug
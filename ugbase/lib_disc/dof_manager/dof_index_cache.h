@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__DOF_MANAGER__DOF_INDEX_CACHE__
+#define __H__UG__LIB_DISC__DOF_MANAGER__DOF_INDEX_CACHE__
+
+#include <vector>
+#include "lib_grid/multi_grid.h"
+#include "lib_grid/algorithms/attachment_util.h"
+#include "lib_disc/common/local_algebra.h"
+
+namespace ug{
+
+///	Caches the flattened index lists of grid elements
+/**
+ * Extracting the indices of an element requires to collect all sub-elements
+ * and (for hanging nodes) the constrained objects of the element. The cache
+ * stores the result of such an extraction in contiguous arrays, so that
+ * subsequent requests for the same element only copy the stored list.
+ *
+ * Each cached element is assigned a slot via an attachment. The index lists
+ * of all elements are stored consecutively, no memory is allocated per
+ * element. If the memory used by the index lists would exceed the given
+ * budget, further elements are not cached.
+ *
+ * The cache observes the grid and is cleared whenever elements are created
+ * or erased (refinement, coarsening, redistribution). The owner of the cache
+ * has to call clear() whenever the indices are changed.
+ *
+ * The cache is filled lazily by const index queries and is not synchronized,
+ * i.e. it must not be accessed from several threads at once.
+ */
+class DoFIndexCache : public GridObserver
+{
+	public:
+	///	constructor
+	/**
+	 * \param[in]	mg			grid containing the elements
+	 * \param[in]	maxMemory	maximal number of bytes used for index lists
+	 */
+		DoFIndexCache(MultiGrid& mg, size_t maxMemory);
+
+	///	destructor
+		virtual ~DoFIndexCache();
+
+	///	removes all cached index lists
+		void clear();
+
+	///	returns the number of bytes used for the cached index lists
+		size_t memory() const;
+
+	///	returns the maximal number of bytes used for the cached index lists
+		size_t max_memory() const {return m_maxMemory;}
+
+	///	returns the number of cached elements
+		size_t num_cached() const {return m_vSlotElem.size();}
+
+	///	writes the cached local indices of an element
+	/**
+	 * The number of functions in ind must already be set. Returns false, if
+	 * no local indices are cached for the element.
+	 */
+		bool get_indices(GridObject* elem, bool bHang, LocalIndices& ind) const;
+
+	///	stores the local indices of an element
+		void add_indices(GridObject* elem, bool bHang, const LocalIndices& ind);
+
+	///	appends the cached algebra indices of an element
+	/**
+	 * Returns false, if no algebra indices are cached for the element.
+	 */
+		bool get_algebra_indices(GridObject* elem, std::vector<size_t>& ind) const;
+
+	///	stores the algebra indices of an element
+		void add_algebra_indices(GridObject* elem, const size_t* pInd, size_t num);
+
+	public:
+	///	grid observer callbacks
+	///	\{
+		virtual void grid_to_be_destroyed(Grid* grid);
+		virtual void elements_to_be_cleared(Grid* grid);
+
+		virtual void vertex_created(Grid* grid, Vertex* vrt, GridObject* pParent = NULL,
+									bool replacesParent = false);
+		virtual void edge_created(Grid* grid, Edge* e, GridObject* pParent = NULL,
+								  bool replacesParent = false);
+		virtual void face_created(Grid* grid, Face* f, GridObject* pParent = NULL,
+								  bool replacesParent = false);
+		virtual void volume_created(Grid* grid, Volume* vol, GridObject* pParent = NULL,
+									bool replacesParent = false);
+
+		virtual void vertex_to_be_erased(Grid* grid, Vertex* vrt, Vertex* replacedBy = NULL);
+		virtual void edge_to_be_erased(Grid* grid, Edge* e, Edge* replacedBy = NULL);
+		virtual void face_to_be_erased(Grid* grid, Face* f, Face* replacedBy = NULL);
+		virtual void volume_to_be_erased(Grid* grid, Volume* vol, Volume* replacedBy = NULL);
+	///	\}
+
+	protected:
+	///	returns the slot of an element or NOT_CACHED
+		size_t slot(GridObject* elem) const;
+
+	///	returns the slot of an element, a new slot is assigned if needed
+		size_t acquire_slot(GridObject* elem);
+
+	///	detaches from the grid
+		void release();
+
+	protected:
+	///	index lists stored per element
+		enum{LIST_INDICES = 0, LIST_INDICES_HANGING = 1, LIST_ALGEBRA = 2, NUM_LISTS = 3};
+
+	///	marks a missing entry
+		static const size_t NOT_CACHED = (size_t)-1;
+
+	///	underlying grid
+		MultiGrid* m_pMG;
+
+	///	memory budget in bytes
+		size_t m_maxMemory;
+
+	///	slot of an element
+		typedef Attachment<size_t> ASlot;
+		ASlot m_aSlot;
+		MultiElementAttachmentAccessor<ASlot> m_aaSlot;
+
+	///	element assigned to a slot (used to detect stale slot entries)
+		std::vector<GridObject*> m_vSlotElem;
+
+	///	position of the first offset of an element in m_vOffset (per slot)
+		std::vector<size_t> m_vFirst[NUM_LISTS];
+
+	///	offsets into the index arrays
+	/**
+	 * For local indices, num_fct()+1 offsets into m_vDoFIndex are stored per
+	 * element, for algebra indices two offsets into m_vAlgebraIndex.
+	 */
+		std::vector<size_t> m_vOffset[NUM_LISTS];
+
+	///	flattened local indices (without and with hanging dofs)
+		std::vector<DoFIndex> m_vDoFIndex[2];
+
+	///	flattened algebra indices
+		std::vector<size_t> m_vAlgebraIndex;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__DOF_MANAGER__DOF_INDEX_CACHE__ */
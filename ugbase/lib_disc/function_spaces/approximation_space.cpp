@@ -83,6 +83,7 @@ init(SmartPtr<subset_handler_type> spMGSH,
 	m_spDoFDistributionInfo = SmartPtr<DoFDistributionInfo>(new DoFDistributionInfo(spMGSH));
 	m_algebraType = algebraType;
 	m_bAdaptionIsActive = false;
+	m_indexCacheMemory = 0;
 	m_RevCnt = RevisionCounter(this);
 
 	this->set_dof_distribution_info(m_spDoFDistributionInfo);
@@ -282,6 +283,13 @@ IApproximationSpace::dof_distributions() const
 	return m_vDD;
 }
 
+void IApproximationSpace::set_dof_index_cache(size_t maxMemory)
+{
+	m_indexCacheMemory = maxMemory;
+	for(size_t i = 0; i < m_vDD.size(); ++i)
+		m_vDD[i]->set_index_cache(maxMemory);
+}
+
 
 void IApproximationSpace::init_levels()
 {
@@ -342,6 +350,8 @@ void IApproximationSpace::create_dof_distribution(const GridLevel& gl)
 	SmartPtr<DoFDistribution> spDD = SmartPtr<DoFDistribution>(new
 		DoFDistribution(m_spMG, m_spMGSH, m_spDoFDistributionInfo,
 						m_spSurfaceView, gl, m_bGrouped, spIndexStrg));
+	if(m_indexCacheMemory > 0)
+		spDD->set_index_cache(m_indexCacheMemory);
 
 //	add to list and sort
 	m_vDD.push_back(spDD);
@@ -182,6 +182,13 @@ class IApproximationSpace : public DoFDistributionInfoProvider
 	///	returns all currently created dof distributions
 		std::vector<SmartPtr<DoFDistribution> > dof_distributions() const;
 
+	///	enables caching of element index lists in all dof distributions
+	/**
+	 * \param[in]	maxMemory	memory budget in bytes per dof distribution
+	 * 							(0 disables the cache)
+	 */
+		void set_dof_index_cache(size_t maxMemory);
+
 	///	returns dof distribution info
 	/// \{
 		ConstSmartPtr<DoFDistributionInfo> ddinfo() const {return m_spDoFDistributionInfo;}
@@ -256,6 +263,9 @@ class IApproximationSpace : public DoFDistributionInfoProvider
 	///	flag if DoFs should be grouped
 		bool m_bGrouped;
 
+	///	memory budget for the index cache of dof distributions (0 = disabled)
+		size_t m_indexCacheMemory;
+
 	///	DofDistributionInfo
 		SmartPtr<DoFDistributionInfo> m_spDoFDistributionInfo;
 
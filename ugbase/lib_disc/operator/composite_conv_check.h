@@ -131,6 +131,7 @@ class CompositeConvCheck : public IConvergenceCheck<TVector>
 		void start(const TVector& d);
 		void update_defect(number newDefect);
 		void update(const TVector& d);
+		void correct(const TVector& d);
 		bool iteration_ended();
 		bool post();
 
@@ -188,8 +189,8 @@ class CompositeConvCheck : public IConvergenceCheck<TVector>
 	///	extracts multi-indices from dof distribution
 		void extract_dof_indices(ConstSmartPtr<DoFDistribution> dd);
 
-	/// calculates the 2-norm of the entries of the vector vec specified by index
-		number norm(const TVector& vec, const std::vector<DoFIndex>& index);
+	/// calculates the 2-norms of all native components of vec with one global reduction
+		void native_norms(const TVector& vec, std::vector<number>& vNorm);
 
 	protected:
 	///	ApproxSpace
@@ -149,49 +149,61 @@ extract_dof_indices(ConstSmartPtr<DoFDistribution> dd)
 
 
 template <class TVector, class TDomain>
-number CompositeConvCheck<TVector, TDomain>::
-norm(const TVector& vec, const std::vector<DoFIndex>& vMultiIndex)
+void CompositeConvCheck<TVector, TDomain>::
+native_norms(const TVector& vec, std::vector<number>& vNorm)
 {
 #ifdef UG_PARALLEL
 
 	// 	make vector d additive unique
 	if (!const_cast<TVector*>(&vec)->change_storage_type(PST_UNIQUE))
-		UG_THROW("CompositeConvCheck::norm(): Cannot change ParallelStorageType to unique.");
+		UG_THROW("CompositeConvCheck::native_norms(): Cannot change ParallelStorageType to unique.");
 #endif
 
-	double norm = 0.0;
-	size_t sz = vMultiIndex.size();
-	for (size_t dof = 0; dof < sz; ++dof)
+	// squared local norms of all components
+	std::vector<double> vNorm2(m_vNativCmpInfo.size(), 0.0);
+	for (size_t fct = 0; fct < m_vNativCmpInfo.size(); ++fct)
 	{
-		const number val = DoFRef(vec, vMultiIndex[dof]);
-		norm += (double) (val*val);
+		const std::vector<DoFIndex>& vMultiIndex = m_vNativCmpInfo[fct].vMultiIndex;
+		double norm = 0.0;
+		size_t sz = vMultiIndex.size();
+		for (size_t dof = 0; dof < sz; ++dof)
+		{
+			const number val = DoFRef(vec, vMultiIndex[dof]);
+			norm += (double) (val*val);
+		}
+		vNorm2[fct] = norm;
 	}
 
 #ifdef UG_PARALLEL
-	// sum squared local norms
-	//if (!vec.layouts()->proc_comm().empty())
-	//norm = vec.layouts()->proc_comm().allreduce(norm, PCL_RO_SUM);
+	// sum squared local norms of all components at once
 
-	// In the lines above,
+	// Using the process communicator of the vector here,
 	// racing conditions occur in cases where a process has no elements,
 	// since the defect would be 0 for them then and iteration_ended() would return true;
 	// ergo: the empty processors would wait at the next global communication involving them
 	// while non-empty processors might encounter a different communication event before.
 	// This results in error messages like MPI ERROR: MPI_ERR_TRUNCATE: message truncated.
 
-	// The lines below, however, result in Bi-CGSTAB going down in the first step with
-	// "minOrthogonality failed" in settings with empty processes as they will compute
-	// a zero (local) dot_product r*r0, but with (global) r=r0 != 0.
-	// Therefore switching to old alternative here. MPI_ERR_TRUNCATE should be prevented
+	// Restricting to the process communicator, however, results in Bi-CGSTAB going down in
+	// the first step with "minOrthogonality failed" in settings with empty processes as
+	// they will compute a zero (local) dot_product r*r0, but with (global) r=r0 != 0.
+	// Therefore the world communicator is used. MPI_ERR_TRUNCATE should be prevented
 	// by not communicating globally, but only with the processes that really need to be
 	// involved (i.e. NO empty processes), if possible.
 
-	pcl::ProcessCommunicator commWorld;
-	norm = commWorld.allreduce(norm, PCL_RO_SUM);
+	if (!vNorm2.empty())
+	{
+		std::vector<double> vLocal(vNorm2);
+		pcl::ProcessCommunicator commWorld;
+		commWorld.allreduce(&vLocal[0], &vNorm2[0], (int)vLocal.size(),
+		                    PCL_DT_DOUBLE, PCL_RO_SUM);
+	}
 #endif
 
-	// return global norm
-	return sqrt((number) norm);
+	// return global norms
+	vNorm.resize(vNorm2.size());
+	for (size_t fct = 0; fct < vNorm2.size(); ++fct)
+		vNorm[fct] = sqrt((number) vNorm2[fct]);
 }
 
 
@@ -444,8 +456,10 @@ void CompositeConvCheck<TVector, TDomain>::start(const TVector& vec)
 	if (m_bTimeMeas)	m_stopwatch.start();
 
 	// update native defects
+	std::vector<number> vNorm;
+	native_norms(vec, vNorm);
 	for (size_t fct = 0; fct < m_vNativCmpInfo.size(); fct++){
-		m_vNativCmpInfo[fct].initDefect = norm(vec, m_vNativCmpInfo[fct].vMultiIndex);
+		m_vNativCmpInfo[fct].initDefect = vNorm[fct];
 		m_vNativCmpInfo[fct].currDefect = m_vNativCmpInfo[fct].initDefect;
 	}
 
@@ -545,9 +559,11 @@ void CompositeConvCheck<TVector, TDomain>::update(const TVector& vec)
 	}
 
 	// update native defects
+	std::vector<number> vNorm;
+	native_norms(vec, vNorm);
 	for (size_t fct = 0; fct < m_vNativCmpInfo.size(); fct++){
 		m_vNativCmpInfo[fct].lastDefect = m_vNativCmpInfo[fct].currDefect;
-		m_vNativCmpInfo[fct].currDefect = norm(vec, m_vNativCmpInfo[fct].vMultiIndex);
+		m_vNativCmpInfo[fct].currDefect = vNorm[fct];
 	}
 
 	// update grouped defects
@@ -593,6 +609,36 @@ void CompositeConvCheck<TVector, TDomain>::update(const TVector& vec)
 }
 
 
+template <class TVector, class TDomain>
+void CompositeConvCheck<TVector, TDomain>::correct(const TVector& vec)
+{
+	// assert correct number of dofs
+	if (vec.size() * MyVectorTraits<TVector>::block_size != m_numAllDoFs)
+	{
+		UG_THROW("Number of dofs in CompositeConvCheck does not match"
+				 "number of dofs given in vector from algorithm (" << m_numAllDoFs <<
+				 ", but " << vec.size() << " given). \nMake sure that you set the "
+				"right grid level via set_level().");
+	}
+
+	// replace native defects
+	std::vector<number> vNorm;
+	native_norms(vec, vNorm);
+	for (size_t fct = 0; fct < m_vNativCmpInfo.size(); fct++)
+		m_vNativCmpInfo[fct].currDefect = vNorm[fct];
+
+	// replace grouped defects
+	for (size_t cmp = 0; cmp < m_CmpInfo.size(); cmp++){
+		CmpInfo& cmpInfo = m_CmpInfo[cmp];
+
+		cmpInfo.currDefect = 0.0;
+		for(size_t i = 0; i < cmpInfo.vFct.size(); ++i)
+			cmpInfo.currDefect += pow(m_vNativCmpInfo[cmpInfo.vFct[i]].currDefect, 2);
+		cmpInfo.currDefect = sqrt(cmpInfo.currDefect);
+	}
+}
+
+
 template <class TVector, class TDomain>
 bool CompositeConvCheck<TVector, TDomain>::iteration_ended()
 {
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__
+
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_disc/spatial_disc/domain_disc.h"
+
+namespace ug{
+
+///	linear operator applying the jacobian of a domain discretization matrix-free
+/**
+ * This operator computes d = J(u)*c element by element using the element
+ * discretizations (and their DataEvaluator) of a DomainDiscretization,
+ * without building the global jacobian. It implements the MatrixOperator
+ * interface, but the matrix only holds the diagonal of the jacobian. Thus,
+ * preconditioners that need the diagonal only (e.g. Jacobi) can be used
+ * unchanged, while all other ones would only see the diagonal part.
+ *
+ * Invoking init(u) stores a copy of the linearization point u and assembles
+ * the diagonal. Only dirichlet constraints are supported.
+ *
+ * \tparam	TDomain				domain type
+ * \tparam	TAlgebra			algebra type
+ */
+template <typename TDomain, typename TAlgebra>
+class MatrixFreeOperator :
+	public virtual MatrixOperator<	typename TAlgebra::matrix_type,
+									typename TAlgebra::vector_type>
+{
+	public:
+	///	Type of Algebra
+		typedef TAlgebra algebra_type;
+
+	///	Type of Vector
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Type of Matrix
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Type of domain discretization
+		typedef DomainDiscretization<TDomain, TAlgebra> domain_disc_type;
+
+	public:
+	///	Constructor
+		MatrixFreeOperator(SmartPtr<IAssemble<TAlgebra> > ass, const GridLevel& gl)
+			: m_spAss(ass), m_gridLevel(gl), m_bForceRegularGrid(false)
+		{
+			m_pDomDisc = dynamic_cast<domain_disc_type*>(ass.get());
+			if(m_pDomDisc == NULL)
+				UG_THROW("MatrixFreeOperator: Discretization must be a"
+						" DomainDiscretization for matrix-free application.");
+		}
+
+	///	sets if the regular grid assembling is forced
+		void set_force_regular_grid(bool bForce) {m_bForceRegularGrid = bForce;}
+
+	///	returns the level
+		const GridLevel& level() const {return m_gridLevel;}
+
+	///	stores the linearization point and assembles the diagonal
+		virtual void init(const vector_type& u)
+		{
+			PROFILE_FUNC_GROUP("discretization");
+			m_spU = u.clone();
+			m_spTmp = u.clone_without_values();
+
+			set_tuner();
+			try{
+				m_pDomDisc->assemble_jacobian_diagonal(*this, *m_spU, m_gridLevel);
+			}
+			catch(UGError& err){
+				reset_tuner();
+				err.push_msg("MatrixFreeOperator::init: Cannot assemble diagonal.",
+				             __FILE__, __LINE__);
+				throw;
+			}
+			catch(const std::exception& ex){
+				reset_tuner();
+				throw UGError("MatrixFreeOperator::init: Cannot assemble diagonal.",
+				              ex, __FILE__, __LINE__);
+			}
+			reset_tuner();
+		}
+
+	///	initialize the operator (linear case, linearized at zero)
+		virtual void init()
+		{
+			UG_THROW("MatrixFreeOperator: Needs a linearization point, use init(u).");
+		}
+
+	///	compute d = J(u)*c
+		virtual void apply(vector_type& d, const vector_type& c)
+		{
+			PROFILE_FUNC_GROUP("discretization");
+			UG_COND_THROW(m_spU.invalid(), "MatrixFreeOperator::apply: Not initialized.");
+
+		//	the element loop needs a consistent vector
+			const vector_type* pC = &c;
+			#ifdef UG_PARALLEL
+			if(!c.has_storage_type(PST_CONSISTENT)){
+				if(m_spX.invalid()) m_spX = c.clone_without_values();
+				*m_spX = c;
+				m_spX->change_storage_type(PST_CONSISTENT);
+				pC = m_spX.get();
+			}
+			#endif
+
+			set_tuner();
+			try{
+				m_pDomDisc->apply_jacobian(d, *pC, *m_spU, m_gridLevel);
+			}
+			catch(UGError& err){
+				reset_tuner();
+				err.push_msg("MatrixFreeOperator::apply: Cannot apply jacobian.",
+				             __FILE__, __LINE__);
+				throw;
+			}
+			catch(const std::exception& ex){
+				reset_tuner();
+				throw UGError("MatrixFreeOperator::apply: Cannot apply jacobian.",
+				              ex, __FILE__, __LINE__);
+			}
+			reset_tuner();
+		}
+
+	///	Compute d := d - J(u)*c
+		virtual void apply_sub(vector_type& d, const vector_type& c)
+		{
+			apply(*m_spTmp, c);
+			d -= *m_spTmp;
+		}
+
+	///	Destructor
+		virtual ~MatrixFreeOperator() {};
+
+	protected:
+		void set_tuner()
+		{
+			if(m_bForceRegularGrid)
+				m_spAss->ass_tuner()->set_force_regular_grid(true);
+		}
+
+		void reset_tuner()
+		{
+			if(m_bForceRegularGrid)
+				m_spAss->ass_tuner()->set_force_regular_grid(false);
+		}
+
+	protected:
+	// 	assembling procedure
+		SmartPtr<IAssemble<TAlgebra> > m_spAss;
+		domain_disc_type* m_pDomDisc;
+
+	// 	DoF Distribution used
+		GridLevel m_gridLevel;
+
+	///	flag if regular grid is forced for element loop
+		bool m_bForceRegularGrid;
+
+	///	linearization point
+		SmartPtr<vector_type> m_spU;
+
+	///	temporary for apply_sub
+		SmartPtr<vector_type> m_spTmp;
+
+	///	consistent copy of an additive argument
+		SmartPtr<vector_type> m_spX;
+};
+
+} // namespace ug
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__ */
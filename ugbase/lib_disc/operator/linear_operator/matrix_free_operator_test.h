@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_TEST__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_TEST__
+
+#include <algorithm>
+#include "common/error.h"
+#include "common/log.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+#include "lib_disc/function_spaces/grid_function.h"
+#include "matrix_free_operator.h"
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+#endif
+
+namespace ug{
+
+///	compares the matrix-free jacobian with the assembled one
+/**
+ * Assembles the jacobian J(u) of the domain discretization on the level of u
+ * and compares it to a MatrixFreeOperator initialized at u:
+ * - the application to a random vector x must equal J(u)*x. The comparison
+ * 	includes the dirichlet rows, which the matrix-free application treats
+ * 	separately.
+ * - the matrix of the operator must equal the diagonal of J(u) and must not
+ * 	have any other entries.
+ *
+ * Throws if a result differs by more than tol (relative to the norm of J(u)*x
+ * and the largest diagonal entry, respectively, if they are larger than 1).
+ *
+ * \param[in]	spDomDisc	domain discretization
+ * \param[in]	spU			linearization point
+ * \param[in]	tol			relative tolerance
+ */
+template <typename TDomain, typename TAlgebra>
+void TestMatrixFreeOperator(SmartPtr<DomainDiscretization<TDomain, TAlgebra> > spDomDisc,
+                            SmartPtr<GridFunction<TDomain, TAlgebra> > spU,
+                            number tol)
+{
+	typedef typename TAlgebra::matrix_type matrix_type;
+	typedef typename matrix_type::value_type value_type;
+	typedef GridFunction<TDomain, TAlgebra> function_type;
+
+	const GridLevel& gl = spU->grid_level();
+
+//	assembled jacobian
+	matrix_type J;
+	spDomDisc->assemble_jacobian(J, *spU, gl);
+	const matrix_type& cJ = J;
+
+//	matrix-free operator
+	MatrixFreeOperator<TDomain, TAlgebra> op(spDomDisc, gl);
+	op.init(*spU);
+
+//	application to a random vector
+	SmartPtr<function_type> spX = spU->clone_without_values();
+	SmartPtr<function_type> spY = spU->clone_without_values();
+	SmartPtr<function_type> spJx = spU->clone_without_values();
+	spX->set_random(-1.0, 1.0);
+
+	op.apply(*spY, *spX);
+	J.apply(*spJx, *spX);
+
+	*spY -= *spJx;
+	const number errApply = spY->norm();
+	const number scaleApply = std::max((number)1.0, (number)spJx->norm());
+
+//	diagonal
+	const matrix_type& D = op.get_matrix();
+	UG_COND_THROW(D.num_rows() != J.num_rows() || D.num_cols() != J.num_cols(),
+	              "TestMatrixFreeOperator: sizes of the diagonal and the jacobian do not match.");
+
+	number errDiag = 0, scaleDiag = 0;
+	for(size_t r = 0; r < J.num_rows(); ++r)
+	{
+		for(typename matrix_type::const_row_iterator it = D.begin_row(r); it != D.end_row(r); ++it)
+		{
+			value_type t = it.value();
+			if(it.index() == r)
+				t -= cJ(r, r);
+			errDiag = std::max(errDiag, (number)BlockNorm(t));
+		}
+		scaleDiag = std::max(scaleDiag, (number)BlockNorm(cJ(r, r)));
+	}
+
+#ifdef UG_PARALLEL
+	const pcl::ProcessCommunicator& pc = spU->layouts()->proc_comm();
+	if(!pc.empty())
+	{
+		errDiag = pc.allreduce(errDiag, PCL_RO_MAX);
+		scaleDiag = pc.allreduce(scaleDiag, PCL_RO_MAX);
+	}
+#endif
+	scaleDiag = std::max((number)1.0, scaleDiag);
+
+	UG_LOG("TestMatrixFreeOperator: deviation of the application: " << errApply
+	       << " (|J*x| = " << scaleApply << "), of the diagonal: " << errDiag << "\n");
+
+	if(errApply > tol * scaleApply)
+		UG_THROW("TestMatrixFreeOperator: matrix-free application differs by "
+		         << errApply << " from the assembled jacobian (tolerance: "
+		         << tol * scaleApply << ").");
+	if(errDiag > tol * scaleDiag)
+		UG_THROW("TestMatrixFreeOperator: matrix-free diagonal differs by "
+		         << errDiag << " from the diagonal of the assembled jacobian"
+		         " (tolerance: " << tol * scaleDiag << ").");
+}
+
+}// end of namespace
+
+#endif
@@ -48,6 +48,7 @@
 #include "lib_algebra/operator/interface/operator.h"
 #include "lib_algebra/operator/preconditioner/jacobi.h"
 #include "lib_algebra/operator/linear_solver/lu.h"
+#include "lib_algebra/algebra_common/sparsematrix_triple_product.h"
 #include "lib_disc/dof_manager/dof_distribution.h"
 #include "lib_disc/operator/linear_operator/transfer_interface.h"
 //only for debugging!!!
@@ -56,6 +57,7 @@
 // library intern headers
 #include "lib_disc/function_spaces/grid_function_util.h"
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
+#include "lib_disc/operator/linear_operator/matrix_free_operator.h"
 
 #include "mg_stats.h"
 
@@ -146,7 +148,34 @@ class AssembledMultiGridCycle :
 		}
 
 	///	sets if RAP - Product used to build coarse grid matrices
-		void set_rap(bool bRAP) {m_bUseRAP = bRAP;}
+		void set_rap(bool bRAP) {
+			if(bRAP != m_bUseRAP) m_surfaceMatRevision = 0;
+			m_bUseRAP = bRAP;
+		}
+
+	///	sets if re-inits for an unchanged grid only refresh the numeric values (default: true)
+	/**	If the approximation space has not changed since the last init and the
+	 * surface matrix is finalized with an unchanged pattern revision
+	 * (\sa SparseMatrix::pattern_revision), the level matrices keep their
+	 * sparsity pattern and only their values are recomputed. Matrix based
+	 * smoothers are then re-initialized via IPreconditioner::init_numeric and
+	 * reuse their symbolic setup for level matrices with unchanged pattern
+	 * revision. Assembled matrices are finalized if the assembling reuses the
+	 * matrix structure (\sa AssemblingTuner::set_reuse_matrix_structure).*/
+		void set_numeric_reinit(bool bNumeric) {m_bNumericReinit = bNumeric;}
+
+	///	sets if the level operators above the base level are applied matrix-free
+	/**	If enabled, the operators on the levels above the base level are not
+	 * assembled, but the jacobian is applied element-wise on the fly
+	 * (see MatrixFreeOperator). The level matrices then only contain the
+	 * diagonal of the jacobian, i.e. only Jacobi or Chebyshev smoothers can be
+	 * used (init throws otherwise). The base level is still assembled for
+	 * the base solver. Not available together with RAP, the emulation of a
+	 * full refined grid or adaptive grids.*/
+		void set_matrix_free(bool bMatrixFree) {
+			if(bMatrixFree != m_bMatrixFree) m_ApproxSpaceRevision.invalidate();
+			m_bMatrixFree = bMatrixFree;
+		}
 
 	///	sets if smoothing is performed on surface rim
 		void set_smooth_on_surface_rim(bool bSmooth) {m_bSmoothOnSurfaceRim = bSmooth;}
@@ -359,6 +388,18 @@ class AssembledMultiGridCycle :
 	///	approximation space revision of cached values
 		RevisionCounter m_ApproxSpaceRevision;
 
+	///	flag if re-inits for an unchanged grid only refresh the numeric values
+		bool m_bNumericReinit;
+
+	///	flag if the current init only refreshes the numeric values
+		bool m_bValuesOnly;
+
+	///	pattern revision of the surface matrix in the last init (0: not finalized)
+		size_t m_surfaceMatRevision;
+
+	///	flag if the level operators above the base level are matrix-free
+		bool m_bMatrixFree;
+
 	///	prototype for pre-smoother
 		SmartPtr<ILinearIterator<vector_type> > m_spPreSmootherPrototype;
 
@@ -445,6 +486,12 @@ class AssembledMultiGridCycle :
 
 		///	missing coarse grid correction
 			matrix_type RimCpl_Coarse_Fine;
+
+		///	galerkin product R*A*P computing the coarser level matrix (symbolic phase is reused)
+			SparseTripleProduct<matrix_type> RAP;
+
+		///	level matrix including ghosts, used as A in the galerkin product (parallel only)
+			SmartPtr<matrix_type> spGhostA;
 			
 		/// debugging output information (number of calls of the pre-, postsmoothers, base solver etc)
 			int n_pre_calls, n_post_calls, n_base_calls, n_restr_calls, n_prolong_calls;
@@ -453,6 +500,9 @@ class AssembledMultiGridCycle :
 	///	storage for all level
 		std::vector<SmartPtr<LevData> > m_vLevData;
 
+	///	initializes a smoother for the level matrix (numeric only if possible)
+		bool init_smoother(SmartPtr<ILinearIterator<vector_type> > spSmoother, LevData& ld);
+
 	///	flag, if to solve base problem in parallel when gathered and (!) parallel possible
 		bool m_bGatheredBaseIfAmbiguous;
 
@@ -43,6 +43,8 @@
 #include "lib_disc/operator/linear_operator/std_injection.h"
 #include "lib_grid/tools/periodic_boundary_manager.h"
 #include "lib_disc/operator/linear_operator/level_preconditioner_interface.h"
+#include "lib_algebra/operator/preconditioner/jacobi.h"
+#include "lib_algebra/operator/preconditioner/chebyshev.h"
 #include "mg_solver.h"
 
 #ifdef UG_PARALLEL
@@ -84,6 +86,8 @@ AssembledMultiGridCycle() :
 	m_LocalFullRefLevel(0), m_GridLevelType(GridLevel::LEVEL),
 	m_bUseRAP(false), m_bSmoothOnSurfaceRim(false),
 	m_bCommCompOverlap(false),
+	m_bNumericReinit(true), m_bValuesOnly(false), m_surfaceMatRevision(0),
+	m_bMatrixFree(false),
 	m_spPreSmootherPrototype(new Jacobi<TAlgebra>()),
 	m_spPostSmootherPrototype(m_spPreSmootherPrototype),
 	m_spProjectionPrototype(SPNULL),
@@ -106,6 +110,8 @@ AssembledMultiGridCycle(SmartPtr<ApproximationSpace<TDomain> > approxSpace) :
 	m_LocalFullRefLevel(0), m_GridLevelType(GridLevel::LEVEL),
 	m_bUseRAP(false), m_bSmoothOnSurfaceRim(false),
 	m_bCommCompOverlap(false),
+	m_bNumericReinit(true), m_bValuesOnly(false), m_surfaceMatRevision(0),
+	m_bMatrixFree(false),
 	m_spPreSmootherPrototype(new Jacobi<TAlgebra>()),
 	m_spPostSmootherPrototype(m_spPreSmootherPrototype),
 	m_spProjectionPrototype(new StdInjection<TDomain,TAlgebra>(m_spApproxSpace)),
@@ -421,6 +427,7 @@ init()
 	if(m_baseLev > topLev)
 		UG_THROW("GMG::init: Base Level greater than Surface level.");
 
+	m_bValuesOnly = false;
 	if(m_ApproxSpaceRevision != m_spApproxSpace->revision()
 		|| topLev != m_topLev)
 	{
@@ -454,6 +461,15 @@ init()
 	//	remember revision counter of approx space
 		m_ApproxSpaceRevision = m_spApproxSpace->revision();
 	}
+	else if(m_bNumericReinit)
+	{
+	//	grid, dofs and transfers unchanged: if the surface matrix pattern is
+	//	unchanged as well, only the values of the level operators are refreshed
+		m_bValuesOnly = m_spSurfaceMat->is_finalized()
+				&& m_spSurfaceMat->pattern_revision() == m_surfaceMatRevision;
+	}
+	m_surfaceMatRevision = m_spSurfaceMat->is_finalized()
+							? m_spSurfaceMat->pattern_revision() : 0;
 
 //	Assemble coarse grid operators
 	GMG_PROFILE_BEGIN(GMG_Init_CreateLevelMatrices);
@@ -531,6 +547,10 @@ assemble_level_operator()
 				" elem-disc loop (only top-lev or level-view poosible). It is "
 				"necessary to rework that part of the assembing procedure.")
 
+	if(m_bMatrixFree && m_LocalFullRefLevel < m_topLev)
+		UG_THROW("GMG: Matrix-free level operators are currently only"
+				" implemented for full refined grids.");
+
 //	Create Projection
 	try{
 		if(m_pSurfaceSol) {
@@ -542,7 +562,8 @@ assemble_level_operator()
 						"a consistent solution. Make sure to pass a consistent on.");
 			#endif
 
-			init_projection();
+			if(!m_bValuesOnly)
+				init_projection();
 
 			for(int lev = m_baseLev; lev <= m_topLev; ++lev){
 				const std::vector<SurfLevelMap>& vMap = m_vLevData[lev]->vSurfLevelMap;
@@ -597,8 +618,26 @@ assemble_level_operator()
 		#endif
 
 	//	In Full-Ref case we can copy the Matrix from the surface
-		bool bCpyFromSurface = ((lev == m_topLev) && (lev <= m_LocalFullRefLevel));
-		if(!bCpyFromSurface)
+		const bool bMatrixFreeLev = (m_bMatrixFree && lev > m_baseLev);
+		bool bCpyFromSurface = ((lev == m_topLev) && (lev <= m_LocalFullRefLevel)
+								&& !bMatrixFreeLev);
+		if(bMatrixFreeLev)
+		{
+		//	only store the linearization point and assemble the diagonal
+			UG_DLOG(LIB_DISC_MULTIGRID, 4, "  start assemble_level_operator: matrix-free on lev "<<lev<<"\n");
+			GMG_PROFILE_BEGIN(GMG_AssembleLevelMat_MatrixFreeOnLevel);
+			try{
+			SmartPtr<MatrixFreeOperator<TDomain, TAlgebra> > spMFOp =
+					ld.A.template cast_dynamic<MatrixFreeOperator<TDomain, TAlgebra> >();
+			UG_COND_THROW(spMFOp.invalid(), "Level operator is not matrix-free.");
+			spMFOp->set_force_regular_grid(m_GridLevelType == GridLevel::LEVEL);
+			spMFOp->init(*ld.st);
+			}
+			UG_CATCH_THROW("GMG:init: Cannot init matrix-free operator for level "<<lev);
+			GMG_PROFILE_END();
+			UG_DLOG(LIB_DISC_MULTIGRID, 4, "  end   assemble_level_operator: matrix-free on lev "<<lev<<"\n");
+		}
+		else if(!bCpyFromSurface)
 		{
 			UG_DLOG(LIB_DISC_MULTIGRID, 4, "  start assemble_level_operator: assemble on lev "<<lev<<"\n");
 			GMG_PROFILE_BEGIN(GMG_AssembleLevelMat_AssembleOnLevel);
@@ -621,7 +660,14 @@ assemble_level_operator()
 		//	loop all mapped indices
 			UG_ASSERT(m_spSurfaceMat->num_rows() == m_vSurfToLevelMap.size(),
 			          "Surface Matrix rows != Surf Level Indices")
-			ld.A->resize_and_clear(m_spSurfaceMat->num_rows(), m_spSurfaceMat->num_cols());
+		//	unchanged pattern: keep the finalized level matrix and refill its
+		//	values in place, so that its pattern revision is kept
+			if(m_bValuesOnly && ld.A->is_finalized()
+				&& ld.A->num_rows() == m_spSurfaceMat->num_rows()
+				&& ld.A->num_cols() == m_spSurfaceMat->num_cols())
+				ld.A->set(0.0);
+			else
+				ld.A->resize_and_clear(m_spSurfaceMat->num_rows(), m_spSurfaceMat->num_cols());
 			for(size_t srfRow = 0; srfRow < m_vSurfToLevelMap.size(); ++srfRow)
 			{
 			//	get mapped level index
@@ -644,6 +690,7 @@ assemble_level_operator()
 					(*ld.A)(lvlRow, lvlCol) = conn.value();
 				}
 			}
+			ld.A->finalize();
 
 			#ifdef UG_PARALLEL
 			ld.A->set_storage_type(m_spSurfaceMat->get_storage_mask());
@@ -822,11 +869,21 @@ init_rap_operator()
 	GMG_PROFILE_FUNC();
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start init_rap_operator\n");
 
+	if(m_bMatrixFree)
+		UG_THROW("GMG: Matrix-free level operators cannot be used with RAP.");
+
 	GMG_PROFILE_BEGIN(GMG_BuildRAP_ResizeLevelMat);
+	std::vector<size_t> vLevelRevision(m_topLev + 1, 0);
 	for(int lev = m_topLev; lev >= m_baseLev; --lev)
 	{
 		LevData& ld = *m_vLevData[lev];
-		ld.A->resize_and_clear(ld.st->size(), ld.st->size());
+	//	unchanged pattern: keep the level matrix and only reset its values
+		if(m_bValuesOnly){
+			if(ld.A->is_finalized()) vLevelRevision[lev] = ld.A->pattern_revision();
+			ld.A->set(0.0);
+		}
+		else
+			ld.A->resize_and_clear(ld.st->size(), ld.st->size());
 		#ifdef UG_PARALLEL
 		ld.A->set_storage_type(m_spSurfaceMat->get_storage_mask());
 		ld.A->set_layouts(ld.st->layouts());
@@ -899,16 +956,30 @@ init_rap_operator()
 
 		SmartPtr<matrix_type> spA = lf.A;
 		#ifdef UG_PARALLEL
-		SmartPtr<matrix_type> spGhostA = SmartPtr<matrix_type>(new matrix_type);
+		if(lf.spGhostA.invalid()) lf.spGhostA = make_sp(new matrix_type);
+		SmartPtr<matrix_type> spGhostA = lf.spGhostA;
 		ComPol_MatAddSetZeroInnerInterfaceCouplings<matrix_type> cpMatAdd(*spGhostA);
 		if( !lf.t->layouts()->vertical_master().empty() ||
 			!lf.t->layouts()->vertical_slave().empty())
 		{
 			GMG_PROFILE_BEGIN(GMG_BuildRAP_CopyNoghostToGhost);
-			spGhostA->resize_and_clear(lf.t->size(), lf.t->size());
+		//	unchanged pattern: refill the finalized ghost matrix in place, so
+		//	that the symbolic phase of the galerkin product is reused
+			const bool bRefill = m_bValuesOnly && spGhostA->is_finalized()
+								&& spGhostA->num_rows() == lf.t->size()
+								&& spGhostA->num_cols() == lf.t->size();
+			if(bRefill) spGhostA->set(0.0);
+			else spGhostA->resize_and_clear(lf.t->size(), lf.t->size());
 			spGhostA->set_layouts(lf.t->layouts());
 			if(!lf.t->layouts()->vertical_master().empty()){
 				copy_noghost_to_ghost(spGhostA, lf.A, lf.vMapPatchToGlobal);
+			} else if(bRefill){
+				typedef typename matrix_type::const_row_iterator const_row_iterator;
+				const matrix_type& A = *lf.A;
+				for(size_t i = 0; i < A.num_rows(); ++i)
+					for(const_row_iterator conn = A.begin_row(i); conn != A.end_row(i); ++conn)
+						(*spGhostA)(i, conn.index()) = conn.value();
+				spGhostA->set_storage_type(A.get_storage_mask());
 			} else {
 				*spGhostA = *lf.A;
 			}
@@ -943,13 +1014,24 @@ init_rap_operator()
 		#endif
 
 		GMG_PROFILE_BEGIN(GMG_BuildRAP_MultiplyRAP);
-		AddMultiplyOf(*lc.A, *R, *spA, *P);
+	//	the product is computed from the CRS arrays of the finalized factors
+		R->finalize(); spA->finalize(); P->finalize();
+		lf.RAP.add_to(*lc.A, *R, *spA, *P);
 		GMG_PROFILE_END();
 		UG_DLOG(LIB_DISC_MULTIGRID, 4, "  end   init_rap_operator: build rap on lev "<<lev<<"\n");
 	}
 	GMG_PROFILE_END();
 	UG_DLOG(LIB_DISC_MULTIGRID, 4, "  end   init_rap_operator: build rap\n");
 
+//	if a level pattern has changed, the smoothers need a full init
+	if(m_bValuesOnly){
+		for(int lev = m_baseLev; lev <= m_topLev; ++lev){
+			const matrix_type& A = *m_vLevData[lev]->A;
+			if(!A.is_finalized() || A.pattern_revision() != vLevelRevision[lev])
+				m_bValuesOnly = false;
+		}
+	}
+
 //	write computed level matrices for debug purpose
 	for(int lev = m_baseLev; lev <= m_topLev; ++lev){
 		LevData& ld = *m_vLevData[lev];
@@ -1130,7 +1212,7 @@ init_smoother()
 		UG_DLOG(LIB_DISC_MULTIGRID, 4, "  init_smoother: initializing pre-smoother on lev "<<lev<<"\n");
 		bool success;
 		GridLevel gw_gl; enter_debug_writer_section(gw_gl, "PreSmootherInit", lev);
-		try {success = ld.PreSmoother->init(ld.A, *ld.sc);}
+		try {success = init_smoother(ld.PreSmoother, ld);}
 		UG_CATCH_THROW("GMG::init: Cannot init pre-smoother for level "<<lev);
 		leave_debug_writer_section(gw_gl);
 		if (!success)
@@ -1140,7 +1222,7 @@ init_smoother()
 		if(ld.PreSmoother != ld.PostSmoother)
 		{
 			GridLevel gw_gl; enter_debug_writer_section(gw_gl, "PostSmootherInit", lev);
-			try {success = ld.PostSmoother->init(ld.A, *ld.sc);}
+			try {success = init_smoother(ld.PostSmoother, ld);}
 			UG_CATCH_THROW("GMG::init: Cannot init post-smoother for level "<<lev);
 			leave_debug_writer_section(gw_gl);
 			if (!success)
@@ -1151,6 +1233,30 @@ init_smoother()
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop init_smoother\n");
 }
 
+template <typename TDomain, typename TAlgebra>
+bool AssembledMultiGridCycle<TDomain, TAlgebra>::
+init_smoother(SmartPtr<ILinearIterator<vector_type> > spSmoother, LevData& ld)
+{
+//	matrix-free level operators only hold the diagonal of the jacobian
+	if(m_bMatrixFree
+		&& spSmoother.template cast_dynamic<Jacobi<TAlgebra> >().invalid()
+		&& spSmoother.template cast_dynamic<Chebyshev<TAlgebra> >().invalid())
+		UG_THROW("GMG: Matrix-free level operators only hold the diagonal of "
+				"the jacobian. Use a Jacobi or Chebyshev smoother instead of '"
+				<< spSmoother->name() << "'.");
+
+//	if only the values have changed, matrix based smoothers may reuse their
+//	symbolic setup
+	if(m_bValuesOnly){
+		SmartPtr<IPreconditioner<TAlgebra> > spPrecond =
+				spSmoother.template cast_dynamic<IPreconditioner<TAlgebra> >();
+		if(spPrecond.valid())
+			return spPrecond->init_numeric(ld.A, *ld.sc);
+	}
+
+	return spSmoother->init(ld.A, *ld.sc);
+}
+
 template <typename TDomain, typename TAlgebra>
 void AssembledMultiGridCycle<TDomain, TAlgebra>::
 init_base_solver()
@@ -1538,8 +1644,12 @@ init_level_memory(int baseLev, int topLev)
 			ld.t = ld.st;
 		}
 
-		ld.A = SmartPtr<MatrixOperator<matrix_type, vector_type> >(
-				new MatrixOperator<matrix_type, vector_type>);
+		if(m_bMatrixFree && lev > baseLev)
+			ld.A = SmartPtr<MatrixOperator<matrix_type, vector_type> >(
+					new MatrixFreeOperator<TDomain, TAlgebra>(m_spAss, gl));
+		else
+			ld.A = SmartPtr<MatrixOperator<matrix_type, vector_type> >(
+					new MatrixOperator<matrix_type, vector_type>);
 
 		ld.PreSmoother = m_spPreSmootherPrototype->clone();
 		if(m_spPreSmootherPrototype == m_spPostSmootherPrototype)
@@ -33,9 +33,12 @@
 #ifndef __H__UG__LIB_DISC__SPATIAL_DISC__ASS_TUNER__
 #define __H__UG__LIB_DISC__SPATIAL_DISC__ASS_TUNER__
 
+#include <list>
+
 #include "lib_grid/tools/bool_marker.h"
 #include "lib_grid/tools/selector_grid.h"
 #include "lib_disc/spatial_disc/local_to_global/local_to_global_mapper.h"
+#include "lib_disc/spatial_disc/local_to_global/matrix_scatter_cache.h"
 #include "lib_disc/spatial_disc/elem_disc/elem_disc_interface.h"
 
 namespace ug{
@@ -115,9 +118,12 @@ class AssemblingTuner
 		m_bSingleAssIndex(false), m_SingleAssIndex(0),
 		m_bForceRegGrid(false), m_bModifySolutionImplemented(false),
 		m_ConstraintTypesEnabled(CT_ALL), m_ElemTypesEnabled(EDT_ALL),
-		m_bMatrixIsConst(false), m_bClearOnResize(true)
+		m_bMatrixIsConst(false), m_bClearOnResize(true),
+		m_bReuseMatrixStructure(false)
 		{
 			m_pMapper = &m_pMapperCommon;
+			m_lScatterCache.push_back(MatrixScatterCache<matrix_type>());
+			m_pScatterCache = &m_lScatterCache.front();
 		}
 
 	/// destructor
@@ -139,7 +145,12 @@ class AssemblingTuner
 
 		void add_local_mat_to_global(matrix_type& mat, const LocalMatrix& lmat,
 		                         ConstSmartPtr<DoFDistribution> dd) const
-		{ m_pMapper->add_local_mat_to_global(mat, lmat, dd);}
+		{
+			if(m_bReuseMatrixStructure && m_pMapper == &m_pMapperCommon)
+				m_pScatterCache->add(mat, lmat);
+			else
+				m_pMapper->add_local_mat_to_global(mat, lmat, dd);
+		}
 
 		void modify_LocalSol(LocalVector& vecMod, const LocalVector& lvec,
 		                         ConstSmartPtr<DoFDistribution> dd) const
@@ -222,6 +233,13 @@ class AssemblingTuner
 		void resize(ConstSmartPtr<DoFDistribution> dd, vector_type& vec) const;
 		void resize(ConstSmartPtr<DoFDistribution> dd, matrix_type& mat) const;
 
+	///	finishes the assembly of a matrix (counterpart of resize)
+	/**
+	 * If the reuse of the matrix structure is enabled, the sparsity pattern
+	 * of the assembled matrix is frozen and remembered for the next assembly.
+	 */
+		void finish(ConstSmartPtr<DoFDistribution> dd, matrix_type& mat) const;
+
 	///	gets the element iterator from the Selector
 		template <typename TElem>
 		void collect_selected_elements(std::vector<TElem*>& vElem, ConstSmartPtr<DoFDistribution> dd, int si) const;
@@ -258,6 +276,33 @@ class AssemblingTuner
 	 */
 		bool matrix_is_const() const {return m_bMatrixIsConst;}
 
+	/**
+	 * specify whether the sparsity pattern of the matrix is reused
+	 *
+	 * If enabled, the sparsity pattern of the matrix is kept between
+	 * assemblies on an unchanged DoFDistribution and the positions of the
+	 * local matrix entries in the global matrix are cached, such that
+	 * adding local matrices does not need any search or insertion.
+	 * This pays off if the same matrix is assembled repeatedly, e.g.,
+	 * the jacobian in a Newton iteration or in time stepping.
+	 *
+	 * @param bReuse set true to reuse pattern and scatter map
+	 */
+		void set_reuse_matrix_structure(bool bReuse)
+		{
+			m_bReuseMatrixStructure = bReuse;
+			for(typename std::list<MatrixScatterCache<matrix_type> >::iterator
+				it = m_lScatterCache.begin(); it != m_lScatterCache.end(); ++it)
+				it->invalidate();
+		}
+
+	/**
+	 * whether the sparsity pattern of the matrix is reused
+	 *
+	 * @return true iff pattern and scatter map are reused
+	 */
+		bool reuse_matrix_structure() const {return m_bReuseMatrixStructure;}
+
 	protected:
 	///	default LocalToGlobalMapper
 		LocalToGlobalMapper<TAlgebra> m_pMapperCommon;
@@ -293,6 +338,25 @@ class AssemblingTuner
 
 	/// disables clearing of vector/matrix on resize
 		bool m_bClearOnResize;
+
+	/// enables reuse of matrix sparsity pattern and scatter map
+		bool m_bReuseMatrixStructure;
+
+	///	caches for matrix sparsity pattern and scatter map
+	/**
+	 * One cache is kept for each of the last assembled matrices (most
+	 * recently used first), such that e.g. assembling a mass matrix does not
+	 * discard the scatter map of the jacobian. m_pScatterCache points to the
+	 * cache of the matrix currently assembled.
+	 */
+		mutable std::list<MatrixScatterCache<matrix_type> > m_lScatterCache;
+		mutable MatrixScatterCache<matrix_type>* m_pScatterCache;
+
+	///	maximal number of matrices with a cached structure
+		static const size_t s_maxNumScatterCache = 4;
+
+	///	selects (or creates) the cache for a matrix
+		void select_scatter_cache(const matrix_type& mat) const;
 };
 
 } // end namespace ug
@@ -51,22 +51,78 @@ void AssemblingTuner<TAlgebra>::resize(ConstSmartPtr<DoFDistribution> dd,
 		vec.set(0.0);
 }
 
+template <typename TAlgebra>
+void AssemblingTuner<TAlgebra>::select_scatter_cache(const matrix_type& mat) const
+{
+	typedef typename std::list<MatrixScatterCache<matrix_type> >::iterator iterator;
+
+//	search the cache of the matrix
+	iterator it = m_lScatterCache.begin();
+	for(; it != m_lScatterCache.end(); ++it)
+		if(it->matrix() == &mat) break;
+
+	if(it == m_lScatterCache.end())
+	{
+	//	new matrix: use an unused cache, a new one or recycle the least
+	//	recently used one
+		for(it = m_lScatterCache.begin(); it != m_lScatterCache.end(); ++it)
+			if(it->matrix() == NULL) break;
+
+		if(it == m_lScatterCache.end())
+		{
+			if(m_lScatterCache.size() < s_maxNumScatterCache)
+				it = m_lScatterCache.insert(m_lScatterCache.end(), MatrixScatterCache<matrix_type>());
+			else
+				--it;
+		}
+		it->invalidate();
+	}
+
+//	move to front
+	m_lScatterCache.splice(m_lScatterCache.begin(), m_lScatterCache, it);
+	m_pScatterCache = &m_lScatterCache.front();
+}
+
 template <typename TAlgebra>
 void AssemblingTuner<TAlgebra>::resize(ConstSmartPtr<DoFDistribution> dd,
 								  matrix_type& mat) const
 {
+	if (m_bReuseMatrixStructure) select_scatter_cache(mat);
+
 	if (single_index_assembling_enabled())
 	{
+		if (m_bReuseMatrixStructure) m_pScatterCache->invalidate();
 		if (m_bClearOnResize) mat.resize_and_clear(1, 1);
 		else mat.resize_and_keep_values(1,1);
 	}
 	else{
 		const size_t numIndex = dd->num_indices();
-		if (m_bClearOnResize) mat.resize_and_clear(numIndex, numIndex);
+		if (m_bClearOnResize)
+		{
+		//	keep the sparsity pattern if unchanged
+			if(m_bReuseMatrixStructure && m_pScatterCache->begin_assembly(mat, *dd))
+				return;
+			mat.resize_and_clear(numIndex, numIndex);
+		}
 		else mat.resize_and_keep_values(numIndex, numIndex);
 	}
 }
 
+template <typename TAlgebra>
+void AssemblingTuner<TAlgebra>::finish(ConstSmartPtr<DoFDistribution> dd,
+								  matrix_type& mat) const
+{
+	if (!m_bReuseMatrixStructure) return;
+
+	if (single_index_assembling_enabled() || !m_bClearOnResize)
+	{
+		m_pScatterCache->invalidate();
+		return;
+	}
+
+	m_pScatterCache->end_assembly(mat, *dd);
+}
+
 template <typename TAlgebra>
 template <typename TElem>
 bool AssemblingTuner<TAlgebra>::element_used(TElem* elem) const
@@ -263,6 +263,32 @@ class DomainDiscretizationBase
 		                                       const GridLevel& gl)
 		{assemble_stiffness_matrix(A, u, dd(gl));}
 
+	/// applies the jacobian to a vector without assembling it (y = J(u)*x)
+	/**
+	 * The jacobian is computed element by element and only applied to the
+	 * vector x, i.e. no global matrix is built. Only dirichlet constraints are
+	 * supported, whose rows act as identity (as in the assembled jacobian).
+	 * Elimination of dirichlet columns is not taken into account.
+	 * In the parallel case, x must be consistent and y is returned additive.
+	 */
+		void apply_jacobian(vector_type& y, const vector_type& x, const vector_type& u,
+		                    ConstSmartPtr<DoFDistribution> dd);
+		void apply_jacobian(vector_type& y, const vector_type& x, const vector_type& u,
+		                    const GridLevel& gl)
+		{apply_jacobian(y, x, u, dd(gl));}
+
+	/// assembles only the diagonal of the jacobian
+	/**
+	 * The resulting matrix contains only diagonal entries and is adjusted for
+	 * dirichlet constraints in the same way as the full jacobian. It is meant
+	 * for smoothers of matrix-free operators (e.g. Jacobi).
+	 */
+		void assemble_jacobian_diagonal(matrix_type& D, const vector_type& u,
+		                                ConstSmartPtr<DoFDistribution> dd);
+		void assemble_jacobian_diagonal(matrix_type& D, const vector_type& u,
+		                                const GridLevel& gl)
+		{assemble_jacobian_diagonal(D, u, dd(gl));}
+
 	///////////////////////////////////////////////////////////
 	// Error estimator										///
 public:
@@ -521,8 +547,16 @@ public:
 		
 	///	this object provides tools to adapt the assemble routine
 		SmartPtr<AssemblingTuner<TAlgebra> > m_spAssTuner;
+
+	///	temporary for the dirichlet rows in apply_jacobian
+		vector_type m_dirichletTmp;
 	
 	private:
+	///	element loop of apply_jacobian and assemble_jacobian_diagonal
+		void apply_jacobian_elem_loop(vector_type* pY, const vector_type* pX,
+		                              matrix_type* pD, const vector_type& u,
+		                              ConstSmartPtr<DoFDistribution> dd);
+
 	//---- Auxiliary function templates for the assembling ----//
 	//	These functions call the corresponding functions from the global assembler for a composed list of elements:
 	//-- for stationary problems --//
@@ -545,6 +579,14 @@ public:
 									matrix_type& J,
 									const vector_type& u);
 	template <typename TElem>
+	void ApplyJacobian(				const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+									ConstSmartPtr<DoFDistribution> dd,
+									int si, bool bNonRegularGrid,
+									vector_type* pY,
+									const vector_type* pX,
+									matrix_type* pD,
+									const vector_type& u);
+	template <typename TElem>
 	void AssembleDefect( 			const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 									ConstSmartPtr<DoFDistribution> dd,
 									int si, bool bNonRegularGrid,
@@ -242,6 +242,9 @@ assemble_mass_matrix(matrix_type& M, const vector_type& u,
 	}UG_CATCH_THROW("DomainDiscretization::assemble_mass_matrix:"
 					" Cannot execute post process.");
 
+//	freeze sparsity pattern if it is reused
+	m_spAssTuner->finish(dd, M);
+
 //	Remember parallel storage type
 #ifdef UG_PARALLEL
 	M.set_storage_type(PST_ADDITIVE);
@@ -398,6 +401,9 @@ assemble_stiffness_matrix(matrix_type& A, const vector_type& u,
 	}UG_CATCH_THROW("DomainDiscretization::assemble_stiffness_matrix:"
 					" Cannot execute post process.");
 
+//	freeze sparsity pattern if it is reused
+	m_spAssTuner->finish(dd, A);
+
 //	Remember parallel storage type
 #ifdef UG_PARALLEL
 	A.set_storage_type(PST_ADDITIVE);
@@ -579,6 +585,9 @@ assemble_jacobian(matrix_type& J,
 	}UG_CATCH_THROW("DomainDiscretization::assemble_jacobian:"
 					" Cannot execute post process.");
 
+//	freeze sparsity pattern if it is reused
+	m_spAssTuner->finish(dd, J);
+
 //	Remember parallel storage type
 #ifdef UG_PARALLEL
 	J.set_storage_type(PST_ADDITIVE);
@@ -627,6 +636,240 @@ AssembleJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Apply Jacobian (stationary, matrix-free)
+///////////////////////////////////////////////////////////////////////////////
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+apply_jacobian(vector_type& y,
+               const vector_type& x,
+               const vector_type& u,
+               ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+
+//	reset result
+	y.resize(dd->num_indices());
+	y.set(0.0);
+
+//	add element contributions
+	apply_jacobian_elem_loop(&y, &x, NULL, u, dd);
+
+//	dirichlet rows act as identity: y = x there
+	if(m_spAssTuner->constraint_type_enabled(CT_DIRICHLET))
+	{
+	//	the temporary keeps its memory between the applications
+		m_dirichletTmp = x;
+		try{
+		for(size_t i = 0; i < m_vConstraint.size(); ++i)
+			if(m_vConstraint[i]->type() & CT_DIRICHLET)
+			{
+				m_vConstraint[i]->set_ass_tuner(m_spAssTuner);
+				m_vConstraint[i]->adjust_correction(y, dd, CT_DIRICHLET);
+				m_vConstraint[i]->adjust_correction(m_dirichletTmp, dd, CT_DIRICHLET);
+			}
+		}UG_CATCH_THROW("DomainDiscretization::apply_jacobian:"
+						" Cannot adjust dirichlet rows.");
+
+	//	m_dirichletTmp is x with zero dirichlet values, thus x - m_dirichletTmp
+	//	is x restricted to the dirichlet dofs
+		y += x;
+		y -= m_dirichletTmp;
+	}
+
+#ifdef UG_PARALLEL
+	y.set_storage_type(PST_ADDITIVE);
+#endif
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+assemble_jacobian_diagonal(matrix_type& D,
+                           const vector_type& u,
+                           ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+
+//	reset matrix to zero and resize, create diagonal
+	const size_t numIndex = dd->num_indices();
+	D.resize_and_clear(numIndex, numIndex);
+	for(size_t i = 0; i < numIndex; ++i)
+		D(i, i) = 0.0;
+
+//	add element contributions
+	apply_jacobian_elem_loop(NULL, NULL, &D, u, dd);
+
+//	post process
+	try{
+	if(m_spAssTuner->constraint_type_enabled(CT_DIRICHLET))
+		for(size_t i = 0; i < m_vConstraint.size(); ++i)
+			if(m_vConstraint[i]->type() & CT_DIRICHLET)
+			{
+				m_vConstraint[i]->set_ass_tuner(m_spAssTuner);
+				m_vConstraint[i]->adjust_jacobian(D, u, dd, CT_DIRICHLET);
+			}
+	}UG_CATCH_THROW("DomainDiscretization::assemble_jacobian_diagonal:"
+					" Cannot execute post process.");
+
+#ifdef UG_PARALLEL
+	D.set_storage_type(PST_ADDITIVE);
+	D.set_layouts(dd->layouts());
+#endif
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+apply_jacobian_elem_loop(vector_type* pY,
+                         const vector_type* pX,
+                         matrix_type* pD,
+                         const vector_type& u,
+                         ConstSmartPtr<DoFDistribution> dd)
+{
+//	only dirichlet constraints can be handled without a matrix
+	for(int type = 1; type < CT_ALL; type = type << 1){
+		if(type == CT_DIRICHLET) continue;
+		if(!(m_spAssTuner->constraint_type_enabled(type))) continue;
+		for(size_t i = 0; i < m_vConstraint.size(); ++i)
+			if(m_vConstraint[i]->type() & type)
+				UG_THROW("DomainDiscretization::apply_jacobian: Only dirichlet"
+						" constraints are supported for matrix-free application,"
+						" but constraint of type "<<type<<" is present.");
+	}
+	if(m_spAssTuner->modify_solution_enabled())
+		UG_THROW("DomainDiscretization::apply_jacobian: Modification of the"
+				" solution is not supported for matrix-free application.");
+
+//	update the elem discs
+	update_disc_items();
+	prep_assemble_loop(m_vElemDisc);
+
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
+//	loop subsets
+	for(size_t i = 0; i < unionSubsets.size(); ++i)
+	{
+	//	get subset
+		const int si = unionSubsets[i];
+
+	//	get dimension of the subset
+		const int dim = DimensionOfSubset(*dd->subset_handler(), si);
+
+	//	request if subset is regular grid
+		bool bNonRegularGrid = !unionSubsets.regular_grid(i);
+
+	//	overrule by regular grid if required
+		if(m_spAssTuner->regular_grid_forced()) bNonRegularGrid = false;
+
+	//	Elem Disc on the subset
+		std::vector<IElemDisc<TDomain>*> vSubsetElemDisc;
+
+	//	get all element discretizations that work on the subset
+		GetElemDiscOnSubset(vSubsetElemDisc, m_vElemDisc, vSSGrp, si);
+
+	//	apply on suitable elements
+		try
+		{
+		switch(dim)
+		{
+		case 1:
+			this->template ApplyJacobian<RegularEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template ApplyJacobian<ConstrainingEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			break;
+		case 2:
+			this->template ApplyJacobian<Triangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			this->template ApplyJacobian<Quadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template ApplyJacobian<ConstrainingTriangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			this->template ApplyJacobian<ConstrainingQuadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			break;
+		case 3:
+			this->template ApplyJacobian<Tetrahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			this->template ApplyJacobian<Pyramid>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			this->template ApplyJacobian<Prism>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			this->template ApplyJacobian<Hexahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			this->template ApplyJacobian<Octahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, pY, pX, pD, u);
+			break;
+		default:
+			UG_THROW("DomainDiscretization::apply_jacobian (stationary):"
+							"Dimension "<<dim<<"(subset="<<si<<") not supported");
+		}
+		}
+		UG_CATCH_THROW("DomainDiscretization::apply_jacobian (stationary):"
+						" Application of elements of Dimension " << dim << " in "
+						" subset "<<si<< " failed.");
+	}
+
+	try{
+		post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("DomainDiscretization::apply_jacobian:"
+					" Cannot execute post process.");
+}
+
+/**
+ * This function applies the jacobian contributions of all passed element
+ * discretizations on one given subset to a vector and/or adds their diagonal
+ * to a matrix in the stationary case.
+ *
+ * \param[in]		vElemDisc		element discretizations
+ * \param[in]		si				subset index
+ * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+ * \param[in,out]	pY				result vector (or NULL)
+ * \param[in]		pX				vector the jacobian is applied to (or NULL)
+ * \param[in,out]	pD				diagonal of the jacobian (or NULL)
+ * \param[in]		u				solution
+ */
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+template <typename TElem>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+ApplyJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+				ConstSmartPtr<DoFDistribution> dd,
+				int si, bool bNonRegularGrid,
+				vector_type* pY,
+				const vector_type* pX,
+				matrix_type* pD,
+				const vector_type& u)
+{
+	//	check if only some elements are selected
+	if(m_spAssTuner->selected_elements_used())
+	{
+		std::vector<TElem*> vElem;
+		m_spAssTuner->collect_selected_elements(vElem, dd, si);
+
+		//	application is carried out only over those elements
+		//	which are selected and in subset si
+		gass_type::template ApplyJacobian<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd, vElem.begin(), vElem.end(), si,
+			 bNonRegularGrid, pY, pX, pD, u, m_spAssTuner);
+	}
+	else
+	{
+		//	general case: application over all elements in subset si
+		gass_type::template ApplyJacobian<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd,
+				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+					bNonRegularGrid, pY, pX, pD, u, m_spAssTuner);
+	}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Defect (stationary)
 ///////////////////////////////////////////////////////////////////////////////
@@ -918,6 +1161,9 @@ assemble_linear(matrix_type& mat, vector_type& rhs,
 	post_assemble_loop(m_vElemDisc);
 	}UG_CATCH_THROW("DomainDiscretization::assemble_linear: Cannot post process.");
 
+//	freeze sparsity pattern if it is reused
+	m_spAssTuner->finish(dd, mat);
+
 //	Remember parallel storage type
 #ifdef UG_PARALLEL
 	mat.set_storage_type(PST_ADDITIVE);
@@ -1468,6 +1714,9 @@ assemble_jacobian(matrix_type& J,
 	post_assemble_loop(m_vElemDisc);
 	}UG_CATCH_THROW("Cannot adjust jacobian.");
 
+//	freeze sparsity pattern if it is reused
+	m_spAssTuner->finish(dd, J);
+
 //	Remember parallel storage type
 #ifdef UG_PARALLEL
 	J.set_storage_type(PST_ADDITIVE);
@@ -1803,6 +2052,10 @@ assemble_linear(matrix_type& mat, vector_type& rhs,
 	}
 	} UG_CATCH_THROW("Cannot adjust linear.");
 
+//	freeze sparsity pattern if it is reused
+	if (!m_spAssTuner->matrix_is_const())
+		m_spAssTuner->finish(dd, mat);
+
 //	Remember parallel storage type
 #ifdef UG_PARALLEL
 	mat.set_storage_type(PST_ADDITIVE);
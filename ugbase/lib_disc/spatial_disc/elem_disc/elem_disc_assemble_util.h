@@ -412,6 +412,120 @@ public:
 		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot create Data Evaluator.");
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+// Apply (stationary) Jacobian
+////////////////////////////////////////////////////////////////////////////////
+
+public:
+	/**
+	 * This function applies the jacobian of all passed element discretizations
+	 * on one given subset to a vector, without assembling the global matrix,
+	 * i.e. it computes y += J(u)*x. The local jacobians are computed element
+	 * by element and are only used to update y and the diagonal of the
+	 * jacobian. (This version processes elements in a given interval.)
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		iterBegin		element iterator
+	 * \param[in]		iterEnd			element iterator
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in,out]	pY				result vector (or NULL)
+	 * \param[in]		pX				vector the jacobian is applied to (or NULL)
+	 * \param[in,out]	pD				diagonal of the jacobian (or NULL)
+	 * \param[in]		u				solution
+	 * \param[in]		spAssTuner		assemble adapter
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	ApplyJacobian(		const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+						ConstSmartPtr<domain_type> spDomain,
+						ConstSmartPtr<DoFDistribution> dd,
+						TIterator iterBegin,
+						TIterator iterEnd,
+						int si, bool bNonRegularGrid,
+						vector_type* pY,
+						const vector_type* pX,
+						matrix_type* pD,
+						const vector_type& u,
+						ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	check if there are any elements at all, otherwise return immediately
+		if(iterBegin == iterEnd) return;
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	prepare for given elem discs
+		try
+		{
+		DataEvaluator<domain_type> Eval(STIFF | RHS,
+						   vElemDisc, dd->function_pattern(), bNonRegularGrid);
+
+	//	prepare element loop
+		Eval.prepare_elem_loop(id, si);
+
+	//	local indices and local algebra
+		LocalIndices ind; LocalVector locU; LocalMatrix locJ;
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	get corner coordinates
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get global indices
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	adapt local algebra
+			locU.resize(ind); locJ.resize(ind);
+
+		//	read local values of u
+			GetLocalVector(locU, u);
+
+		//	prepare element
+			try
+			{
+				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+			}
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot prepare element.");
+
+		//	reset local algebra
+			locJ = 0.0;
+
+		//	Assemble JA
+			try
+			{
+				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
+			}
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot compute Jacobian (A).");
+
+		//	apply local jacobian and collect its diagonal
+			if(pY != NULL) AddLocalMatVecToGlobal(*pY, locJ, *pX);
+			if(pD != NULL) AddLocalMatrixDiagonalToGlobal(*pD, locJ);
+		}
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot finish element loop.");
+
+		}
+		UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot create Data Evaluator.");
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Assemble (instationary) Jacobian
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__MATRIX_SCATTER_CACHE__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__MATRIX_SCATTER_CACHE__
+
+// extern headers
+#include <vector>
+#include <algorithm>
+
+// intern headers
+#include "lib_disc/common/local_algebra.h"
+#include "lib_disc/common/revision_counter.h"
+#include "lib_disc/dof_manager/dof_distribution.h"
+
+namespace ug{
+
+/// caches the sparsity pattern and the scatter map of a repeatedly assembled matrix
+/**
+ * Adding a local matrix to a global SparseMatrix requires a search (and
+ * possibly an insertion) for every entry. When the same matrix is assembled
+ * again and again on an unchanged DoFDistribution (Newton steps, time steps),
+ * the sparsity pattern and the position of every local entry in the value
+ * array do not change. This class exploits that in three stages:
+ *
+ * <ol>
+ * <li> first assembly: the matrix is assembled as usual, afterwards the
+ * 		sparsity pattern is frozen by finalizing the matrix.
+ * <li> second assembly: the values of the finalized matrix are zeroed
+ * 		(the pattern is kept) and for every added local matrix the value slots
+ * 		are looked up in the finalized rows and recorded.
+ * <li> following assemblies: the recorded slots are replayed, i.e. the local
+ * 		values are written directly into the value array without any search.
+ * </ol>
+ *
+ * The cache is keyed on the matrix object and the revision of the
+ * DoFDistribution. Every added local matrix is checked against a hash of its
+ * global indices, so that a different element order or element set is
+ * detected; in that case (and if the pattern has been extended by an
+ * insertion, which unfinalizes the matrix) the remaining entries are added
+ * in the usual way and the scatter map is recorded again next time.
+ *
+ * \tparam	TMatrix		matrix type (SparseMatrix based)
+ */
+template <typename TMatrix>
+class MatrixScatterCache
+{
+	public:
+	///	Type of matrix
+		typedef TMatrix matrix_type;
+
+	///	Type of matrix entries
+		typedef typename matrix_type::value_type value_type;
+
+	public:
+	///	constructor
+		MatrixScatterCache()
+			: m_pMat(NULL), m_numIndex(0), m_state(SC_EMPTY),
+			  m_mode(SC_GENERIC), m_bFailed(false), m_cursor(0)
+		{}
+
+	///	prepares a matrix for a new assembly
+	/**
+	 * If the matrix is the one cached with the same DoFDistribution revision
+	 * and size, its values are set to zero while the sparsity pattern is
+	 * kept. Otherwise the cache is reset.
+	 *
+	 * \returns true if the pattern has been reused, false if the caller
+	 * 			has to resize and clear the matrix
+	 */
+		bool begin_assembly(matrix_type& mat, const DoFDistribution& dd)
+		{
+			const size_t numIndex = dd.num_indices();
+			if(m_state != SC_EMPTY && m_pMat == &mat
+				&& m_revision == dd.revision() && m_numIndex == numIndex
+				&& mat.is_finalized()
+				&& mat.num_rows() == numIndex && mat.num_cols() == numIndex)
+			{
+				mat.set(0.0);
+				m_bFailed = false;
+				m_cursor = 0;
+				if(m_state == SC_MAP)
+					m_mode = SC_REPLAY;
+				else{
+					clear_map();
+					m_mode = SC_RECORD;
+				}
+				return true;
+			}
+
+			invalidate();
+			return false;
+		}
+
+	///	adds a local matrix to the global one, using the scatter map if possible
+		void add(matrix_type& mat, const LocalMatrix& lmat)
+		{
+			if(m_mode != SC_GENERIC)
+			{
+				bool bDone = false;
+				if(&mat == m_pMat && mat.is_finalized())
+				{
+					if(m_mode == SC_REPLAY) bDone = replay(mat, lmat);
+					else bDone = record(mat, lmat);
+				}
+
+				if(bDone) return;
+
+			//	from now on, add entries in the usual way
+				m_mode = SC_GENERIC;
+				m_bFailed = true;
+			}
+
+			AddLocalMatrixToGlobal(mat, lmat);
+		}
+
+	///	finishes the assembly and freezes the sparsity pattern of the matrix
+		void end_assembly(matrix_type& mat, const DoFDistribution& dd)
+		{
+			const bool bMapValid = !m_bFailed && mat.is_finalized()
+					&& (m_mode == SC_RECORD
+						|| (m_mode == SC_REPLAY && m_cursor + 1 == m_vOffset.size()));
+
+			if(bMapValid)
+				m_state = SC_MAP;
+			else{
+				clear_map();
+				m_state = SC_PATTERN;
+			}
+
+			if(!mat.is_finalized()) mat.finalize();
+
+			m_pMat = &mat;
+			m_revision = dd.revision();
+			m_numIndex = dd.num_indices();
+			m_mode = SC_GENERIC;
+		}
+
+	///	forgets about cached pattern and scatter map
+		void invalidate()
+		{
+			m_pMat = NULL;
+			m_revision.invalidate();
+			m_numIndex = 0;
+			m_state = SC_EMPTY;
+			m_mode = SC_GENERIC;
+			m_bFailed = false;
+			m_cursor = 0;
+			clear_map();
+		}
+
+	///	returns if the scatter map is used for the current assembly
+		bool replaying() const {return m_mode == SC_REPLAY;}
+
+	///	returns the matrix whose structure is cached (NULL if none)
+		const matrix_type* matrix() const {return m_pMat;}
+
+	protected:
+	///	clears the recorded scatter map
+		void clear_map()
+		{
+			m_vSlot.clear();
+			m_vOffset.clear();
+			m_vOffset.push_back(0);
+			m_vKey.clear();
+		}
+
+	///	returns the number of entries of a local matrix
+		static size_t num_entries(const LocalMatrix& lmat)
+		{
+			size_t numRow = 0, numCol = 0;
+			for(size_t fct=0; fct < lmat.num_all_row_fct(); ++fct)
+				numRow += lmat.num_all_row_dof(fct);
+			for(size_t fct=0; fct < lmat.num_all_col_fct(); ++fct)
+				numCol += lmat.num_all_col_dof(fct);
+			return numRow * numCol;
+		}
+
+	///	returns a hash of the global indices of a local matrix
+		static size_t indices_key(const LocalMatrix& lmat)
+		{
+			const LocalIndices& rowInd = lmat.get_row_indices();
+			const LocalIndices& colInd = lmat.get_col_indices();
+
+			size_t key = 17;
+			for(size_t fct=0; fct < lmat.num_all_row_fct(); ++fct)
+				for(size_t dof=0; dof < lmat.num_all_row_dof(fct); ++dof)
+					key = key * 31 + rowInd.index(fct,dof) * 7 + rowInd.comp(fct,dof);
+			for(size_t fct=0; fct < lmat.num_all_col_fct(); ++fct)
+				for(size_t dof=0; dof < lmat.num_all_col_dof(fct); ++dof)
+					key = key * 37 + colInd.index(fct,dof) * 7 + colInd.comp(fct,dof);
+			return key;
+		}
+
+	///	looks up the value slots of a local matrix and adds its values
+		bool record(matrix_type& mat, const LocalMatrix& lmat)
+		{
+			const LocalIndices& rowInd = lmat.get_row_indices();
+			const LocalIndices& colInd = lmat.get_col_indices();
+			const int* rowStart = mat.crs_row_start();
+			const int* cols = mat.crs_cols();
+
+		//	look up all slots first, so that nothing is added on failure
+			const size_t first = m_vSlot.size();
+			for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+				for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+				{
+					const size_t rowIndex = rowInd.index(fct1,dof1);
+					const int* rowBegin = cols + rowStart[rowIndex];
+					const int* rowEnd = cols + rowStart[rowIndex+1];
+
+					for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+						for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+						{
+							const int colIndex = (int) colInd.index(fct2,dof2);
+							const int* it = std::lower_bound(rowBegin, rowEnd, colIndex);
+							if(it == rowEnd || *it != colIndex)
+							{
+							//	entry not in pattern
+								m_vSlot.resize(first);
+								return false;
+							}
+							m_vSlot.push_back((int)(it - cols));
+						}
+				}
+
+			m_vOffset.push_back(m_vSlot.size());
+			m_vKey.push_back(indices_key(lmat));
+
+			if(m_vSlot.size() > first)
+				scatter(mat, lmat, &m_vSlot[0] + first);
+			return true;
+		}
+
+	///	adds the values of a local matrix using the recorded slots
+		bool replay(matrix_type& mat, const LocalMatrix& lmat)
+		{
+			if(m_cursor + 1 >= m_vOffset.size()) return false;
+			if(m_vKey[m_cursor] != indices_key(lmat)) return false;
+
+			const size_t first = m_vOffset[m_cursor];
+			if(m_vOffset[m_cursor+1] - first != num_entries(lmat))
+				return false;
+
+			if(m_vOffset[m_cursor+1] > first)
+				scatter(mat, lmat, &m_vSlot[0] + first);
+			++m_cursor;
+			return true;
+		}
+
+	///	adds the values of a local matrix into the given value slots
+		static void scatter(matrix_type& mat, const LocalMatrix& lmat, const int* pSlot)
+		{
+			const LocalIndices& rowInd = lmat.get_row_indices();
+			const LocalIndices& colInd = lmat.get_col_indices();
+			value_type* values = mat.crs_values();
+
+			for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+				for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+				{
+					const size_t rowComp = rowInd.comp(fct1,dof1);
+
+					for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+						for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+						{
+							const size_t colComp = colInd.comp(fct2,dof2);
+							BlockRef(values[*pSlot++], rowComp, colComp)
+										+= lmat.value(fct1,dof1,fct2,dof2);
+						}
+				}
+		}
+
+	protected:
+	///	state of the cache
+		enum CacheState {SC_EMPTY, SC_PATTERN, SC_MAP};
+
+	///	mode of the current assembly
+		enum CacheMode {SC_GENERIC, SC_RECORD, SC_REPLAY};
+
+	///	cached matrix
+		const matrix_type* m_pMat;
+
+	///	revision of the DoFDistribution the pattern belongs to
+		RevisionCounter m_revision;
+
+	///	number of indices the pattern belongs to
+		size_t m_numIndex;
+
+	///	current state and mode
+		CacheState m_state;
+		CacheMode m_mode;
+
+	///	flag indicating that the scatter map could not be used completely
+		bool m_bFailed;
+
+	///	index of the next local matrix to replay
+		size_t m_cursor;
+
+	///	value slots of all recorded local matrices
+		std::vector<int> m_vSlot;
+
+	///	offset of each local matrix in m_vSlot (size: #local matrices + 1)
+		std::vector<size_t> m_vOffset;
+
+	///	hash of the global indices of each local matrix
+		std::vector<size_t> m_vKey;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__MATRIX_SCATTER_CACHE__ */
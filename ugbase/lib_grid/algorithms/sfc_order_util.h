@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_GRID__SFC_ORDER_UTIL__
+#define __H__UG__LIB_GRID__SFC_ORDER_UTIL__
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "common/types.h"
+#include "common/error.h"
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/multi_grid.h"
+#include "lib_grid/tools/subset_handler_interface.h"
+#include "lib_grid/algorithms/geom_obj_util/misc_util.h"
+#ifdef UG_PARALLEL
+	#include "lib_grid/parallelization/distributed_grid.h"
+#endif
+
+namespace ug{
+
+///	returns the position of p on a Morton (Z-order) space filling curve
+/**	The curve covers the box given by minCorner and extent. Each coordinate
+ * is quantized to 63/dim bits.*/
+template <class vector_t>
+uint64 MortonKey(const vector_t& p, const vector_t& minCorner,
+				 const vector_t& extent)
+{
+	const size_t dim = vector_t::Size;
+	const size_t bitsPerDim = 63 / dim;
+	const number maxCoord = (number)((uint64(1) << bitsPerDim) - 1);
+
+	uint64 q[vector_t::Size];
+	for(size_t d = 0; d < dim; ++d){
+		number t = 0;
+		if(extent[d] > 0)
+			t = (p[d] - minCorner[d]) / extent[d];
+		if(t < 0) t = 0;
+		if(t > 1) t = 1;
+		q[d] = (uint64)(t * maxCoord);
+	}
+
+	uint64 key = 0;
+	for(size_t b = bitsPerDim; b > 0; --b){
+		for(size_t d = 0; d < dim; ++d)
+			key = (key << 1) | ((q[d] >> (b - 1)) & 1);
+	}
+	return key;
+}
+
+
+///	compares pairs of space filling curve keys and elements by their keys only
+template <class TElem>
+struct CompareSFCKey{
+	bool operator()(const std::pair<uint64, TElem*>& a,
+					const std::pair<uint64, TElem*>& b) const
+	{return a.first < b.first;}
+};
+
+
+///	reorders the elements of type TElem along a Morton space filling curve
+/**	The elements are sorted by the position of their centers on the curve.
+ * Afterwards the iteration order of the grid and the order in which the
+ * attached data of those elements is stored follow the curve
+ * (see Grid::reorder_elements). The attached data of elements which are
+ * close to each other in space is thus also close to each other in memory.
+ *
+ * Note that only the element lists are relinked. The element objects
+ * themselves are not moved, i.e. they stay in the slabs of the object pools
+ * in which they were created (see GridObjectPool). To also store the objects
+ * in the order of the curve, use CompactGridBySFC.
+ *
+ * If grid is a MultiGrid, the elements on each level are reordered, too.
+ * If a subset handler is specified, the elements of each of its subsets are
+ * reordered as well.
+ *
+ * Note that the elements of all other subset handlers, selectors etc. keep
+ * their previous order. Call this method before e.g. DoFs are distributed.*/
+template <class TElem, class TAAPos>
+void OrderElementsBySFC(Grid& grid, TAAPos aaPos, ISubsetHandler* psh = NULL)
+{
+	typedef typename TAAPos::ValueType	vector_t;
+	typedef typename Grid::traits<TElem>::iterator	iter_t;
+
+	if(grid.num<TElem>() == 0)
+		return;
+
+//	the bounding box of all vertices
+	vector_t minCorner = aaPos[*grid.vertices_begin()];
+	vector_t maxCorner = minCorner;
+	for(VertexIterator iter = grid.vertices_begin();
+		iter != grid.vertices_end(); ++iter)
+	{
+		const vector_t& p = aaPos[*iter];
+		for(size_t d = 0; d < vector_t::Size; ++d){
+			minCorner[d] = std::min(minCorner[d], p[d]);
+			maxCorner[d] = std::max(maxCorner[d], p[d]);
+		}
+	}
+
+	vector_t extent;
+	VecSubtract(extent, maxCorner, minCorner);
+
+	std::vector<std::pair<uint64, TElem*> > vKeys;
+	vKeys.reserve(grid.num<TElem>());
+	for(iter_t iter = grid.begin<TElem>(); iter != grid.end<TElem>(); ++iter){
+		TElem* e = *iter;
+		vKeys.push_back(std::make_pair(
+			MortonKey(CalculateGridObjectCenter(e, aaPos), minCorner, extent), e));
+	}
+
+	std::stable_sort(vKeys.begin(), vKeys.end(), CompareSFCKey<TElem>());
+
+	std::vector<TElem*> vElems(vKeys.size());
+	for(size_t i = 0; i < vKeys.size(); ++i)
+		vElems[i] = vKeys[i].second;
+
+	grid.reorder_elements(vElems);
+
+//	assigning an element to its current subset moves it to the end of the
+//	associated section of that subset.
+	MultiGrid* pmg = dynamic_cast<MultiGrid*>(&grid);
+	if(pmg){
+		GridSubsetHandler& hierarchy = pmg->get_hierarchy_handler();
+		for(size_t i = 0; i < vElems.size(); ++i)
+			hierarchy.assign_subset(vElems[i], pmg->get_level(vElems[i]));
+	}
+
+	if(psh){
+		for(size_t i = 0; i < vElems.size(); ++i){
+			const int si = psh->get_subset_index(vElems[i]);
+			if(si != -1)
+				psh->assign_subset(vElems[i], si);
+		}
+	}
+}
+
+///	reorders vertices, edges, faces and volumes along a Morton space filling curve
+/**	\sa OrderElementsBySFC*/
+template <class TAAPos>
+void OrderGridBySFC(Grid& grid, TAAPos aaPos, ISubsetHandler* psh = NULL)
+{
+	OrderElementsBySFC<Vertex>(grid, aaPos, psh);
+	OrderElementsBySFC<Edge>(grid, aaPos, psh);
+	OrderElementsBySFC<Face>(grid, aaPos, psh);
+	OrderElementsBySFC<Volume>(grid, aaPos, psh);
+}
+
+
+///	creates a new vertex of the same type as v
+inline Vertex* SFCCloneElement(Grid& grid, Vertex* v, const std::vector<Vertex*>&)
+{
+	return *grid.create_by_cloning(v);
+}
+
+///	creates a new edge of the same type as e, connecting the mapped corners of e
+inline Edge* SFCCloneElement(Grid& grid, Edge* e, const std::vector<Vertex*>& vrtMap)
+{
+	return *grid.create_by_cloning(e, EdgeDescriptor(
+						vrtMap[grid.get_attachment_data_index(e->vertex(0))],
+						vrtMap[grid.get_attachment_data_index(e->vertex(1))]));
+}
+
+///	creates a new face of the same type as f, connecting the mapped corners of f
+inline Face* SFCCloneElement(Grid& grid, Face* f, const std::vector<Vertex*>& vrtMap)
+{
+	FaceDescriptor fd(f->num_vertices());
+	for(size_t i = 0; i < f->num_vertices(); ++i)
+		fd.set_vertex(i, vrtMap[grid.get_attachment_data_index(f->vertex(i))]);
+	return *grid.create_by_cloning(f, fd);
+}
+
+///	creates a new volume of the same type as v, connecting the mapped corners of v
+inline Volume* SFCCloneElement(Grid& grid, Volume* v, const std::vector<Vertex*>& vrtMap)
+{
+	VolumeDescriptor vd(v->num_vertices());
+	for(size_t i = 0; i < v->num_vertices(); ++i)
+		vd.set_vertex(i, vrtMap[grid.get_attachment_data_index(v->vertex(i))]);
+	return *grid.create_by_cloning(v, vd);
+}
+
+///	replaces each element of type TElem by a new one, created in iteration order
+/**	The values of attachments which are passed on and the subsets of the
+ * given subset handlers are copied to the new elements. The old elements are
+ * returned in vOldOut. They are not erased.*/
+template <class TElem>
+void SFCCloneElements(Grid& grid, std::vector<TElem*>& vOldOut,
+					  std::vector<TElem*>& vNewOut,
+					  const std::vector<Vertex*>& vrtMap,
+					  const std::vector<ISubsetHandler*>& vSH)
+{
+	vOldOut.assign(grid.begin<TElem>(), grid.end<TElem>());
+	vNewOut.resize(vOldOut.size());
+	for(size_t i = 0; i < vOldOut.size(); ++i){
+		TElem* e = vOldOut[i];
+		UG_COND_THROW(e->is_constrained() || e->is_constraining(),
+					  "CompactGridBySFC: grids with constrained elements can not be compacted.");
+
+		TElem* n = SFCCloneElement(grid, e, vrtMap);
+		grid.pass_on_values(e, n);
+		for(size_t j = 0; j < vSH.size(); ++j)
+			vSH[j]->assign_subset(n, vSH[j]->get_subset_index(e));
+		vNewOut[i] = n;
+	}
+}
+
+///	reorders the grid along a Morton space filling curve and compacts its object pools
+/**	After OrderGridBySFC, each element is replaced by a copy, in iteration
+ * order. The copies are stored in new slabs of the object pools of the grid
+ * (see Grid::retire_object_slabs), the old slabs are released with the old
+ * elements. Afterwards the objects of each type lie in memory in the order
+ * of the curve, i.e. the memory order matches the iteration order.
+ *
+ * Since the elements are replaced, all pointers to the old elements become
+ * invalid. The positions, the values of attachments which are passed on
+ * (see Grid::attach_to) and the subsets of the given subset handlers are
+ * copied. All other information associated with the elements (e.g. in
+ * selectors) is lost. Call this method directly after the grid was created
+ * or loaded.
+ *
+ * Only grids without constrained elements can be compacted. A MultiGrid
+ * must only have one level and in parallel, the grid must not be distributed.*/
+template <class TAAPos>
+void CompactGridBySFC(Grid& grid, TAAPos aaPos,
+					  const std::vector<ISubsetHandler*>& vSH)
+{
+	MultiGrid* pmg = dynamic_cast<MultiGrid*>(&grid);
+	UG_COND_THROW(pmg && pmg->num_levels() > 1,
+				  "CompactGridBySFC: only multigrids with one level can be compacted.");
+#ifdef UG_PARALLEL
+	DistributedGridManager* dgm = grid.distributed_grid_manager();
+	if(dgm){
+		for(VertexIterator iter = grid.vertices_begin(); iter != grid.vertices_end(); ++iter)
+			UG_COND_THROW(dgm->get_status(*iter) != ES_NONE,
+						  "CompactGridBySFC: distributed grids can not be compacted.");
+	}
+#endif
+
+	OrderGridBySFC(grid, aaPos);
+
+	grid.retire_object_slabs();
+
+	std::vector<Vertex*> vOldVrts, vNewVrts;
+	std::vector<Vertex*> vrtMap(grid.attachment_container_size<Vertex>(), NULL);
+	SFCCloneElements(grid, vOldVrts, vNewVrts, vrtMap, vSH);
+	for(size_t i = 0; i < vOldVrts.size(); ++i){
+		aaPos[vNewVrts[i]] = aaPos[vOldVrts[i]];
+		vrtMap[grid.get_attachment_data_index(vOldVrts[i])] = vNewVrts[i];
+	}
+
+	std::vector<Edge*> vOldEdges, vNewEdges;
+	SFCCloneElements(grid, vOldEdges, vNewEdges, vrtMap, vSH);
+	std::vector<Face*> vOldFaces, vNewFaces;
+	SFCCloneElements(grid, vOldFaces, vNewFaces, vrtMap, vSH);
+	std::vector<Volume*> vOldVols, vNewVols;
+	SFCCloneElements(grid, vOldVols, vNewVols, vrtMap, vSH);
+
+//	erase the old elements. This releases the retired slabs.
+	for(size_t i = 0; i < vOldVols.size(); ++i)
+		grid.erase(vOldVols[i]);
+	for(size_t i = 0; i < vOldFaces.size(); ++i)
+		grid.erase(vOldFaces[i]);
+	for(size_t i = 0; i < vOldEdges.size(); ++i)
+		grid.erase(vOldEdges[i]);
+	for(size_t i = 0; i < vOldVrts.size(); ++i)
+		grid.erase(vOldVrts[i]);
+}
+
+}//	end of namespace
+
+#endif
@@ -35,6 +35,7 @@
 
 #include "common/types.h"
 #include "lib_grid/algorithms/geom_obj_util/face_util.h"
+#include "lib_grid/tools/flat_topology.h"
 #include "../volume_calculation.h"
 
 namespace ug{
@@ -333,6 +334,50 @@ void TangentialSmooth(Grid& g, TVrtIter vrtsBegin, TVrtIter vrtsEnd,
 }
 
 
+////////////////////////////////////////////////////////////////////////
+///	moves vrt towards the weighted average of its neighbors connVrts
+/**	used by WeightedEdgeSmooth.*/
+template <class AAPosVRT>
+void WeightedEdgeSmoothVertex(Vertex* vrt, const std::vector<Vertex*>& connVrts,
+					AAPosVRT& aaPos, number alpha,
+					Grid::vertex_traits::callback cbSmoothVertex)
+{
+	typedef typename AAPosVRT::ValueType vector_t;
+
+	vector_t vrtPos = aaPos[vrt];
+	vector_t avDir;
+	VecSet(avDir, 0);
+	number weight = 0;
+
+//	calculate smoothing vector relative to neighbors
+	number numNonSmooth = 0;
+	for(size_t i = 0; i < connVrts.size(); ++i){
+		if(!cbSmoothVertex(connVrts[i]))
+			numNonSmooth += 1;
+	}
+
+	number nonSmoothWeight = 1. / std::max<number>(1, numNonSmooth);
+
+	for(size_t i = 0; i < connVrts.size(); ++i){
+		Vertex* connVrt = connVrts[i];
+		number w = 1;
+		if(!cbSmoothVertex(connVrt))
+			w = nonSmoothWeight;
+
+		vector_t dir;
+		VecSubtract(dir, aaPos[connVrt], vrtPos);
+		w *= VecLengthSq(dir);
+		dir *= w;
+		VecAdd(avDir, avDir, dir);
+		weight += w;
+	}
+
+	if(weight > 0){
+		avDir *= alpha / weight;
+		VecAdd(aaPos[vrt], vrtPos, avDir);
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////
 /** vertices which will not be smoothed get a special weight when being considered
  * during smoothing of neighbored vertices.
@@ -346,49 +391,63 @@ void WeightedEdgeSmooth(Grid& grid, TIterator vrtsBegin,
 					number alpha, int numIterations,
 					Grid::vertex_traits::callback cbSmoothVertex)
 {
-	typedef typename AAPosVRT::ValueType vector_t;
-
 	Grid::edge_traits::secure_container edges;
+	std::vector<Vertex*> connVrts;
 
 	for(int iteration = 0; iteration < numIterations; ++iteration){
 	//	iterate through all vertices
 		for(TIterator iter = vrtsBegin; iter != vrtsEnd; ++iter){
 		//	smooth each one
 			Vertex* vrt = *iter;
-			vector_t vrtPos = aaPos[vrt];
-			vector_t avDir;
-			VecSet(avDir, 0);
-			number weight = 0;
-
-		//	calculate smoothing vector relative to neighbors
 			grid.associated_elements(edges, vrt);
-			number numNonSmooth = 0;
-			for(size_t i = 0; i < edges.size(); ++i){
-				Vertex* connVrt = GetConnectedVertex(edges[i], vrt);
-				if(!cbSmoothVertex(connVrt))
-					numNonSmooth += 1;
-			}
+			connVrts.clear();
+			for(size_t i = 0; i < edges.size(); ++i)
+				connVrts.push_back(GetConnectedVertex(edges[i], vrt));
 
-			number nonSmoothWeight = 1. / std::max<number>(1, numNonSmooth);
+			WeightedEdgeSmoothVertex(vrt, connVrts, aaPos, alpha, cbSmoothVertex);
+		}
+	}
+}
 
-			for(size_t i = 0; i < edges.size(); ++i){
-				Vertex* connVrt = GetConnectedVertex(edges[i], vrt);
-				number w = 1;
-				if(!cbSmoothVertex(connVrt))
-					w = nonSmoothWeight;
+////////////////////////////////////////////////////////////////////////
+/** Same as the version above, however, the neighbors of each vertex are taken
+ * from the given snapshot of the grid instead of being collected from its
+ * associated edges in each iteration. Callers which smooth repeatedly can
+ * thus build the snapshot once.
+ *
+ * topo has to be a valid snapshot of grid.
+ */
+template <class TIterator, class AAPosVRT>
+void WeightedEdgeSmooth(Grid& grid, TIterator vrtsBegin,
+					TIterator vrtsEnd, AAPosVRT& aaPos,
+					number alpha, int numIterations,
+					Grid::vertex_traits::callback cbSmoothVertex,
+					const FlatTopology& topo)
+{
+	UG_COND_THROW(!topo.valid() || topo.grid() != &grid,
+				  "WeightedEdgeSmooth: The topology is not a valid snapshot of the grid.");
 
-				vector_t dir;
-				VecSubtract(dir, aaPos[connVrt], vrtPos);
-				w *= VecLengthSq(dir);
-				dir *= w;
-				VecAdd(avDir, avDir, dir);
-				weight += w;
-			}
+	std::vector<Vertex*> connVrts;
 
-			if(weight > 0){
-				avDir *= alpha / weight;
-				VecAdd(aaPos[vrt], vrtPos, avDir);
+	for(int iteration = 0; iteration < numIterations; ++iteration){
+	//	iterate through all vertices
+		for(TIterator iter = vrtsBegin; iter != vrtsEnd; ++iter){
+		//	smooth each one
+			Vertex* vrt = *iter;
+
+		//	collect the vertices connected to vrt by an edge
+			const size_t lvl = topo.level_of(vrt);
+			const int vrtID = topo.id(vrt);
+			const FlatTopology::Table& vrtEdges = topo.associated<Edge>(lvl);
+			const FlatTopology::Table& edgeVrts = topo.vertices<Edge>(lvl);
+			connVrts.clear();
+			for(const int* e = vrtEdges.begin(vrtID); e != vrtEdges.end(vrtID); ++e){
+				const int connID = (edgeVrts(*e, 0) == vrtID) ? edgeVrts(*e, 1)
+															 : edgeVrts(*e, 0);
+				connVrts.push_back(topo.element<Vertex>(lvl, connID));
 			}
+
+			WeightedEdgeSmoothVertex(vrt, connVrts, aaPos, alpha, cbSmoothVertex);
 		}
 	}
 }
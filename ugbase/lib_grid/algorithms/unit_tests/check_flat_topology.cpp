@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include "check_flat_topology.h"
+#include "lib_grid/tools/flat_topology.h"
+
+namespace ug{
+namespace grid_unit_tests{
+
+///	returns the sorted ids of the given elements
+template <class TContainer>
+static void CollectSortedIDs(std::vector<int>& idsOut, const FlatTopology& topo,
+							 TContainer& elems)
+{
+	idsOut.clear();
+	for(size_t i = 0; i < elems.size(); ++i)
+		idsOut.push_back(topo.id(elems[i]));
+	std::sort(idsOut.begin(), idsOut.end());
+}
+
+template <class TElem>
+static void CheckFlatTopologyOfElems(Grid& g, const FlatTopology& topo, size_t lvl)
+{
+	typedef typename TElem::side	side_t;
+	typename Grid::traits<Vertex>::secure_container	vrts;
+	typename Grid::traits<side_t>::secure_container	sides;
+	typename Grid::traits<TElem>::secure_container	elems;
+	std::vector<int> vIDs, vTableIDs;
+
+	const FlatTopology::Table& ev = topo.vertices<TElem>(lvl);
+	const FlatTopology::Table& es = topo.sides<TElem>(lvl);
+	const FlatTopology::Table& ve = topo.associated<TElem>(lvl);
+
+	if(ev.num_rows() != topo.num<TElem>(lvl) || es.num_rows() != topo.num<TElem>(lvl))
+		UG_THROW("Element tables of level " << lvl << " do not have one row per element.");
+
+	for(size_t i = 0; i < topo.num<TElem>(lvl); ++i){
+		TElem* e = topo.element<TElem>(lvl, (int)i);
+		if(topo.id(e) != (int)i || topo.level_of(e) != lvl)
+			UG_THROW("Id or level of element " << i << " on level " << lvl << " is wrong.");
+
+	//	vertices have to match in the order of the element's corners
+		g.associated_elements_sorted(vrts, e);
+		if(ev.num_entries(i) != vrts.size())
+			UG_THROW("Wrong number of vertices of element " << i << " on level " << lvl << ".");
+		for(size_t j = 0; j < vrts.size(); ++j){
+			if(ev(i, j) != topo.id(vrts[j]))
+				UG_THROW("Vertex " << j << " of element " << i << " on level "
+						 << lvl << " doesn't match the associated vertex.");
+		}
+
+	//	existing sides have to match the associated sides
+		g.associated_elements(sides, e);
+		CollectSortedIDs(vIDs, topo, sides);
+		vTableIDs.clear();
+		for(const int* iter = es.begin(i); iter != es.end(i); ++iter){
+			if(*iter >= 0)
+				vTableIDs.push_back(*iter);
+		}
+		std::sort(vTableIDs.begin(), vTableIDs.end());
+		if(vIDs != vTableIDs)
+			UG_THROW("Sides of element " << i << " on level " << lvl
+					 << " don't match the associated sides.");
+	}
+
+//	the elements of each vertex have to match its associated elements
+	if(ve.num_rows() != topo.num<Vertex>(lvl))
+		UG_THROW("Vertex table of level " << lvl << " does not have one row per vertex.");
+
+	for(size_t i = 0; i < topo.num<Vertex>(lvl); ++i){
+		g.associated_elements(elems, topo.element<Vertex>(lvl, (int)i));
+		CollectSortedIDs(vIDs, topo, elems);
+		vTableIDs.assign(ve.begin(i), ve.end(i));
+		std::sort(vTableIDs.begin(), vTableIDs.end());
+		if(vIDs != vTableIDs)
+			UG_THROW("Elements of vertex " << i << " on level " << lvl
+					 << " don't match the associated elements.");
+	}
+}
+
+void CheckFlatTopology(Grid& g)
+{
+	FlatTopology topo(g);
+	if(!topo.valid())
+		UG_THROW("FlatTopology could not be built.");
+
+	for(size_t lvl = 0; lvl < topo.num_levels(); ++lvl){
+		CheckFlatTopologyOfElems<Edge>(g, topo, lvl);
+		CheckFlatTopologyOfElems<Face>(g, topo, lvl);
+		CheckFlatTopologyOfElems<Volume>(g, topo, lvl);
+	}
+
+//	any change of a grid has to invalidate the snapshot. We use a separate
+//	grid here, so that g is left untouched.
+	Grid tmpGrid;
+	Vertex* v0 = *tmpGrid.create<RegularVertex>();
+	Vertex* v1 = *tmpGrid.create<RegularVertex>();
+	tmpGrid.create<RegularEdge>(EdgeDescriptor(v0, v1));
+	FlatTopology tmpTopo(tmpGrid);
+	if(tmpTopo.vertices<Edge>(0)(0, 1) != tmpTopo.id(v1))
+		UG_THROW("Wrong vertex id in the FlatTopology of a single edge.");
+	tmpGrid.create<RegularVertex>();
+	if(tmpTopo.valid())
+		UG_THROW("FlatTopology wasn't invalidated by the creation of a vertex.");
+}
+
+}//	end of namespace
+}//	end of namespace
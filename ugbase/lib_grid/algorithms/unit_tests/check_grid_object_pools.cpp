@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <cstddef>
+#include <typeinfo>
+#include "check_grid_object_pools.h"
+#include "lib_grid/grid/grid_object_pool.h"
+#include "lib_grid/algorithms/sfc_order_util.h"
+
+namespace ug{
+namespace grid_unit_tests{
+
+static void CheckGridObjectPool()
+{
+	GridObjectPool pool(3 * sizeof(void*));
+	const size_t bps = pool.blocks_per_slab();
+	const size_t num = 2 * bps + 1;
+	char* slab;
+
+//	consecutive blocks have to be adjacent inside a slab
+	std::vector<char*> vBlocks(num);
+	size_t numNewSlabs = 0;
+	for(size_t i = 0; i < num; ++i){
+		vBlocks[i] = static_cast<char*>(pool.allocate(slab));
+		if(slab)
+			++numNewSlabs;
+		if(i % bps != 0 && vBlocks[i] != vBlocks[i-1] + pool.block_size())
+			UG_THROW("Block " << i << " of a pool is not adjacent to its predecessor.");
+	}
+	if(numNewSlabs != 3 || pool.num_slabs() != 3 || pool.num_allocated() != num)
+		UG_THROW("Wrong number of slabs or blocks after " << num << " allocations.");
+
+//	freed blocks have to be reused
+	pool.deallocate(vBlocks[1]);
+	if(pool.allocate(slab) != vBlocks[1] || slab)
+		UG_THROW("A freed block of a pool was not reused.");
+
+//	an emptied pool keeps its first slab
+	for(size_t i = 0; i < num; ++i)
+		pool.deallocate(vBlocks[i]);
+	if(pool.num_allocated() != 0 || pool.num_slabs() != 1)
+		UG_THROW("An emptied pool doesn't hold exactly one slab.");
+
+	vBlocks.resize(3);
+	for(size_t i = 0; i < vBlocks.size(); ++i)
+		vBlocks[i] = static_cast<char*>(pool.allocate(slab));
+	if(vBlocks[0] != pool.slabs()[0] || slab)
+		UG_THROW("The slab of an emptied pool was not reused.");
+
+//	retired slabs are not reused and released with their last block
+	pool.retire_slabs();
+	void* p = pool.allocate(slab);
+	if(!slab || pool.is_retired(p) || !pool.is_retired(vBlocks[0])
+		|| pool.num_retired() != 3 || pool.num_allocated() != 4 || pool.num_slabs() != 2)
+		UG_THROW("A block was allocated from a retired slab.");
+
+	for(size_t i = 0; i < vBlocks.size(); ++i){
+		const bool released = pool.deallocate(vBlocks[i]);
+		if(released != (i + 1 == vBlocks.size()))
+			UG_THROW("Retired slabs were not released together with their last block.");
+	}
+	if(pool.num_retired() != 0 || !pool.retired_slabs().empty()
+		|| pool.num_allocated() != 1 || pool.num_slabs() != 1)
+		UG_THROW("Wrong number of slabs or blocks after releasing the retired slabs.");
+	pool.deallocate(p);
+}
+
+
+static void CheckGridObjectAllocator()
+{
+	GridObjectAllocator alloc;
+	RegularVertex* v0 = alloc.create<RegularVertex>();
+	RegularVertex* v1 = alloc.create<RegularVertex>();
+	RegularEdge* e = alloc.create<RegularEdge>(EdgeDescriptor(v0, v1));
+	RegularVertex* vExt = new RegularVertex;
+
+	if(e->vertex(0) != v0 || e->vertex(1) != v1)
+		UG_THROW("An edge created by a GridObjectAllocator has wrong corners.");
+	if(!alloc.owns(v0) || !alloc.owns(v1) || !alloc.owns(e) || alloc.owns(vExt))
+		UG_THROW("A GridObjectAllocator doesn't recognize its objects.");
+
+	const size_t capacity = alloc.capacity();
+	if(capacity == 0)
+		UG_THROW("Wrong capacity of a GridObjectAllocator.");
+
+//	the slabs of retired objects are released with the last of those objects
+	alloc.retire_slabs();
+	RegularVertex* v2 = alloc.create<RegularVertex>();
+	if(!alloc.owns(v2) || alloc.capacity() <= capacity)
+		UG_THROW("A GridObjectAllocator didn't use a new slab after retiring its slabs.");
+
+	alloc.destroy(e);
+	alloc.destroy(v0);
+	alloc.destroy(v1);
+	alloc.destroy(vExt);
+	if(alloc.capacity() >= capacity || !alloc.owns(v2))
+		UG_THROW("A GridObjectAllocator didn't release its retired slabs.");
+	alloc.destroy(v2);
+}
+
+
+///	checks that the elements of each type are stored in iteration order
+/**	Elements of the same type which are iterated one after another have
+ * to be adjacent in memory, except when a new slab is started.*/
+template <class TElem>
+static void CheckMemoryOrder(Grid& g, const char* when)
+{
+	typedef typename Grid::traits<TElem>::iterator	iter_t;
+
+	const char* prev = NULL;
+	const std::type_info* prevType = NULL;
+	ptrdiff_t step = 0;
+	size_t runLength = 0;
+	size_t numBreaks = 0;
+	for(iter_t iter = g.begin<TElem>();; ++iter){
+		const bool atEnd = (iter == g.end<TElem>());
+		const std::type_info* type = atEnd ? NULL : &typeid(**iter);
+
+	//	a run of elements of the same type ends
+		if(runLength > 1 && (atEnd || *type != *prevType)){
+			if(step <= 0 || numBreaks > (runLength - 1)
+									/ GridObjectPool((size_t)step).blocks_per_slab())
+				UG_THROW(when << ": " << runLength << " elements of type "
+						 << prevType->name() << " are not stored in iteration order.");
+		}
+		if(atEnd)
+			break;
+
+		const char* cur = static_cast<const char*>(dynamic_cast<const void*>(*iter));
+		if(!prevType || *type != *prevType){
+			runLength = 1;
+			numBreaks = 0;
+			step = 0;
+		}
+		else{
+			if(runLength == 1)
+				step = cur - prev;
+			else if(cur - prev != step)
+				++numBreaks;
+			++runLength;
+		}
+		prev = cur;
+		prevType = type;
+	}
+}
+
+template <class TElem>
+static bool HasConstrainedElements(Grid& g)
+{
+	typedef typename Grid::traits<TElem>::iterator	iter_t;
+	for(iter_t iter = g.begin<TElem>(); iter != g.end<TElem>(); ++iter){
+		if((*iter)->is_constrained() || (*iter)->is_constraining())
+			return true;
+	}
+	return false;
+}
+
+static void CheckNumElements(Grid& g, size_t numVrts, size_t numEdges,
+							 size_t numFaces, size_t numVols, const char* when)
+{
+	if(g.num<Vertex>() != numVrts || g.num<Edge>() != numEdges
+		|| g.num<Face>() != numFaces || g.num<Volume>() != numVols)
+		UG_THROW(when << ": wrong number of elements.");
+}
+
+template <class TAPos>
+static void CheckCompactGridBySFC(Grid& g, TAPos& aPos)
+{
+	typedef typename TAPos::ValueType	vector_t;
+	Grid::VertexAttachmentAccessor<TAPos> aaPos(g, aPos);
+
+	const size_t numVrts = g.num<Vertex>();
+	const size_t numEdges = g.num<Edge>();
+	const size_t numFaces = g.num<Face>();
+	const size_t numVols = g.num<Volume>();
+
+	vector_t sum, newSum;
+	VecSet(sum, 0);
+	for(VertexIterator iter = g.vertices_begin(); iter != g.vertices_end(); ++iter)
+		VecAdd(sum, sum, aaPos[*iter]);
+
+//	leave gaps in the vertex pool, which must not be filled by the compaction
+	std::vector<Vertex*> vTmp;
+	for(size_t i = 0; i < 10; ++i)
+		vTmp.push_back(*g.create<RegularVertex>());
+	for(size_t i = 0; i < vTmp.size(); ++i)
+		g.erase(vTmp[i]);
+
+	CompactGridBySFC(g, aaPos, std::vector<ISubsetHandler*>());
+
+	CheckNumElements(g, numVrts, numEdges, numFaces, numVols, "CompactGridBySFC");
+	VecSet(newSum, 0);
+	for(VertexIterator iter = g.vertices_begin(); iter != g.vertices_end(); ++iter)
+		VecAdd(newSum, newSum, aaPos[*iter]);
+	if(VecDistance(sum, newSum) > SMALL * (1 + VecLength(sum)))
+		UG_THROW("CompactGridBySFC: vertex positions were not copied.");
+
+	CheckMemoryOrder<Vertex>(g, "CompactGridBySFC");
+	CheckMemoryOrder<Edge>(g, "CompactGridBySFC");
+	CheckMemoryOrder<Face>(g, "CompactGridBySFC");
+	CheckMemoryOrder<Volume>(g, "CompactGridBySFC");
+}
+
+void CheckGridObjectPools(Grid& g)
+{
+	CheckGridObjectPool();
+	CheckGridObjectAllocator();
+
+//	a copy allocates its elements in iteration order
+	Grid copy;
+	copy = g;
+	CheckNumElements(copy, g.num<Vertex>(), g.num<Edge>(), g.num<Face>(),
+					 g.num<Volume>(), "Grid copy");
+	if(copy.num<Vertex>() > 0 && copy.object_pool_capacity() == 0)
+		UG_THROW("Grid copy: no elements were allocated from the object pools.");
+
+	CheckMemoryOrder<Vertex>(copy, "Grid copy");
+	CheckMemoryOrder<Edge>(copy, "Grid copy");
+	CheckMemoryOrder<Face>(copy, "Grid copy");
+	CheckMemoryOrder<Volume>(copy, "Grid copy");
+
+	if(HasConstrainedElements<Vertex>(copy) || HasConstrainedElements<Edge>(copy)
+		|| HasConstrainedElements<Face>(copy))
+		return;
+
+	if(copy.has_vertex_attachment(aPosition))
+		CheckCompactGridBySFC(copy, aPosition);
+	else if(copy.has_vertex_attachment(aPosition2))
+		CheckCompactGridBySFC(copy, aPosition2);
+	else if(copy.has_vertex_attachment(aPosition1))
+		CheckCompactGridBySFC(copy, aPosition1);
+}
+
+}//	end of namespace
+}//	end of namespace
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__check_grid_object_pools__
+#define __H__UG__check_grid_object_pools__
+
+#include "lib_grid/lg_base.h"
+
+namespace ug{
+namespace grid_unit_tests{
+/**
+ * checks the slab pools in which a grid stores its elements:
+ * - a GridObjectPool hands out adjacent blocks, reuses freed blocks, keeps
+ *   one slab when it was emptied and releases retired slabs together with
+ *   their last block,
+ * - a GridObjectAllocator creates and destroys objects of several types,
+ *   recognizes objects which it did not create and releases retired slabs,
+ * - a copy of g has the same number of elements as g and stores the elements
+ *   of each type in its pools in iteration order,
+ * - after CompactGridBySFC, the copy still has the same number of elements
+ *   and the same vertex positions and the elements are again stored in
+ *   iteration order, even though gaps were left in the pools. This is only
+ *   checked if the copy has a position attachment and no constrained elements.
+ *
+ * If something is wrong, the method throws an instance of UGError.
+ */
+void CheckGridObjectPools(Grid& g);
+}//	end of namespace
+}//	end of namespace
+
+#endif
@@ -387,8 +387,10 @@ class UG_API AttachmentPipe
 	 */
 		void unregister_element(const TElem& elem);
 
-	/**	Aligns data with elements and removes unused data-memory.*/
-		void defragment();
+	/**	Aligns data with elements and removes unused data-memory.
+	 * If force is true, the data is realigned with the current element
+	 * order even if the pipe is not fragmented.*/
+		void defragment(bool force = false);
 
 	/**\brief attaches a new data-array to the pipe.
 	 *
@@ -522,6 +524,8 @@ class UG_API AttachmentAccessor
 		AttachmentAccessor(const AttachmentAccessor& aa);
 		AttachmentAccessor(AttachmentPipe<TElem, TElemHandler>& attachmentPipe, TAttachment& attachment);
 
+		AttachmentAccessor& operator=(const AttachmentAccessor& aa);
+
 		bool access(attachment_pipe& attachmentPipe, TAttachment& attachment);
 
 		inline typename attachment_value_traits<ValueType>::reference
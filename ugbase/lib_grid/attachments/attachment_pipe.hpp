@@ -287,9 +287,9 @@ get_data_container(TAttachment& attachment)
 template <class TElem, class TElemHandler>
 void
 AttachmentPipe<TElem, TElemHandler>::
-defragment()
+defragment(bool force)
 {
-	if(!is_fragmented())
+	if(!force && !is_fragmented())
 		return;
 
 //	if num_elements == 0, then simply resize all data-containers to 0.
@@ -303,21 +303,27 @@ defragment()
 		}
 		m_stackFreeEntries = UINTStack();
 		m_numDataEntries = 0;
+		m_containerSize = 0;
 	}
 	else
 	{
 	//	calculate the fragmentation array. It has to be of the same size as the fragmented data containers.
-		std::vector<uint> vNewIndices(num_data_entries(), INVALID_ATTACHMENT_INDEX);
+		std::vector<size_t> vNewIndices(m_containerSize, INVALID_ATTACHMENT_INDEX);
 
-	//	iterate through the elements and calculate the new index of each
-		size_t counter = 0;
+	//	collect the elements first. The element container may itself store
+	//	its data in this pipe, so indices must not change during iteration.
+		std::vector<TElem> vElems;
+		vElems.reserve(num_elements());
 		typename atraits::element_iterator iter = atraits::elements_begin(m_pHandler);
 		typename atraits::element_iterator end = atraits::elements_end(m_pHandler);
+		for(; iter != end; ++iter)
+			vElems.push_back(*iter);
 
-		for(; iter != end; ++iter){
-			vNewIndices[atraits::get_data_index(m_pHandler, (*iter))] = counter;
-			atraits::set_data_index(m_pHandler, (*iter), counter);
-			++counter;
+	//	calculate the new index of each element
+		size_t counter = 0;
+		for(; counter < vElems.size(); ++counter){
+			vNewIndices[atraits::get_data_index(m_pHandler, vElems[counter])] = counter;
+			atraits::set_data_index(m_pHandler, vElems[counter], counter);
 		}
 
 	//	after defragmentation there are no free indices.
@@ -332,6 +338,7 @@ defragment()
 				(*iter).m_pContainer->defragment(&vNewIndices.front(), num_elements());
 			}
 		}
+		m_containerSize = num_elements();
 	}
 }
 
@@ -457,6 +464,16 @@ AttachmentAccessor(const AttachmentAccessor& aa)
 	m_pHandler = aa.m_pHandler;
 }
 
+template <class TElem, class TAttachment, class TElemHandler>
+AttachmentAccessor<TElem, TAttachment, TElemHandler>&
+AttachmentAccessor<TElem, TAttachment, TElemHandler>::
+operator=(const AttachmentAccessor& aa)
+{
+	m_pContainer = aa.m_pContainer;
+	m_pHandler = aa.m_pHandler;
+	return *this;
+}
+
 template <class TElem, class TAttachment, class TElemHandler>
 AttachmentAccessor<TElem, TAttachment, TElemHandler>::
 AttachmentAccessor(AttachmentPipe<TElem, TElemHandler>& attachmentPipe, TAttachment& attachment)
@@ -418,14 +418,18 @@ void Grid::assign_grid(const Grid& grid)
 
 VertexIterator Grid::create_by_cloning(Vertex* pCloneMe, GridObject* pParent)
 {
-	Vertex* pNew = reinterpret_cast<Vertex*>(pCloneMe->create_empty_instance());
+	Vertex* pNew = reinterpret_cast<Vertex*>(pCloneMe->create_empty_instance(m_objectAllocator));
+	if(!pNew)
+		pNew = reinterpret_cast<Vertex*>(pCloneMe->create_empty_instance());
 	register_vertex(pNew, pParent);
 	return iterator_cast<VertexIterator>(get_iterator(pNew));
 }
 
 EdgeIterator Grid::create_by_cloning(Edge* pCloneMe, const IVertexGroup& ev, GridObject* pParent)
 {
-	Edge* pNew = reinterpret_cast<Edge*>(pCloneMe->create_empty_instance());
+	Edge* pNew = reinterpret_cast<Edge*>(pCloneMe->create_empty_instance(m_objectAllocator));
+	if(!pNew)
+		pNew = reinterpret_cast<Edge*>(pCloneMe->create_empty_instance());
 	pNew->set_vertex(0, ev.vertex(0));
 	pNew->set_vertex(1, ev.vertex(1));
 	register_edge(pNew, pParent);
@@ -434,7 +438,9 @@ EdgeIterator Grid::create_by_cloning(Edge* pCloneMe, const IVertexGroup& ev, Gri
 
 FaceIterator Grid::create_by_cloning(Face* pCloneMe, const IVertexGroup& fv, GridObject* pParent)
 {
-	Face* pNew = reinterpret_cast<Face*>(pCloneMe->create_empty_instance());
+	Face* pNew = reinterpret_cast<Face*>(pCloneMe->create_empty_instance(m_objectAllocator));
+	if(!pNew)
+		pNew = reinterpret_cast<Face*>(pCloneMe->create_empty_instance());
 	uint numVrts = fv.num_vertices();
 	Face::ConstVertexArray vrts = fv.vertices();
 	for(uint i = 0; i < numVrts; ++i)
@@ -445,7 +451,9 @@ FaceIterator Grid::create_by_cloning(Face* pCloneMe, const IVertexGroup& fv, Gri
 
 VolumeIterator Grid::create_by_cloning(Volume* pCloneMe, const IVertexGroup& vv, GridObject* pParent)
 {
-	Volume* pNew = reinterpret_cast<Volume*>(pCloneMe->create_empty_instance());
+	Volume* pNew = reinterpret_cast<Volume*>(pCloneMe->create_empty_instance(m_objectAllocator));
+	if(!pNew)
+		pNew = reinterpret_cast<Volume*>(pCloneMe->create_empty_instance());
 	uint numVrts = vv.num_vertices();
 	Volume::ConstVertexArray vrts = vv.vertices();
 	for(uint i = 0; i < numVrts; ++i)
@@ -487,7 +495,7 @@ void Grid::erase(Vertex* vrt)
 
 	unregister_vertex(vrt);
 
-	delete vrt;
+	m_objectAllocator.destroy(vrt);
 }
 
 void Grid::erase(Edge* edge)
@@ -498,7 +506,7 @@ void Grid::erase(Edge* edge)
 
 	unregister_edge(edge);
 
-	delete edge;
+	m_objectAllocator.destroy(edge);
 }
 
 void Grid::erase(Face* face)
@@ -509,7 +517,7 @@ void Grid::erase(Face* face)
 
 	unregister_face(face);
 
-	delete face;
+	m_objectAllocator.destroy(face);
 }
 
 void Grid::erase(Volume* vol)
@@ -520,7 +528,7 @@ void Grid::erase(Volume* vol)
 
 	unregister_volume(vol);
 
-	delete vol;
+	m_objectAllocator.destroy(vol);
 }
 
 //	the geometric-object-collection:
@@ -45,6 +45,7 @@
 #include "grid_object_collection.h"
 #include "element_storage.h"
 #include "grid_base_object_traits.h"
+#include "grid_object_pool.h"
 
 //	Define PROFILE_GRID to profile some often used gird-methods
 //#define PROFILE_GRID
@@ -563,6 +564,37 @@ class UG_API Grid
 		template <class TGeomObj>
 		size_t attachment_container_size() const;
 
+	///	returns the number of bytes which are reserved for grid objects.
+	/**	Grid objects created by the grid are stored in slabs of contiguous
+	 * memory, one pool for each concrete object type.*/
+		size_t object_pool_capacity() const		{return m_objectAllocator.capacity();}
+
+	///	lets elements created from now on be stored in new slabs
+	/**	The slabs which hold the current elements are released once all of
+	 * those elements were erased (see GridObjectPool::retire_slabs). New
+	 * elements are thus stored contiguously in the order of their creation,
+	 * even if previously erased elements left gaps in the pools.
+	 *
+	 * \sa ug::CompactGridBySFC*/
+		void retire_object_slabs()				{m_objectAllocator.retire_slabs();}
+
+	///	reorders the elements of the given type.
+	/**	vElems has to contain each element of type TGeomObj exactly once.
+	 * If TGeomObj is a concrete type (e.g. Triangle), only the elements of
+	 * the associated section are reordered.
+	 * Afterwards the elements in each section of the grid are iterated in
+	 * the order given by vElems and their attached data is stored in the
+	 * same order.
+	 *
+	 * The elements themselves are not moved, since pointers to them may be
+	 * stored anywhere. However, new elements are allocated contiguously in
+	 * the order of their creation. A copy of a reordered grid (e.g. through
+	 * Grid::operator=) thus also stores its elements in the new order.
+	 *
+	 * \sa ug::OrderElementsBySFC, ug::CompactGridBySFC*/
+		template <class TGeomObj>
+		void reorder_elements(const std::vector<TGeomObj*>& vElems);
+
 	////////////////////////////////////////////////
 	//	connectivity-information
 	///	returns the edge between v1 and v2, if it exists. Returns NULL if not.
@@ -1149,6 +1181,8 @@ class UG_API Grid
 		void clear_attachments();
 
 	protected:
+		GridObjectAllocator		m_objectAllocator;
+
 		VertexElementStorage	m_vertexElementStorage;
 		EdgeElementStorage		m_edgeElementStorage;
 		FaceElementStorage		m_faceElementStorage;
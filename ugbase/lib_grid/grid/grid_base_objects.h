@@ -43,6 +43,7 @@
 #include "lib_grid/attachments/attachment_pipe.h"
 #include "lib_grid/attachments/attached_list.h"
 #include "common/util/hash_function.h"
+#include "grid_object_pool.h"
 #include "common/allocators/small_object_allocator.h"
 #include "common/math/ugmath_types.h"
 #include "common/util/pointer_const_array.h"
@@ -168,6 +169,11 @@ class UG_API GridObject/* : public SmallObject<>*/
 	/**	Make sure to overload this method in derivates of this class!*/
 		virtual GridObject* create_empty_instance() const {return NULL;}
 
+	///	create an instance of the derived type in memory of the given allocator
+	/**	Returns NULL if the derived type doesn't support pooled allocation.
+	 * In this case create_empty_instance() is used instead.*/
+		virtual GridObject* create_empty_instance(GridObjectAllocator& alloc) const {return NULL;}
+
 		virtual int container_section() const = 0;
 		virtual int base_object_id() const = 0;
 	/**
@@ -72,7 +72,7 @@ Grid::create(GridObject* pParent)
 		&&	geometry_traits<TGeomObj>::BASE_OBJECT_ID != -1,
 		invalid_geometry_type);
 
-	TGeomObj* geomObj = new TGeomObj;
+	TGeomObj* geomObj = m_objectAllocator.create<TGeomObj>();
 //	int baseObjectType = geometry_traits<GeomObjType>::base_object_type();
 //	geomObj->m_elemHandle = m_elementStorage[baseObjectType].m_sectionContainer.insert_element(geomObj, geometry_traits<GeomObjType>::container_section());
 //	m_elementStorage[baseObjectType].m_attachmentPipe.register_element(geomObj);
@@ -91,7 +91,7 @@ Grid::create(const typename geometry_traits<TGeomObj>::Descriptor& descriptor,
 			&&	geometry_traits<TGeomObj>::BASE_OBJECT_ID != -1,
 			invalid_geometry_type);
 
-	TGeomObj* geomObj = new TGeomObj(descriptor);
+	TGeomObj* geomObj = m_objectAllocator.create<TGeomObj>(descriptor);
 
 //	int baseObjectType = geometry_traits<TGeomObj>::base_object_type();
 //	geomObj->m_elemHandle = m_elementStorage[baseObjectType].m_sectionContainer.insert_element(geomObj, geometry_traits<GeomObjType>::container_section());
@@ -110,7 +110,7 @@ Grid::create_and_replace(typename geometry_traits<TGeomObj>::grid_base_object* p
 		&&	geometry_traits<TGeomObj>::BASE_OBJECT_ID != -1,
 		invalid_geometry_type);
 
-	TGeomObj* geomObj = new TGeomObj;
+	TGeomObj* geomObj = m_objectAllocator.create<TGeomObj>();
 
 	if(geomObj->reference_object_id() == pReplaceMe->reference_object_id())
 	{
@@ -121,7 +121,7 @@ Grid::create_and_replace(typename geometry_traits<TGeomObj>::grid_base_object* p
 	{
 		LOG("ERROR in Grid::create_and_replace(...): reference objects do not match!");
 		assert(!"ERROR in Grid::create_and_replace(...): reference objects do not match!");
-		delete geomObj;
+		m_objectAllocator.destroy(geomObj);
 		return end<TGeomObj>();
 	}
 }
@@ -290,6 +290,31 @@ size_t Grid::attachment_container_size() const
 	return element_storage<TGeomObj>().m_attachmentPipe.num_data_entries();
 }
 
+template <class TGeomObj>
+void Grid::reorder_elements(const std::vector<TGeomObj*>& vElems)
+{
+	STATIC_ASSERT(geometry_traits<TGeomObj>::BASE_OBJECT_ID != -1,
+				invalid_geometry_type);
+
+	UG_COND_THROW(vElems.size() != num<TGeomObj>(),
+				  "Grid::reorder_elements: " << vElems.size() << " elements "
+				  "were specified, but the grid contains " << num<TGeomObj>());
+
+	typedef typename geometry_traits<TGeomObj>::grid_base_object TBaseObj;
+	ElementStorage<TBaseObj>& es = element_storage<TBaseObj>();
+
+//	move each element to the end of its section
+	for(size_t i = 0; i < vElems.size(); ++i){
+		TBaseObj* e = vElems[i];
+		const int section = e->container_section();
+		es.m_sectionContainer.erase(get_iterator(e), section);
+		es.m_sectionContainer.insert(e, section);
+	}
+
+//	align the attached data with the new element order
+	es.m_attachmentPipe.defragment(true);
+}
+
 ////////////////////////////////////////////////////////////////////////
 //	attachment handling
 template <class TGeomObjClass>
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include "grid_object_pool.h"
+#include "grid_base_objects.h"
+
+namespace ug
+{
+
+///	approximate number of bytes per slab
+static const size_t GRID_OBJECT_POOL_SLAB_BYTES = 64 * 1024;
+
+////////////////////////////////////////////////////////////////////////////////
+//	GridObjectPool
+GridObjectPool::
+GridObjectPool(size_t blockSize) :
+	m_numAllocated(0),
+	m_numUsedInLastSlab(0),
+	m_freeList(NULL),
+	m_numRetired(0)
+{
+//	each free block stores the pointer to the next free block. We round
+//	the block size up, so that those pointers are properly aligned.
+	const size_t ptrSize = sizeof(void*);
+	m_blockSize = ((blockSize + ptrSize - 1) / ptrSize) * ptrSize;
+	m_blocksPerSlab = GRID_OBJECT_POOL_SLAB_BYTES / m_blockSize;
+	if(m_blocksPerSlab < 1)
+		m_blocksPerSlab = 1;
+}
+
+GridObjectPool::
+~GridObjectPool()
+{
+	m_numAllocated = 0;
+	release_slabs(0);
+	for(size_t i = 0; i < m_vRetiredSlabs.size(); ++i)
+		delete[] m_vRetiredSlabs[i];
+}
+
+void* GridObjectPool::
+allocate(char*& slabOut)
+{
+	slabOut = NULL;
+	++m_numAllocated;
+
+//	reuse a previously freed block if possible
+	if(m_freeList){
+		void* p = m_freeList;
+		m_freeList = *static_cast<void**>(m_freeList);
+		return p;
+	}
+
+//	otherwise take the next unused block of the last slab
+	if(m_vSlabs.empty() || m_numUsedInLastSlab == m_blocksPerSlab){
+		slabOut = new char[slab_size()];
+		m_vSlabs.push_back(slabOut);
+		m_numUsedInLastSlab = 0;
+	}
+
+	void* p = m_vSlabs.back() + m_numUsedInLastSlab * m_blockSize;
+	++m_numUsedInLastSlab;
+	return p;
+}
+
+bool GridObjectPool::
+deallocate(void* p)
+{
+	UG_ASSERT(num_allocated() > 0, "No blocks have been allocated from this pool.");
+
+//	blocks in retired slabs are not reused. The retired slabs are released
+//	together with their last block.
+	if(m_numRetired > 0 && is_retired(p)){
+		--m_numRetired;
+		if(m_numRetired > 0)
+			return false;
+		for(size_t i = 0; i < m_vRetiredSlabs.size(); ++i)
+			delete[] m_vRetiredSlabs[i];
+		m_vRetiredSlabs.clear();
+		return true;
+	}
+
+	--m_numAllocated;
+	if(m_numAllocated == 0){
+	//	keep the first slab, so that alternately creating and erasing a
+	//	single object does not allocate a new slab each time
+		const bool released = (m_vSlabs.size() > 1);
+		release_slabs(1);
+		return released;
+	}
+
+	*static_cast<void**>(p) = m_freeList;
+	m_freeList = p;
+	return false;
+}
+
+void GridObjectPool::
+retire_slabs()
+{
+	if(m_numAllocated == 0)
+		return;
+
+	m_vRetiredSlabs.insert(m_vRetiredSlabs.end(), m_vSlabs.begin(), m_vSlabs.end());
+	std::sort(m_vRetiredSlabs.begin(), m_vRetiredSlabs.end());
+	m_numRetired += m_numAllocated;
+
+	m_numAllocated = 0;
+	m_vSlabs.clear();
+	m_freeList = NULL;
+	m_numUsedInLastSlab = 0;
+}
+
+bool GridObjectPool::
+is_retired(const void* p) const
+{
+	const char* cp = static_cast<const char*>(p);
+	std::vector<char*>::const_iterator iter =
+		std::upper_bound(m_vRetiredSlabs.begin(), m_vRetiredSlabs.end(), cp);
+	if(iter == m_vRetiredSlabs.begin())
+		return false;
+	--iter;
+	return cp < *iter + slab_size();
+}
+
+void GridObjectPool::
+release_slabs(size_t numKeep)
+{
+	UG_ASSERT(m_numAllocated == 0, "Slabs of a pool with allocated blocks are released.");
+	for(size_t i = numKeep; i < m_vSlabs.size(); ++i)
+		delete[] m_vSlabs[i];
+	if(numKeep < m_vSlabs.size())
+		m_vSlabs.resize(numKeep);
+	m_freeList = NULL;
+	m_numUsedInLastSlab = 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	GridObjectAllocator
+GridObjectAllocator::
+GridObjectAllocator()
+{
+}
+
+GridObjectAllocator::
+~GridObjectAllocator()
+{
+	for(size_t i = 0; i < m_vPools.size(); ++i){
+		if(m_vPools[i])
+			delete m_vPools[i];
+	}
+}
+
+size_t GridObjectAllocator::
+new_type_index()
+{
+	static size_t counter = 0;
+	return counter++;
+}
+
+void* GridObjectAllocator::
+allocate(GridObjectPool& pool)
+{
+	char* newSlab;
+	void* p = pool.allocate(newSlab);
+	if(newSlab)
+		m_slabMap[newSlab] = &pool;
+	return p;
+}
+
+void GridObjectAllocator::
+free_block(GridObjectPool& pool, void* p)
+{
+//	if this is the last block of the retired slabs, the pool will release them.
+	if(pool.num_retired() > 0 && pool.is_retired(p)){
+		if(pool.num_retired() == 1){
+			const std::vector<char*>& slabs = pool.retired_slabs();
+			for(size_t i = 0; i < slabs.size(); ++i)
+				m_slabMap.erase(slabs[i]);
+		}
+	}
+//	if this is the last block of the pool, the pool will release all of
+//	its slabs but the first one.
+	else if(pool.num_allocated() - pool.num_retired() == 1){
+		const std::vector<char*>& slabs = pool.slabs();
+		for(size_t i = 1; i < slabs.size(); ++i)
+			m_slabMap.erase(slabs[i]);
+	}
+	pool.deallocate(p);
+}
+
+GridObjectPool* GridObjectAllocator::
+find_pool(const void* p) const
+{
+	const char* cp = static_cast<const char*>(p);
+	std::map<const char*, GridObjectPool*>::const_iterator iter
+											= m_slabMap.upper_bound(cp);
+	if(iter == m_slabMap.begin())
+		return NULL;
+	--iter;
+	if(cp < iter->first + iter->second->slab_size())
+		return iter->second;
+	return NULL;
+}
+
+void GridObjectAllocator::
+destroy(GridObject* obj)
+{
+	if(!obj)
+		return;
+
+//	the most derived object starts at the beginning of its block
+	void* mem = dynamic_cast<void*>(obj);
+	GridObjectPool* pool = find_pool(mem);
+	if(!pool){
+		delete obj;
+		return;
+	}
+
+	obj->~GridObject();
+	free_block(*pool, mem);
+}
+
+bool GridObjectAllocator::
+owns(const GridObject* obj) const
+{
+	return find_pool(dynamic_cast<const void*>(obj)) != NULL;
+}
+
+void GridObjectAllocator::
+retire_slabs()
+{
+	for(size_t i = 0; i < m_vPools.size(); ++i){
+		if(m_vPools[i])
+			m_vPools[i]->retire_slabs();
+	}
+}
+
+size_t GridObjectAllocator::
+capacity() const
+{
+	size_t bytes = 0;
+	for(size_t i = 0; i < m_vPools.size(); ++i){
+		if(m_vPools[i])
+			bytes += m_vPools[i]->num_slabs() * m_vPools[i]->slab_size();
+	}
+	return bytes;
+}
+
+}//	end of namespace
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_GRID__GRID_OBJECT_POOL__
+#define __H__LIB_GRID__GRID_OBJECT_POOL__
+
+#include <cstddef>
+#include <map>
+#include <vector>
+#include "common/ug_config.h"
+
+namespace ug
+{
+
+class GridObject;
+
+/**
+ * \brief Slab allocator for grid objects of one fixed size.
+ *
+ * Memory is requested in slabs which hold several objects in a contiguous
+ * block. Objects which are created one after another thus also reside
+ * next to each other in memory. Freed blocks are kept in a free list and
+ * are reused by subsequent allocations. Once the last object of a pool has
+ * been freed, all of its slabs but the first one are released. The first slab
+ * is kept, so that alternately creating and erasing a single object does not
+ * allocate and free a slab each time. It is released with the pool.
+ *
+ * The slabs can be retired (see retire_slabs), e.g. to compact the pool:
+ * subsequent allocations are then served from new slabs only, and the
+ * retired slabs are released once all of their blocks were freed.
+ *
+ * \ingroup lib_grid_grid
+ */
+class UG_API GridObjectPool
+{
+	public:
+		GridObjectPool(size_t blockSize);
+		~GridObjectPool();
+
+		inline size_t block_size() const		{return m_blockSize;}
+		inline size_t blocks_per_slab() const	{return m_blocksPerSlab;}
+		inline size_t slab_size() const			{return m_blockSize * m_blocksPerSlab;}
+
+	///	returns the number of blocks which are currently in use
+		inline size_t num_allocated() const		{return m_numAllocated + m_numRetired;}
+	///	returns the number of blocks in retired slabs which are still in use
+		inline size_t num_retired() const		{return m_numRetired;}
+	///	returns the number of slabs which are currently held by the pool
+		inline size_t num_slabs() const			{return m_vSlabs.size() + m_vRetiredSlabs.size();}
+
+	///	returns a block of block_size() bytes.
+	/**	If a new slab had to be created, its address is written to slabOut.
+	 * Otherwise slabOut is set to NULL.*/
+		void* allocate(char*& slabOut);
+
+	///	returns the given block to the pool.
+	/**	Returns true if the pool released slabs as a consequence (which
+	 * happens when the last block of the pool or the last block of the
+	 * retired slabs was returned).*/
+		bool deallocate(void* p);
+
+	///	retires all slabs. Subsequent blocks are allocated from new slabs.
+	/**	Blocks in retired slabs stay valid and are never handed out again.
+	 * The retired slabs are released together, once their last block has
+	 * been returned.*/
+		void retire_slabs();
+
+	///	returns true if the given block lies in a retired slab
+		bool is_retired(const void* p) const;
+
+	///	returns the slabs which are currently held by the pool (without the retired slabs)
+		inline const std::vector<char*>& slabs() const	{return m_vSlabs;}
+
+	///	returns the retired slabs, sorted by their addresses
+		inline const std::vector<char*>& retired_slabs() const	{return m_vRetiredSlabs;}
+
+	private:
+		GridObjectPool(const GridObjectPool&);
+		GridObjectPool& operator=(const GridObjectPool&);
+
+	///	releases all slabs but the first numKeep ones. No block may be in use.
+		void release_slabs(size_t numKeep);
+
+	private:
+		size_t				m_blockSize;
+		size_t				m_blocksPerSlab;
+		size_t				m_numAllocated;
+		size_t				m_numUsedInLastSlab;
+		void*				m_freeList;
+		std::vector<char*>	m_vSlabs;
+		size_t				m_numRetired;
+		std::vector<char*>	m_vRetiredSlabs;
+};
+
+
+/**
+ * \brief Holds one GridObjectPool per grid object type.
+ *
+ * Each concrete grid object type (e.g. RegularVertex, Triangle, Tetrahedron)
+ * is associated with its own pool, so that objects of the same type are stored
+ * contiguously in memory. The allocator is owned by a Grid and creates and
+ * destroys the objects of that grid.
+ *
+ * Objects which were not created through the allocator (e.g. objects which
+ * were created by operator new and registered at the grid through
+ * Grid::register_element) may still be passed to destroy. They are
+ * recognized and deleted through operator delete.
+ *
+ * \ingroup lib_grid_grid
+ */
+class UG_API GridObjectAllocator
+{
+	public:
+		GridObjectAllocator();
+		~GridObjectAllocator();
+
+	///	creates a new object of the given type
+		template <class TGeomObj>
+		TGeomObj* create();
+
+	///	creates a new object of the given type from the given descriptor
+		template <class TGeomObj, class TDescriptor>
+		TGeomObj* create(const TDescriptor& descriptor);
+
+	///	destroys the given object and frees its memory
+		void destroy(GridObject* obj);
+
+	///	returns true if the given object resides in memory managed by this allocator
+		bool owns(const GridObject* obj) const;
+
+	///	returns the number of bytes currently held by all pools
+		size_t capacity() const;
+
+	///	retires the slabs of all pools (see GridObjectPool::retire_slabs)
+	/**	Objects created afterwards are stored contiguously in new slabs,
+	 * regardless of the gaps left by previously destroyed objects.*/
+		void retire_slabs();
+
+	private:
+		GridObjectAllocator(const GridObjectAllocator&);
+		GridObjectAllocator& operator=(const GridObjectAllocator&);
+
+	///	returns the pool for objects of the given type.
+		template <class TGeomObj>
+		GridObjectPool& pool();
+
+	///	allocates a block in the given pool and registers new slabs
+		void* allocate(GridObjectPool& pool);
+
+	///	returns a block to the given pool and unregisters released slabs
+		void free_block(GridObjectPool& pool, void* p);
+
+	///	returns the pool whose slabs contain the given address or NULL.
+		GridObjectPool* find_pool(const void* p) const;
+
+	///	a unique index for each type for which an object pool is created
+		static size_t new_type_index();
+
+		template <class TGeomObj>
+		static size_t type_index();
+
+	private:
+		std::vector<GridObjectPool*>		m_vPools;
+	///	maps the begin of each slab to the pool which holds it.
+		std::map<const char*, GridObjectPool*>	m_slabMap;
+};
+
+}//	end of namespace
+
+#include "grid_object_pool_impl.hpp"
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_GRID__GRID_OBJECT_POOL_IMPL__
+#define __H__LIB_GRID__GRID_OBJECT_POOL_IMPL__
+
+#include <new>
+
+namespace ug
+{
+
+template <class TGeomObj>
+size_t GridObjectAllocator::
+type_index()
+{
+	static const size_t index = new_type_index();
+	return index;
+}
+
+template <class TGeomObj>
+GridObjectPool& GridObjectAllocator::
+pool()
+{
+	const size_t index = type_index<TGeomObj>();
+	if(index >= m_vPools.size())
+		m_vPools.resize(index + 1, NULL);
+
+	if(!m_vPools[index])
+		m_vPools[index] = new GridObjectPool(sizeof(TGeomObj));
+
+	return *m_vPools[index];
+}
+
+template <class TGeomObj>
+TGeomObj* GridObjectAllocator::
+create()
+{
+	GridObjectPool& p = pool<TGeomObj>();
+	void* mem = allocate(p);
+	try{
+		return new(mem) TGeomObj;
+	}
+	catch(...){
+		free_block(p, mem);
+		throw;
+	}
+}
+
+template <class TGeomObj, class TDescriptor>
+TGeomObj* GridObjectAllocator::
+create(const TDescriptor& descriptor)
+{
+	GridObjectPool& p = pool<TGeomObj>();
+	void* mem = allocate(p);
+	try{
+		return new(mem) TGeomObj(descriptor);
+	}
+	catch(...){
+		free_block(p, mem);
+		throw;
+	}
+}
+
+}//	end of namespace
+
+#endif
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "flat_topology.h"
+#include "lib_grid/multi_grid.h"
+
+namespace ug{
+
+FlatTopology::FlatTopology() :
+	m_pGrid(NULL),
+	m_pMG(NULL),
+	m_bValid(false)
+{
+}
+
+FlatTopology::FlatTopology(Grid& g) :
+	m_pGrid(NULL),
+	m_pMG(NULL),
+	m_bValid(false)
+{
+	freeze(g);
+}
+
+FlatTopology::~FlatTopology()
+{
+	release();
+}
+
+void FlatTopology::release()
+{
+	invalidate();
+	if(m_pGrid){
+		m_pGrid->detach_from_all(m_aID);
+		m_pGrid->unregister_observer(this);
+		m_aaID.invalidate();
+		m_pGrid = NULL;
+		m_pMG = NULL;
+	}
+}
+
+void FlatTopology::invalidate()
+{
+	if(!m_bValid && m_vLevels.empty())
+		return;
+	m_bValid = false;
+	m_vLevels.clear();
+}
+
+size_t FlatTopology::level_of(GridObject* e) const
+{
+	UG_ASSERT(m_bValid, "Invalid snapshot.");
+	if(m_pMG)
+		return (size_t)m_pMG->get_level(e);
+	return 0;
+}
+
+template <class TElem, class TIterator>
+void FlatTopology::
+collect_elements(Level& lvl, TIterator begin, TIterator end)
+{
+	std::vector<GridObject*>& vElems = lvl.vElems[geometry_traits<TElem>::BASE_OBJECT_ID];
+	vElems.clear();
+	for(TIterator iter = begin; iter != end; ++iter){
+		TElem* e = *iter;
+		m_aaID[e] = (int)vElems.size();
+		vElems.push_back(e);
+	}
+}
+
+template <class TElem>
+void FlatTopology::
+build_tables(Level& lvl)
+{
+	typedef typename TElem::side	side_t;
+	const int objID = geometry_traits<TElem>::BASE_OBJECT_ID;
+	const std::vector<GridObject*>& vElems = lvl.vElems[objID];
+	const size_t numVrts = lvl.vElems[VERTEX].size();
+	Grid& g = *m_pGrid;
+
+//	element to vertex
+	Table& ev = lvl.elemVrts[objID];
+	ev.m_vOffsets.resize(vElems.size() + 1);
+	ev.m_vOffsets[0] = 0;
+	for(size_t i = 0; i < vElems.size(); ++i){
+		TElem* e = static_cast<TElem*>(vElems[i]);
+		typename TElem::ConstVertexArray vrts = e->vertices();
+		const size_t num = e->num_vertices();
+		for(size_t j = 0; j < num; ++j)
+			ev.m_vEntries.push_back(m_aaID[vrts[j]]);
+		ev.m_vOffsets[i + 1] = ev.m_vEntries.size();
+	}
+
+//	element to side. The sides of edges are their vertices.
+	if(objID != EDGE){
+		Table& es = lvl.elemSides[objID];
+		es.m_vOffsets.resize(vElems.size() + 1);
+		es.m_vOffsets[0] = 0;
+		for(size_t i = 0; i < vElems.size(); ++i){
+			TElem* e = static_cast<TElem*>(vElems[i]);
+			const size_t num = e->num_sides();
+			for(size_t j = 0; j < num; ++j){
+				side_t* s = g.get_side(e, j);
+				es.m_vEntries.push_back(s ? m_aaID[s] : -1);
+			}
+			es.m_vOffsets[i + 1] = es.m_vEntries.size();
+		}
+	}
+
+//	vertex to element, created by transposing the element to vertex table
+	Table& ve = lvl.vrtElems[objID];
+	ve.m_vOffsets.assign(numVrts + 1, 0);
+	for(size_t i = 0; i < ev.m_vEntries.size(); ++i){
+		const int vrtID = ev.m_vEntries[i];
+		if(vrtID >= 0)
+			++ve.m_vOffsets[vrtID + 1];
+	}
+	for(size_t i = 0; i < numVrts; ++i)
+		ve.m_vOffsets[i + 1] += ve.m_vOffsets[i];
+
+	ve.m_vEntries.resize(ve.m_vOffsets[numVrts]);
+	std::vector<size_t> vPos(ve.m_vOffsets.begin(), ve.m_vOffsets.end() - 1);
+	for(size_t i = 0; i < vElems.size(); ++i){
+		for(size_t j = ev.m_vOffsets[i]; j < ev.m_vOffsets[i + 1]; ++j){
+			const int vrtID = ev.m_vEntries[j];
+			if(vrtID >= 0)
+				ve.m_vEntries[vPos[vrtID]++] = (int)i;
+		}
+	}
+}
+
+void FlatTopology::freeze(Grid& g)
+{
+	GRID_PROFILE_FUNC();
+
+	if(m_pGrid != &g){
+		release();
+		m_pGrid = &g;
+		g.register_observer(this, OT_GRID_OBSERVER | OT_VERTEX_OBSERVER | OT_EDGE_OBSERVER |
+								  OT_FACE_OBSERVER | OT_VOLUME_OBSERVER);
+		g.attach_to_all_dv(m_aID, -1);
+		m_aaID.access(g, m_aID);
+	}
+
+	invalidate();
+
+	MultiGrid* pmg = dynamic_cast<MultiGrid*>(&g);
+	m_pMG = pmg;
+	if(pmg){
+		m_vLevels.resize(pmg->num_levels());
+		for(size_t i = 0; i < m_vLevels.size(); ++i){
+			const int lvl = (int)i;
+			collect_elements<Vertex>(m_vLevels[i], pmg->begin<Vertex>(lvl), pmg->end<Vertex>(lvl));
+			collect_elements<Edge>(m_vLevels[i], pmg->begin<Edge>(lvl), pmg->end<Edge>(lvl));
+			collect_elements<Face>(m_vLevels[i], pmg->begin<Face>(lvl), pmg->end<Face>(lvl));
+			collect_elements<Volume>(m_vLevels[i], pmg->begin<Volume>(lvl), pmg->end<Volume>(lvl));
+		}
+	}
+	else{
+		m_vLevels.resize(1);
+		collect_elements<Vertex>(m_vLevels[0], g.begin<Vertex>(), g.end<Vertex>());
+		collect_elements<Edge>(m_vLevels[0], g.begin<Edge>(), g.end<Edge>());
+		collect_elements<Face>(m_vLevels[0], g.begin<Face>(), g.end<Face>());
+		collect_elements<Volume>(m_vLevels[0], g.begin<Volume>(), g.end<Volume>());
+	}
+
+	for(size_t i = 0; i < m_vLevels.size(); ++i){
+		build_tables<Edge>(m_vLevels[i]);
+		build_tables<Face>(m_vLevels[i]);
+		build_tables<Volume>(m_vLevels[i]);
+	}
+
+	m_bValid = true;
+}
+
+
+void FlatTopology::grid_to_be_destroyed(Grid* grid)
+{
+	release();
+}
+
+void FlatTopology::elements_to_be_cleared(Grid* grid)
+{
+	invalidate();
+}
+
+void FlatTopology::
+vertex_created(Grid* grid, Vertex* vrt, GridObject* pParent, bool replacesParent)
+{
+	invalidate();
+}
+
+void FlatTopology::
+edge_created(Grid* grid, Edge* e, GridObject* pParent, bool replacesParent)
+{
+	invalidate();
+}
+
+void FlatTopology::
+face_created(Grid* grid, Face* f, GridObject* pParent, bool replacesParent)
+{
+	invalidate();
+}
+
+void FlatTopology::
+volume_created(Grid* grid, Volume* vol, GridObject* pParent, bool replacesParent)
+{
+	invalidate();
+}
+
+void FlatTopology::
+vertex_to_be_erased(Grid* grid, Vertex* vrt, Vertex* replacedBy)
+{
+	invalidate();
+}
+
+void FlatTopology::
+edge_to_be_erased(Grid* grid, Edge* e, Edge* replacedBy)
+{
+	invalidate();
+}
+
+void FlatTopology::
+face_to_be_erased(Grid* grid, Face* f, Face* replacedBy)
+{
+	invalidate();
+}
+
+void FlatTopology::
+volume_to_be_erased(Grid* grid, Volume* vol, Volume* replacedBy)
+{
+	invalidate();
+}
+
+void FlatTopology::
+vertices_to_be_merged(Grid* grid, Vertex* target, Vertex* elem1, Vertex* elem2)
+{
+	invalidate();
+}
+
+void FlatTopology::
+edges_to_be_merged(Grid* grid, Edge* target, Edge* elem1, Edge* elem2)
+{
+	invalidate();
+}
+
+void FlatTopology::
+faces_to_be_merged(Grid* grid, Face* target, Face* elem1, Face* elem2)
+{
+	invalidate();
+}
+
+void FlatTopology::
+volumes_to_be_merged(Grid* grid, Volume* target, Volume* elem1, Volume* elem2)
+{
+	invalidate();
+}
+
+}//	end of namespace
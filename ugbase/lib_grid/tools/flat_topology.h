@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__flat_topology__
+#define __H__UG__flat_topology__
+
+#include <vector>
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/common_attachments.h"
+#include "lib_grid/algorithms/attachment_util.h"
+
+namespace ug
+{
+
+class MultiGrid;
+
+/** \ingroup lib_grid_tools
+ *  \{ */
+
+///	Read-only snapshot of the connectivity of a grid in flat arrays.
+/**	The FlatTopology assigns consecutive integer ids to the vertices, edges,
+ * faces and volumes of each level of a grid and stores the connectivity
+ * between them in compressed row storage (CSR) tables:
+ *	- element to vertex (vertex ids in the order of the element's corners),
+ *	- element to side (ids of the sides in reference element order, -1 if a
+ *	  side doesn't exist in the grid),
+ *	- vertex to element.
+ *
+ * Ids are local to a level. For a plain Grid only level 0 exists, for a
+ * MultiGrid one set of tables is built for each level.
+ *
+ * Algorithms which repeatedly query the same connectivity (e.g. through
+ * Grid::associated_elements or the virtual vertex access of grid objects)
+ * may instead work on those arrays.
+ *
+ * The snapshot is built through freeze. As soon as elements are created,
+ * erased or merged in the grid, the snapshot is invalidated and its data is
+ * released. valid() returns false then and freeze has to be called again.
+ * Note that changes which aren't reported to grid observers (e.g.
+ * Grid::flip_orientation) do not invalidate the snapshot.
+ */
+class UG_API FlatTopology : public GridObserver
+{
+	public:
+	///	compressed row storage of an adjacency relation
+		class Table
+		{
+			friend class FlatTopology;
+			public:
+				inline size_t num_rows() const
+					{return m_vOffsets.empty() ? 0 : m_vOffsets.size() - 1;}
+
+				inline size_t num_entries(size_t row) const
+					{return m_vOffsets[row + 1] - m_vOffsets[row];}
+
+				inline const int* begin(size_t row) const
+					{return m_vEntries.empty() ? NULL : &m_vEntries.front() + m_vOffsets[row];}
+
+				inline const int* end(size_t row) const
+					{return m_vEntries.empty() ? NULL : &m_vEntries.front() + m_vOffsets[row + 1];}
+
+				inline int operator()(size_t row, size_t i) const
+					{return m_vEntries[m_vOffsets[row] + i];}
+
+				inline const std::vector<size_t>& offsets() const	{return m_vOffsets;}
+				inline const std::vector<int>& entries() const		{return m_vEntries;}
+
+				void clear()	{m_vOffsets.clear(); m_vEntries.clear();}
+
+			private:
+				std::vector<size_t>	m_vOffsets;
+				std::vector<int>	m_vEntries;
+		};
+
+	public:
+		FlatTopology();
+		FlatTopology(Grid& g);
+		virtual ~FlatTopology();
+
+	///	builds the snapshot of the given grid.
+	/**	If g is a MultiGrid, tables are built for each level.*/
+		void freeze(Grid& g);
+
+	///	releases the snapshot and unregisters from the associated grid.
+		void release();
+
+		inline bool valid() const			{return m_bValid;}
+		inline Grid* grid() const			{return m_pGrid;}
+		inline size_t num_levels() const	{return m_vLevels.size();}
+
+	///	number of elements of the given base type on the given level
+		template <class TElem>
+		inline size_t num(size_t lvl) const
+			{return level(lvl).vElems[geometry_traits<TElem>::BASE_OBJECT_ID].size();}
+
+	///	returns the element with the given id on the given level
+		template <class TElem>
+		inline TElem* element(size_t lvl, int id) const
+			{return static_cast<TElem*>(level(lvl).vElems[geometry_traits<TElem>::BASE_OBJECT_ID][id]);}
+
+	///	returns the level on which the given element lies (0 for a plain Grid)
+		size_t level_of(GridObject* e) const;
+
+	///	returns the id of the given element on its level
+	/**	\{ */
+		inline int id(Vertex* e) const	{UG_ASSERT(m_bValid, "Invalid snapshot."); return m_aaID[e];}
+		inline int id(Edge* e) const	{UG_ASSERT(m_bValid, "Invalid snapshot."); return m_aaID[e];}
+		inline int id(Face* e) const	{UG_ASSERT(m_bValid, "Invalid snapshot."); return m_aaID[e];}
+		inline int id(Volume* e) const	{UG_ASSERT(m_bValid, "Invalid snapshot."); return m_aaID[e];}
+	/**	\} */
+
+	///	element to vertex table. TElem may be Edge, Face or Volume.
+		template <class TElem>
+		inline const Table& vertices(size_t lvl) const
+			{return level(lvl).elemVrts[geometry_traits<TElem>::BASE_OBJECT_ID];}
+
+	///	element to side table. TElem may be Edge, Face or Volume.
+	/**	The sides of edges are their vertices.*/
+		template <class TElem>
+		inline const Table& sides(size_t lvl) const
+		{
+			const int objID = geometry_traits<TElem>::BASE_OBJECT_ID;
+			if(objID == EDGE)
+				return level(lvl).elemVrts[EDGE];
+			return level(lvl).elemSides[objID];
+		}
+
+	///	vertex to element table. TElem may be Edge, Face or Volume.
+		template <class TElem>
+		inline const Table& associated(size_t lvl) const
+			{return level(lvl).vrtElems[geometry_traits<TElem>::BASE_OBJECT_ID];}
+
+	//	grid observer callbacks
+		virtual void grid_to_be_destroyed(Grid* grid);
+		virtual void elements_to_be_cleared(Grid* grid);
+
+		virtual void vertex_created(Grid* grid, Vertex* vrt, GridObject* pParent = NULL,
+									bool replacesParent = false);
+		virtual void edge_created(Grid* grid, Edge* e, GridObject* pParent = NULL,
+								  bool replacesParent = false);
+		virtual void face_created(Grid* grid, Face* f, GridObject* pParent = NULL,
+								  bool replacesParent = false);
+		virtual void volume_created(Grid* grid, Volume* vol, GridObject* pParent = NULL,
+									bool replacesParent = false);
+
+		virtual void vertex_to_be_erased(Grid* grid, Vertex* vrt, Vertex* replacedBy = NULL);
+		virtual void edge_to_be_erased(Grid* grid, Edge* e, Edge* replacedBy = NULL);
+		virtual void face_to_be_erased(Grid* grid, Face* f, Face* replacedBy = NULL);
+		virtual void volume_to_be_erased(Grid* grid, Volume* vol, Volume* replacedBy = NULL);
+
+		virtual void vertices_to_be_merged(Grid* grid, Vertex* target,
+										   Vertex* elem1, Vertex* elem2);
+		virtual void edges_to_be_merged(Grid* grid, Edge* target,
+										Edge* elem1, Edge* elem2);
+		virtual void faces_to_be_merged(Grid* grid, Face* target,
+										Face* elem1, Face* elem2);
+		virtual void volumes_to_be_merged(Grid* grid, Volume* target,
+										  Volume* elem1, Volume* elem2);
+
+	protected:
+		struct Level{
+			std::vector<GridObject*>	vElems[NUM_GEOMETRIC_BASE_OBJECTS];
+			Table	elemVrts[NUM_GEOMETRIC_BASE_OBJECTS];
+			Table	elemSides[NUM_GEOMETRIC_BASE_OBJECTS];
+			Table	vrtElems[NUM_GEOMETRIC_BASE_OBJECTS];
+		};
+
+		inline const Level& level(size_t lvl) const
+		{
+			UG_ASSERT(m_bValid, "Invalid snapshot.");
+			UG_ASSERT(lvl < m_vLevels.size(), "Level " << lvl << " not contained in snapshot.");
+			return m_vLevels[lvl];
+		}
+
+	///	releases the data of the snapshot but keeps the grid assigned
+		void invalidate();
+
+	///	assigns ids to the elements between begin and end
+		template <class TElem, class TIterator>
+		void collect_elements(Level& lvl, TIterator begin, TIterator end);
+
+	///	fills the element to vertex, element to side and vertex to element tables
+		template <class TElem>
+		void build_tables(Level& lvl);
+
+	protected:
+		Grid*				m_pGrid;
+		MultiGrid*			m_pMG;
+		bool				m_bValid;
+		std::vector<Level>	m_vLevels;
+		AInt				m_aID;
+		MultiElementAttachmentAccessor<AInt>	m_aaID;
+};
+
+/** \} */
+
+}//	end of namespace
+
+#endif
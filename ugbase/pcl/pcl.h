@@ -38,6 +38,8 @@
 #include "pcl_communication_structs.h"
 #include "pcl_interface_communicator.h"
 #include "pcl_process_communicator.h"
+#include "pcl_persistent_communicator.h"
+#include "pcl_request.h"
 #include "pcl_util.h"
 #include "pcl_debug.h"
 #include "pcl_domain_decomposition.h"
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "pcl_persistent_communicator.h"
+#include "pcl_comm_world.h"
+#include "pcl_profiling.h"
+#include "common/error.h"
+
+namespace pcl
+{
+
+PersistentCommunicator::
+PersistentCommunicator() :
+	m_vSendOffset(1, 0), m_vRecvOffset(1, 0),
+	m_bSetup(false), m_bActive(false)
+{
+}
+
+PersistentCommunicator::
+~PersistentCommunicator()
+{
+	free_requests();
+}
+
+void PersistentCommunicator::
+free_requests()
+{
+	if(m_vRequests.empty()) return;
+
+//	requests can't be freed after MPI has been finalized
+	int finalized = 0;
+	MPI_Finalized(&finalized);
+	if(!finalized){
+		if(m_bActive)
+			MPI_Waitall((int)m_vRequests.size(), &m_vRequests.front(),
+						MPI_STATUSES_IGNORE);
+		for(size_t i = 0; i < m_vRequests.size(); ++i)
+			MPI_Request_free(&m_vRequests[i]);
+	}
+	m_vRequests.clear();
+	m_bActive = false;
+}
+
+void PersistentCommunicator::
+clear()
+{
+	free_requests();
+	m_vSendProc.clear();	m_vRecvProc.clear();
+	m_vSendOffset.assign(1, 0);	m_vRecvOffset.assign(1, 0);
+	m_vSendBuf.clear();		m_vRecvBuf.clear();
+	m_bSetup = false;
+}
+
+size_t PersistentCommunicator::
+add_send(int targetProc, size_t numBytes)
+{
+	UG_COND_THROW(m_bSetup, "PersistentCommunicator::add_send: already set up.");
+	m_vSendProc.push_back(targetProc);
+	m_vSendOffset.push_back(m_vSendOffset.back() + numBytes);
+	return m_vSendProc.size() - 1;
+}
+
+size_t PersistentCommunicator::
+add_receive(int srcProc, size_t numBytes)
+{
+	UG_COND_THROW(m_bSetup, "PersistentCommunicator::add_receive: already set up.");
+	m_vRecvProc.push_back(srcProc);
+	m_vRecvOffset.push_back(m_vRecvOffset.back() + numBytes);
+	return m_vRecvProc.size() - 1;
+}
+
+void PersistentCommunicator::
+setup(int tag)
+{
+	PCL_PROFILE(pcl_PersCom_setup);
+	UG_COND_THROW(m_bSetup, "PersistentCommunicator::setup: already set up.");
+
+//	one extra byte, such that the buffers are never empty
+	m_vSendBuf.resize(m_vSendOffset.back() + 1);
+	m_vRecvBuf.resize(m_vRecvOffset.back() + 1);
+
+	m_vRequests.resize(m_vRecvProc.size() + m_vSendProc.size());
+	size_t r = 0;
+	for(size_t i = 0; i < m_vRecvProc.size(); ++i, ++r)
+		MPI_Recv_init(&m_vRecvBuf[m_vRecvOffset[i]],
+					  (int)(m_vRecvOffset[i+1] - m_vRecvOffset[i]),
+					  MPI_UNSIGNED_CHAR, m_vRecvProc[i], tag,
+					  PCL_COMM_WORLD, &m_vRequests[r]);
+
+	for(size_t i = 0; i < m_vSendProc.size(); ++i, ++r)
+		MPI_Send_init(&m_vSendBuf[m_vSendOffset[i]],
+					  (int)(m_vSendOffset[i+1] - m_vSendOffset[i]),
+					  MPI_UNSIGNED_CHAR, m_vSendProc[i], tag,
+					  PCL_COMM_WORLD, &m_vRequests[r]);
+
+	m_bSetup = true;
+}
+
+void PersistentCommunicator::
+start()
+{
+	PCL_PROFILE(pcl_PersCom_start);
+	UG_COND_THROW(!m_bSetup, "PersistentCommunicator::start: not set up.");
+	UG_COND_THROW(m_bActive, "PersistentCommunicator::start: exchange still active.");
+	if(!m_vRequests.empty())
+		MPI_Startall((int)m_vRequests.size(), &m_vRequests.front());
+	m_bActive = true;
+}
+
+void PersistentCommunicator::
+wait()
+{
+	PCL_PROFILE(pcl_PersCom_wait);
+	UG_COND_THROW(!m_bActive, "PersistentCommunicator::wait: no exchange started.");
+	if(!m_vRequests.empty())
+		MPI_Waitall((int)m_vRequests.size(), &m_vRequests.front(),
+					MPI_STATUSES_IGNORE);
+	m_bActive = false;
+}
+
+}//	end of namespace pcl
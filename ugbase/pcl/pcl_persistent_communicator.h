@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__PCL__PCL_PERSISTENT_COMMUNICATOR__
+#define __H__PCL__PCL_PERSISTENT_COMMUNICATOR__
+
+#include <vector>
+#include <mpi.h>
+
+namespace pcl
+{
+
+/// \addtogroup pcl
+/// \{
+
+////////////////////////////////////////////////////////////////////////
+//	PersistentCommunicator
+///	Repeated point-to-point exchange of messages with fixed sizes.
+/**
+ * All messages (target / source process and size in bytes) are registered
+ * once via add_send and add_receive. setup allocates one send and one
+ * receive buffer and creates persistent requests (MPI_Send_init,
+ * MPI_Recv_init) for all messages. Each exchange then consists of
+ *
+ * - writing the outgoing data to send_buffer(i),
+ * - start() (MPI_Startall),
+ * - wait() (MPI_Waitall),
+ * - reading the incoming data from receive_buffer(i),
+ *
+ * without any allocation or size communication. Work not depending on the
+ * received data may be done between start() and wait().
+ *
+ * Messages are exchanged on PCL_COMM_WORLD, i.e. the process ids are the
+ * ones used in the layouts. Two persistent communicators that exchange
+ * messages between the same pair of processes with the same tag must not
+ * be active at the same time.
+ *
+ * Instances can't be copied, since the requests are bound to the buffers.
+ */
+class PersistentCommunicator
+{
+	public:
+		PersistentCommunicator();
+		~PersistentCommunicator();
+
+	///	removes all messages and frees the requests
+		void clear();
+
+	///	registers a message of numBytes to targetProc, returns its index
+		size_t add_send(int targetProc, size_t numBytes);
+
+	///	registers a message of numBytes from srcProc, returns its index
+		size_t add_receive(int srcProc, size_t numBytes);
+
+	///	allocates the buffers and creates the persistent requests
+		void setup(int tag);
+
+	///	returns if setup has been called
+		bool is_setup() const						{return m_bSetup;}
+
+	///	starts all sends and receives
+		void start();
+
+	///	waits until all sends and receives of the last start have completed
+		void wait();
+
+	///	returns if an exchange has been started and not yet waited for
+		bool is_active() const						{return m_bActive;}
+
+	///	number of messages
+	/// \{
+		size_t num_sends() const					{return m_vSendProc.size();}
+		size_t num_receives() const					{return m_vRecvProc.size();}
+	/// \}
+
+	///	process ids of the messages
+	/// \{
+		int send_proc(size_t i) const				{return m_vSendProc[i];}
+		int receive_proc(size_t i) const			{return m_vRecvProc[i];}
+	/// \}
+
+	///	buffer of message i (valid after setup)
+	/// \{
+		char* send_buffer(size_t i)					{return &m_vSendBuf[m_vSendOffset[i]];}
+		const char* receive_buffer(size_t i) const	{return &m_vRecvBuf[m_vRecvOffset[i]];}
+	/// \}
+
+	private:
+		PersistentCommunicator(const PersistentCommunicator&);
+		PersistentCommunicator& operator=(const PersistentCommunicator&);
+
+		void free_requests();
+
+	private:
+		std::vector<int>			m_vSendProc;
+		std::vector<int>			m_vRecvProc;
+
+	///	offsets of the messages in the buffers (size: num messages + 1)
+		std::vector<size_t>			m_vSendOffset;
+		std::vector<size_t>			m_vRecvOffset;
+
+		std::vector<char>			m_vSendBuf;
+		std::vector<char>			m_vRecvBuf;
+
+	///	receive requests followed by send requests
+		std::vector<MPI_Request>	m_vRequests;
+
+		bool m_bSetup;
+		bool m_bActive;
+};
+
+// end group pcl
+/// \}
+
+}//	end of namespace pcl
+
+#endif
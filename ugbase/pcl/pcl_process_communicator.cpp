@@ -229,6 +229,42 @@ create_sub_communicator(vector<int> &newProcs) const
 	return newProcComm;
 }
 
+ProcessCommunicator
+ProcessCommunicator::
+split(int color) const
+{
+	UG_COND_THROW(is_local(), "not available");
+	PCL_PROFILE(pcl_ProcCom_split);
+
+//	if the current communicator is empty theres nothing to do
+	if(empty())
+		return ProcessCommunicator(PCD_EMPTY);
+
+	int rank;
+	MPI_Comm_rank(m_comm->m_mpiComm, &rank);
+
+	MPI_Comm commNew;
+	MPI_Comm_split(m_comm->m_mpiComm, (color < 0) ? MPI_UNDEFINED : color,
+				   rank, &commNew);
+
+//	processes with negative color do not participate
+	if(commNew == MPI_COMM_NULL)
+		return ProcessCommunicator(PCD_EMPTY);
+
+//	collect the global ranks, newProcs[group rank] = global rank
+	int newSize;
+	MPI_Comm_size(commNew, &newSize);
+	vector<int> newProcs(newSize);
+	int globalRank = pcl::ProcRank();
+	MPI_Allgather(&globalRank, 1, MPI_INT, &newProcs.front(), 1, MPI_INT, commNew);
+
+	ProcessCommunicator newProcComm;
+	newProcComm.m_comm = SPCommWrapper(new CommWrapper(commNew, true));
+	newProcComm.m_comm->m_procs = newProcs;
+
+	return newProcComm;
+}
+
 ProcessCommunicator
 ProcessCommunicator::
 create_communicator(vector<int> &newGlobalProcs)
@@ -690,6 +726,59 @@ void ProcessCommunicator::broadcast(void *v, size_t size, DataType type, int roo
 	MPI_Bcast(v, size, type, root, m_comm->m_mpiComm);
 }
 
+void ProcessCommunicator::
+iallreduce(const void* sendBuf, void* recBuf, int count,
+		   DataType type, ReduceOperation op, Request& req) const
+{
+	PCL_PROFILE(pcl_ProcCom_iallreduce);
+	UG_COND_THROW(req.is_active(), "ERROR in ProcessCommunicator::iallreduce: request still active.");
+	if(is_local()) {memcpy(recBuf, sendBuf, count*GetSize(type)); return;}
+	UG_COND_THROW(empty(),	"ERROR in ProcessCommunicator::iallreduce: empty communicator.");
+
+#if MPI_VERSION >= 3
+	MPI_Iallreduce(const_cast<void*>(sendBuf), recBuf, count, type, op,
+				   m_comm->m_mpiComm, &req.m_request);
+	req.m_bActive = true;
+#else
+	MPI_Allreduce(const_cast<void*>(sendBuf), recBuf, count, type, op, m_comm->m_mpiComm);
+#endif
+}
+
+void ProcessCommunicator::
+ibroadcast(void *v, size_t size, DataType type, Request& req, int root) const
+{
+	PCL_PROFILE(pcl_ProcCom_Ibcast);
+	UG_COND_THROW(req.is_active(), "ERROR in ProcessCommunicator::ibroadcast: request still active.");
+	if(is_local()) return;
+	UG_COND_THROW(empty(), "ERROR in ProcessCommunicator::ibroadcast: empty communicator.");
+
+#if MPI_VERSION >= 3
+	MPI_Ibcast(v, size, type, root, m_comm->m_mpiComm, &req.m_request);
+	req.m_bActive = true;
+#else
+	MPI_Bcast(v, size, type, root, m_comm->m_mpiComm);
+#endif
+}
+
+void ProcessCommunicator::
+ialltoall(const void* sendBuf, int sendCount, DataType sendType,
+		  void* recBuf, int recCount, DataType recType, Request& req) const
+{
+	PCL_PROFILE(pcl_ProcCom_ialltoall);
+	UG_COND_THROW(req.is_active(), "ERROR in ProcessCommunicator::ialltoall: request still active.");
+	if(is_local()) {memcpy(recBuf, sendBuf, recCount*GetSize(recType)); return;}
+	UG_COND_THROW(empty(), "ERROR in ProcessCommunicator::ialltoall: empty communicator.");
+
+#if MPI_VERSION >= 3
+	MPI_Ialltoall(const_cast<void*>(sendBuf), sendCount, sendType, recBuf,
+				  recCount, recType, m_comm->m_mpiComm, &req.m_request);
+	req.m_bActive = true;
+#else
+	MPI_Alltoall(const_cast<void*>(sendBuf), sendCount, sendType, recBuf,
+				 recCount, recType, m_comm->m_mpiComm);
+#endif
+}
+
 void ProcessCommunicator::broadcast(ug::BinaryBuffer &buf, int root) const
 {
 	if(is_local()) return;
@@ -37,6 +37,7 @@
 #include <map>
 #include <vector>
 #include "pcl_methods.h"
+#include "pcl_request.h"
 #include "common/util/smart_pointer.h"
 #include "common/util/binary_stream.h"
 #include "common/util/binary_buffer.h"
@@ -111,6 +112,13 @@ class ProcessCommunicator
 	 * relative to the current communicator.*/
 		ProcessCommunicator create_sub_communicator(std::vector<int> &newProcs) const;
 
+	///	splits the communicator into disjoint sub-communicators
+	/**	All processes of the current communicator have to call this method.
+	 * Processes passing the same color end up in the same new communicator,
+	 * ordered by their rank in the current communicator. Processes passing
+	 * a negative color obtain an empty communicator.*/
+		ProcessCommunicator split(int color) const;
+
 	/**	Make sure that all processes call this method with the same parameters!
 	 * \{ */
 		static ProcessCommunicator create_communicator(std::vector<int> &newGlobalProcs);
@@ -358,6 +366,34 @@ class ProcessCommunicator
 		void barrier() const;
 
 
+	///	starts MPI_Iallreduce on the processes of the communicator.
+	/**	The buffers must not be accessed until req has completed (see
+	 * pcl::Request). All processes of the communicator have to call the
+	 * non-blocking collectives in the same order. If the MPI implementation
+	 * does not support non-blocking collectives (MPI < 3), the blocking
+	 * operation is performed and req stays inactive.*/
+		void iallreduce(const void* sendBuf, void* recBuf, int count,
+						DataType type, ReduceOperation op, Request& req) const;
+
+	///	simplified iallreduce for buffers of supported datatypes
+		template<typename T>
+		void iallreduce(const T *pSendBuff, T *pReceiveBuff, size_t count,
+						pcl::ReduceOperation op, Request& req) const;
+
+	///	starts MPI_Ibcast. See iallreduce for the use of req.
+		void ibroadcast(void *v, size_t size, DataType type, Request& req,
+						int root=0) const;
+
+	///	simplified ibroadcast for buffers of supported datatypes
+		template<typename T>
+		void ibroadcast(T *p, size_t size, Request& req, int root=0) const;
+
+	///	starts MPI_Ialltoall. See alltoall for the parameters and iallreduce for the use of req.
+		void ialltoall(const void* sendBuf, int sendCount, DataType sendType,
+					   void* recBuf, int recCount, DataType recType,
+					   Request& req) const;
+
+
 	///	sends data with the given tag to the specified process.
 	/**	This method waits until the data has been sent.*/
 		void send_data(void* pBuffer, int bufferSize, int destProc, int tag) const;
@@ -229,6 +229,22 @@ allreduce(const std::vector<T> &send, std::vector<T> &receive,
 }
 
 
+template<typename T>
+void ProcessCommunicator::
+iallreduce(const T *pSendBuff, T *pReceiveBuff, size_t count,
+		   pcl::ReduceOperation op, Request& req) const
+{
+	iallreduce(pSendBuff, pReceiveBuff, count, DataTypeTraits<T>::get_data_type(), op, req);
+}
+
+template<typename T>
+void ProcessCommunicator::
+ibroadcast(T *p, size_t size, Request& req, int root) const
+{
+	ibroadcast(p, size, DataTypeTraits<T>::get_data_type(), req, root);
+}
+
+
 
 template<typename T>
 void ProcessCommunicator::
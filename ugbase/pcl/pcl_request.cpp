@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "pcl_request.h"
+#include "pcl_methods.h"
+#include "pcl_profiling.h"
+
+namespace pcl
+{
+
+Request::
+Request() :
+	m_request(MPI_REQUEST_NULL),
+	m_bActive(false)
+{
+}
+
+Request::
+~Request()
+{
+	if(!m_bActive) return;
+
+//	requests can't be completed after MPI has been finalized
+	int finalized = 0;
+	MPI_Finalized(&finalized);
+	if(!finalized)
+		wait();
+}
+
+bool Request::
+test()
+{
+	if(!m_bActive) return true;
+	PCL_PROFILE(pcl_Request_test);
+	int flag = 0;
+	MPI_Test(&m_request, &flag, MPI_STATUS_IGNORE);
+	if(flag) m_bActive = false;
+	return flag != 0;
+}
+
+void Request::
+wait()
+{
+	if(!m_bActive) return;
+	PCL_PROFILE(pcl_Request_wait);
+	pcl::MPI_Wait(&m_request);
+	m_bActive = false;
+}
+
+}//	end of namespace pcl
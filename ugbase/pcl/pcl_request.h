@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__PCL__PCL_REQUEST__
+#define __H__PCL__PCL_REQUEST__
+
+#include <mpi.h>
+
+namespace pcl
+{
+
+class ProcessCommunicator;
+
+/// \addtogroup pcl
+/// \{
+
+////////////////////////////////////////////////////////////////////////
+//	Request
+///	Handle of a non-blocking operation, e.g. ProcessCommunicator::iallreduce.
+/**
+ * A request is started by the non-blocking method it is passed to and can
+ * then be tested or waited for. The buffers passed to that method must not
+ * be accessed until the request has completed. Operations that complete
+ * immediately (e.g. on local communicators) leave the request inactive.
+ *
+ * A request that is still active on destruction is waited for. Requests
+ * can't be copied.
+ */
+class Request
+{
+	public:
+		Request();
+		~Request();
+
+	///	returns true if the operation has completed (true for inactive requests)
+		bool test();
+
+	///	waits until the operation has completed
+		void wait();
+
+	///	returns if an operation has been started and not yet completed
+		bool is_active() const				{return m_bActive;}
+
+	private:
+		friend class ProcessCommunicator;
+
+		Request(const Request&);
+		Request& operator=(const Request&);
+
+	private:
+		MPI_Request	m_request;
+		bool		m_bActive;
+};
+
+// end group pcl
+/// \}
+
+}//	end of namespace pcl
+
+#endif